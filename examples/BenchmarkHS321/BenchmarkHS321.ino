@@ -0,0 +1,194 @@
+#include <Arduino.h>
+#include <HS321.h>
+
+/*
+ * Замер задержки и пропускной способности обмена с реальным частотником.
+ *
+ * Перебирает скорости шины, синхронный (readParametersInGroups) и асинхронный
+ * (beginReadParametersInGroups + poll) режимы, длину кадра чтения 1..largestGroupSize()
+ * и длину кадра записи 1..24. Каждая строка вывода — «имя значение единица», как у
+ * бенчмарков make bench на ПК, поэтому результаты разных установок и версий библиотеки
+ * сравниваются утилитой diff или скриптом:
+ *
+ *     hs321.read.19200.async.span_16.rtt_p90 15320 us
+ *
+ * Показатели комбинации: rtt_p50/p90/p99/max — время от запроса до ответа, registers_per_s —
+ * прочитано или записано регистров в секунду, cpu_idle — доля времени, свободная для loop()
+ * (в синхронном режиме процессор ожидает ответа, поэтому 0), error_rate — доля неудачных
+ * запросов, timeouts/crc_errors/exceptions — попытки по HS321::stats().
+ *
+ * Частотник должен быть остановлен. Запись повторяет текущие значения F7.00–F7.23
+ * (программа ПЛК), прочитанные перед замером, поэтому настройки не меняются; каждая
+ * запись сохраняется частотником в EEPROM, поэтому количество записей ограничено.
+ * Чтение идёт с начала самой большой группы и не выходит за её конец: за концом группы
+ * частотник отвечает исключением, и замер показывал бы не пропускную способность.
+ */
+
+#define rs485TransceiverReceive 4   // Вывод разрешения работы передатчика и приёмника
+#define BENCH_READ_SAMPLES 32       // Запросов чтения на комбинацию
+#define BENCH_WRITE_SAMPLES 4       // Запросов записи на комбинацию
+
+ModbusBus bus(Serial1, Serial, 9600, rs485TransceiverReceive);
+HS321 hs321(0x0001, bus);
+
+const unsigned long baudRates[] = { 9600, 19200, 38400 };   // Скорости замера (FC.00)
+const uint8_t writeSpans[] = { 1, 2, 4, 8, 16, 24 };          // Длины кадра записи в F7
+
+uint16_t values[largestGroupSize()];              // Буфер чтения
+GroupsParameter readGroup = GROUP_F0;             // Самая большая группа (чтение с её начала)
+uint16_t program[24];                             // Текущие значения F7.00–F7.23
+unsigned long samples[BENCH_READ_SAMPLES];        // Времена запросов комбинации (мкс)
+
+void runBenchmark();
+void benchSpan(bool write, unsigned long baud, bool async, uint8_t span);
+void report(const __FlashStringHelper* operation, unsigned long baud, bool async, uint8_t span,
+            const __FlashStringHelper* metric, unsigned long value, const __FlashStringHelper* unit);
+unsigned long percentile(uint8_t count, uint8_t percent);
+
+void setup() {
+	Serial.begin(115200);
+	hs321.begin();
+	runBenchmark();
+}
+
+void loop() {
+}
+
+void runBenchmark() {
+	if (!hs321.detectBaudRate()) {
+		Serial.println(F("hs321.bench.error 1 no_response"));
+		return;
+	}
+	const unsigned long originalBaud = bus.baud();
+	if (!hs321.readParametersInGroups(GROUP_F7, 0, program, 24)) {
+		Serial.println(F("hs321.bench.error 1 f7_read"));
+		return;
+	}
+	Serial.print(F("hs321.bench.max_read_registers "));
+	Serial.print(static_cast<unsigned long>(ModbusBus::MAX_READ_REGISTERS));
+	Serial.println(F(" registers"));
+	// Группы F0–FP (индекс совпадает со значением enum); d меньше F8
+	for (uint8_t group = 0; group < GROUP_COUNT - 1; group++) {
+		if (groupSizes[group] > groupSizes[readGroup]) {
+			readGroup = static_cast<GroupsParameter>(group);
+		}
+	}
+	Serial.print(F("hs321.bench.largest_group "));
+	Serial.print(static_cast<unsigned long>(largestGroupSize()));
+	Serial.println(F(" registers"));
+
+	for (uint8_t b = 0; b < sizeof(baudRates) / sizeof(baudRates[0]); b++) {
+		const unsigned long baud = baudRates[b];
+		if (!hs321.switchBaudRate(baud)) {
+			report(F("baud"), baud, false, 0, F("switch_failed"), 1, F("count"));
+			continue;
+		}
+		for (uint8_t mode = 0; mode < 2; mode++) {
+			const bool async = mode == 1;
+			// Длины 1, 2, 4 ... и вся группа readGroup
+			for (size_t span = 1; ; span *= 2) {
+				if (span > largestGroupSize()) {
+					span = largestGroupSize();
+				}
+				benchSpan(false, baud, async, static_cast<uint8_t>(span));
+				if (span == largestGroupSize()) {
+					break;
+				}
+			}
+			for (uint8_t i = 0; i < sizeof(writeSpans); i++) {
+				benchSpan(true, baud, async, writeSpans[i]);
+			}
+		}
+	}
+	hs321.switchBaudRate(originalBaud);
+	Serial.println(F("hs321.bench.done 1 count"));
+}
+
+/*
+ * Замер одной комбинации. Чтение идёт с начала readGroup, запись — с F7.00.
+ */
+void benchSpan(const bool write, const unsigned long baud, const bool async, const uint8_t span) {
+	const uint8_t count = write ? BENCH_WRITE_SAMPLES : BENCH_READ_SAMPLES;
+	uint8_t failed = 0;
+	unsigned long busy = 0;
+	hs321.resetStats();
+	const unsigned long started = micros();
+	for (uint8_t i = 0; i < count; i++) {
+		const unsigned long requested = micros();
+		bool ok;
+		if (!async) {
+			ok = write ? hs321.writeParametersInGroups(GROUP_F7, 0, program, span)
+			           : hs321.readParametersInGroups(readGroup, 0, values, span);
+		} else {
+			ok = write ? hs321.beginWriteParametersInGroups(GROUP_F7, 0, program, span)
+			           : hs321.beginReadParametersInGroups(readGroup, 0, values, span);
+			TransactionStatus status = ok ? TransactionStatus::PENDING : TransactionStatus::FAILED;
+			while (status == TransactionStatus::PENDING) {
+				// Время внутри poll() — работа библиотеки, остальное свободно для loop()
+				const unsigned long polled = micros();
+				status = hs321.poll();
+				busy += micros() - polled;
+			}
+			ok = status == TransactionStatus::COMPLETED;
+		}
+		samples[i] = micros() - requested;
+		if (!ok) {
+			failed++;
+		}
+	}
+	const unsigned long elapsed = micros() - started;
+
+	// Сортировка вставками: выборка небольшая
+	for (uint8_t i = 1; i < count; i++) {
+		const unsigned long sample = samples[i];
+		uint8_t j = i;
+		for (; j > 0 && samples[j - 1] > sample; j--) {
+			samples[j] = samples[j - 1];
+		}
+		samples[j] = sample;
+	}
+
+	const __FlashStringHelper* operation = write ? F("write") : F("read");
+	const unsigned long registers = static_cast<unsigned long>(count - failed) * span;
+	const TransactionStats& stats = hs321.stats();
+	report(operation, baud, async, span, F("rtt_p50"), percentile(count, 50), F("us"));
+	report(operation, baud, async, span, F("rtt_p90"), percentile(count, 90), F("us"));
+	report(operation, baud, async, span, F("rtt_p99"), percentile(count, 99), F("us"));
+	report(operation, baud, async, span, F("rtt_max"), samples[count - 1], F("us"));
+	report(operation, baud, async, span, F("registers_per_s"),
+	       elapsed ? static_cast<unsigned long>(static_cast<unsigned long long>(registers) * 1000000UL / elapsed) : 0, F("registers"));
+	report(operation, baud, async, span, F("cpu_idle"),
+	       (async && elapsed) ? static_cast<unsigned long>(100ULL * (elapsed - busy) / elapsed) : 0, F("%"));
+	report(operation, baud, async, span, F("error_rate"), 100UL * failed / count, F("%"));
+	report(operation, baud, async, span, F("timeouts"), stats.timeouts, F("count"));
+	report(operation, baud, async, span, F("crc_errors"), stats.crcErrors, F("count"));
+	report(operation, baud, async, span, F("exceptions"), stats.exceptions, F("count"));
+}
+
+/*
+ * Строка результата: hs321.<операция>.<скорость>.<режим>.span_<длина>.<показатель> <значение> <единица>
+ */
+void report(const __FlashStringHelper* operation, const unsigned long baud, const bool async, const uint8_t span,
+            const __FlashStringHelper* metric, const unsigned long value, const __FlashStringHelper* unit) {
+	Serial.print(F("hs321."));
+	Serial.print(operation);
+	Serial.print('.');
+	Serial.print(baud);
+	Serial.print(async ? F(".async") : F(".sync"));
+	Serial.print(F(".span_"));
+	Serial.print(span);
+	Serial.print('.');
+	Serial.print(metric);
+	Serial.print(' ');
+	Serial.print(value);
+	Serial.print(' ');
+	Serial.println(unit);
+}
+
+/*
+ * Процентиль отсортированной выборки по ближайшему рангу.
+ */
+unsigned long percentile(const uint8_t count, const uint8_t percent) {
+	const uint16_t rank = (static_cast<uint16_t>(count) * percent + 99) / 100;
+	return samples[(rank > 0) ? rank - 1 : 0];
+}
@@ -3,7 +3,8 @@
 
 #define rs485TransceiverReceive 4 // Вывод разрешения работы передатчика и приёмника
 
-HS321 hs321(0x0001, Serial1, &Serial, 9600, rs485TransceiverReceive);
+ModbusBus bus(Serial1, Serial, 9600, rs485TransceiverReceive); // Общая шина RS485
+HS321 hs321(0x0001, bus);                                       // Частотник с адресом 1
 
 void testConnection();
 
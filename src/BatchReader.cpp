@@ -0,0 +1,233 @@
+#include "HS321Config.h"
+
+#if HS321_ENABLE_BATCH_READER
+
+#include "BatchReader.h"
+
+/** @file BatchReader.cpp
+ * @brief Реализация пакетного чтения регистров частотника HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+/**
+ * @brief Конструктор класса BatchReader.
+ *
+ * @param drive Частотник, параметры которого читаются.
+ * @param maxGap Максимальное количество пропущенных регистров между объединяемыми адресами.
+ */
+BatchReader::BatchReader(HS321& drive, const uint8_t maxGap)
+                                                                :_drive(&drive),
+                                                                _maxGap(maxGap){
+}
+
+/**
+ * @brief Регистрация параметра группы в пакете.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @param value Указатель на переменную для значения.
+ * @return true, если параметр добавлен, иначе false.
+ */
+bool BatchReader::add(const GroupsParameter group, const uint8_t numberGroup, uint16_t* value) {
+    return addAddress(HS321::buildParameterAddress(group, numberGroup), value);
+}
+
+/**
+ * @brief Регистрация произвольного регистра в пакете.
+ *
+ * Регистр вставляется с сохранением сортировки по адресу, поэтому при чтении
+ * диапазоны определяются одним проходом. Один адрес можно зарегистрировать
+ * несколько раз, значение получат все переменные.
+ *
+ * @param address Полный адрес регистра Modbus.
+ * @param value Указатель на переменную для значения.
+ * @return true, если регистр добавлен, иначе false.
+ */
+bool BatchReader::addAddress(const uint16_t address, uint16_t* value) {
+    if (value == nullptr || _count >= HS321_BATCH_SIZE || isBusy()) {
+        return false;
+    }
+    // Сортировка вставкой
+    size_t i = _count;
+    while (i > 0 && _entries[i - 1].address > address) {
+        _entries[i] = _entries[i - 1];
+        i--;
+    }
+    _entries[i].address = address;
+    _entries[i].target = value;
+    _count++;
+    return true;
+}
+
+/**
+ * @brief Удаление всех зарегистрированных параметров.
+ *
+ * Не выполняется, пока идёт чтение пакета.
+ */
+void BatchReader::clear() {
+    if (!isBusy()) {
+        _count = 0;
+    }
+}
+
+/**
+ * @brief Количество кадров, которыми будет прочитан пакет.
+ *
+ * @return Количество кадров 0x03.
+ */
+size_t BatchReader::frameCount() const {
+    size_t frames = 0;
+    for (size_t first = 0; first < _count; first = rangeEnd(first)) {
+        frames++;
+    }
+    return frames;
+}
+
+/**
+ * @brief Определение границы диапазона.
+ *
+ * Диапазон продолжается, пока пропуск до следующего адреса не превышает maxGap,
+ * а длина диапазона не превышает HS321_BATCH_MAX_SPAN и ModbusBus::MAX_READ_REGISTERS.
+ *
+ * @param first Индекс первого регистра диапазона.
+ * @return Индекс регистра, следующего за последним в диапазоне.
+ */
+size_t BatchReader::rangeEnd(const size_t first) const {
+    constexpr uint32_t maxSpan = (HS321_BATCH_MAX_SPAN < ModbusBus::MAX_READ_REGISTERS) ? HS321_BATCH_MAX_SPAN
+                                                                                         : ModbusBus::MAX_READ_REGISTERS;
+    const uint16_t start = _entries[first].address;
+    size_t last = first + 1;
+    while (last < _count) {
+        const uint16_t previous = _entries[last - 1].address;
+        const uint16_t next = _entries[last].address;
+        // Пропуск между адресами (повторяющийся адрес пропуска не даёт)
+        if (next > previous && static_cast<uint32_t>(next - previous - 1) > _maxGap) {
+            break;
+        }
+        if (static_cast<uint32_t>(next - start) + 1 > maxSpan) {
+            break;
+        }
+        last++;
+    }
+    return last;
+}
+
+/**
+ * @brief Чтение всего пакета с ожиданием завершения.
+ *
+ * @return true, если все кадры прочитаны успешно, иначе false.
+ */
+bool BatchReader::read() {
+    if (!begin()) {
+        return false;
+    }
+    while (poll() == TransactionStatus::PENDING) {
+    }
+    return _status == TransactionStatus::COMPLETED;
+}
+
+/**
+ * @brief Асинхронный запуск чтения пакета.
+ *
+ * @return true, если чтение запущено, иначе false (в том числе если ни один кадр
+ *         не удалось запустить: состояние пакета — FAILED).
+ */
+bool BatchReader::begin() {
+    if (_count == 0 || isBusy() || !_drive->isInitialized()) {
+        return false;
+    }
+    _first = 0;
+    _failed = 0;
+    _status = TransactionStatus::PENDING;
+    if (!startFrame()) {
+        _status = TransactionStatus::FAILED;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Продвижение асинхронного чтения пакета.
+ *
+ * Продвигает шину, повторяет постановку в очередь кадра, для которого очередь была
+ * заполнена, и по завершении текущего кадра раскладывает его значения и ставит в очередь
+ * следующий кадр.
+ *
+ * @return Состояние чтения пакета.
+ */
+TransactionStatus BatchReader::poll() {
+    if (_status != TransactionStatus::PENDING) {
+        return _status;
+    }
+    _drive->bus()->poll();
+    if (_waiting) {
+        submitFrame();
+        return _status;
+    }
+    if (_transaction.status == TransactionStatus::PENDING) {
+        return _status;
+    }
+
+    if (_transaction.status == TransactionStatus::COMPLETED) {
+        scatter();
+    } else {
+        _failed++;
+    }
+    _first = _last;
+    if (!startFrame()) {
+        _status = (_failed == 0) ? TransactionStatus::COMPLETED : TransactionStatus::FAILED;
+    }
+    return _status;
+}
+
+/**
+ * @brief Постановка в очередь кадра, начиная с регистра _first.
+ *
+ * @return true, если кадр поставлен в очередь или ожидает места в ней, false — если кадров больше нет.
+ */
+bool BatchReader::startFrame() {
+    while (_first < _count) {
+        _last = rangeEnd(_first);
+        const uint16_t start = _entries[_first].address;
+        const size_t span = static_cast<size_t>(_entries[_last - 1].address - start) + 1;
+        _transaction.setRead(_drive->slaveAddress(), start, _buffer, span);
+        _drive->attachStats(_transaction);
+        if (submitFrame()) {
+            return true;
+        }
+        // Недопустимый кадр: пропускается
+        _failed++;
+        _first = _last;
+    }
+    return false;
+}
+
+/**
+ * @brief Постановка текущего кадра в очередь шины.
+ *
+ * Заполненная очередь — временное состояние: кадр остаётся ожидающим (_waiting),
+ * и poll() повторяет постановку.
+ *
+ * @return true, если кадр поставлен в очередь или ожидает места в ней, иначе false.
+ */
+bool BatchReader::submitFrame() {
+    if (_drive->bus()->submit(_transaction)) {
+        _waiting = false;
+        return true;
+    }
+    _waiting = _transaction.error == TransactionError::QUEUE_FULL;
+    return _waiting;
+}
+
+/**
+ * @brief Раскладка значений прочитанного кадра по переменным.
+ */
+void BatchReader::scatter() {
+    const uint16_t start = _entries[_first].address;
+    for (size_t i = _first; i < _last; i++) {
+        *_entries[i].target = _buffer[_entries[i].address - start];
+    }
+}
+
+#endif // HS321_ENABLE_BATCH_READER
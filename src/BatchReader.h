@@ -0,0 +1,164 @@
+#pragma once
+
+/** @file BatchReader.h
+ * @brief Пакетное чтение разрозненных регистров частотника HS321 минимальным количеством кадров 0x03.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "HS321.h"
+
+#if !HS321_ENABLE_BATCH_READER
+#error "Пакетное чтение отключено (HS321_ENABLE_BATCH_READER = 0)"
+#endif
+
+/**
+ * @class BatchReader
+ * @brief Пакетное чтение набора параметров одного частотника.
+ *
+ * Вызывающий код регистрирует пары (группа, номер) и указатели на переменные для значений.
+ * Адреса хранятся отсортированными; при чтении соседние адреса объединяются в диапазоны
+ * (с пропуском не более maxGap регистров между ними, но не длиннее HS321_BATCH_MAX_SPAN),
+ * каждый диапазон читается одним кадром 0x03, а значения раскладываются по переменным.
+ *
+ * @warning Пропущенные регистры внутри диапазона тоже читаются, поэтому maxGap > 0
+ *          допустим только там, где все адреса в промежутках существуют у частотника,
+ *          иначе он ответит исключением 0x02 и весь диапазон не будет прочитан.
+ */
+class BatchReader {
+public:
+    /**
+     * @brief Конструктор класса.
+     * @param drive Частотник, параметры которого читаются.
+     * @param maxGap Максимальное количество пропущенных регистров между объединяемыми адресами.
+     */
+    explicit BatchReader(HS321& drive, uint8_t maxGap = 0);
+
+    /**
+     * @brief Регистрация параметра группы в пакете.
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @param value Указатель на переменную для значения (должна существовать, пока зарегистрирована).
+     * @return true, если параметр добавлен, иначе false (пакет заполнен, выполняется чтение, value == nullptr).
+     */
+    bool add(GroupsParameter group, uint8_t numberGroup, uint16_t* value);
+
+    /**
+     * @brief Регистрация произвольного регистра в пакете.
+     * @param address Полный адрес регистра Modbus.
+     * @param value Указатель на переменную для значения.
+     * @return true, если регистр добавлен, иначе false.
+     */
+    bool addAddress(uint16_t address, uint16_t* value);
+
+    /**
+     * @brief Удаление всех зарегистрированных параметров.
+     */
+    void clear();
+
+    /**
+     * @brief Установка максимального пропуска между объединяемыми адресами.
+     * @param maxGap Количество регистров (0 — объединять только смежные адреса).
+     */
+    void setMaxGap(uint8_t maxGap) { _maxGap = maxGap; }
+
+    /**
+     * @brief Количество зарегистрированных параметров.
+     * @return Количество параметров в пакете.
+     */
+    size_t size() const { return _count; }
+
+    /**
+     * @brief Количество кадров, которыми будет прочитан пакет.
+     * @return Количество кадров 0x03.
+     */
+    size_t frameCount() const;
+
+    /**
+     * @brief Чтение всего пакета с ожиданием завершения.
+     * @return true, если все кадры прочитаны успешно, иначе false.
+     */
+    bool read();
+
+    /**
+     * @brief Асинхронный запуск чтения пакета.
+     *
+     * Кадры ставятся в очередь шины по одному; результат доступен после того,
+     * как poll() вернёт итоговое состояние. Если очередь шины заполнена, кадр ждёт
+     * места в ней и ставится в очередь из poll().
+     *
+     * @return true, если чтение запущено, иначе false (пакет пуст, уже читается или
+     *         ни один кадр не допущен шиной — тогда poll() возвращает FAILED).
+     */
+    bool begin();
+
+    /**
+     * @brief Продвижение асинхронного чтения пакета.
+     * @return PENDING, пока читаются кадры; COMPLETED, если все кадры прочитаны; иначе FAILED.
+     */
+    TransactionStatus poll();
+
+    /**
+     * @brief Проверяет, выполняется ли чтение пакета.
+     * @return true, если чтение не завершено, иначе false.
+     */
+    bool isBusy() const { return _status == TransactionStatus::PENDING; }
+
+    /**
+     * @brief Количество кадров, не прочитанных при последнем чтении пакета.
+     *
+     * Переменные параметров из таких кадров сохраняют прежние значения.
+     *
+     * @return Количество неудачных кадров.
+     */
+    size_t failedFrames() const { return _failed; }
+
+private:
+    /**
+     * @struct Entry
+     * @brief Зарегистрированный регистр и переменная для его значения.
+     */
+    struct Entry {
+        uint16_t address;  ///< Адрес регистра Modbus
+        uint16_t* target;  ///< Переменная для значения
+    };
+
+    HS321* _drive;                            ///< Частотник, параметры которого читаются
+    uint8_t _maxGap;                          ///< Максимальный пропуск между объединяемыми адресами
+    Entry _entries[HS321_BATCH_SIZE];         ///< Зарегистрированные регистры, отсортированные по адресу
+    size_t _count = 0;                        ///< Количество зарегистрированных регистров
+    uint16_t _buffer[HS321_BATCH_MAX_SPAN];   ///< Буфер значений текущего кадра
+    ModbusTransaction _transaction;           ///< Транзакция текущего кадра
+    size_t _first = 0;                        ///< Первый регистр текущего кадра
+    size_t _last = 0;                         ///< Регистр, следующий за последним в текущем кадре
+    size_t _failed = 0;                       ///< Количество неудачных кадров
+    bool _waiting = false;                    ///< Текущий кадр ждёт места в очереди шины
+    TransactionStatus _status = TransactionStatus::IDLE; ///< Состояние чтения пакета
+
+    /**
+     * @brief Определение границы диапазона, начинающегося с указанного регистра.
+     * @param first Индекс первого регистра диапазона.
+     * @return Индекс регистра, следующего за последним в диапазоне.
+     */
+    size_t rangeEnd(size_t first) const;
+
+    /**
+     * @brief Постановка в очередь кадров, начиная с регистра _first.
+     *
+     * Кадры, которые шина отклонила (кроме заполненной очереди), учитываются как неудачные.
+     *
+     * @return true, если кадр поставлен в очередь или ожидает места в ней, false — если кадров больше нет.
+     */
+    bool startFrame();
+
+    /**
+     * @brief Постановка текущего кадра в очередь шины.
+     * @return true, если кадр поставлен в очередь или ожидает места в ней, иначе false.
+     */
+    bool submitFrame();
+
+    /**
+     * @brief Раскладка значений прочитанного кадра по переменным.
+     */
+    void scatter();
+};
@@ -0,0 +1,359 @@
+#include "DriveProfile.h"
+#include "ParameterGroup.h"
+
+/** @file DriveProfile.cpp
+ * @brief Реализация профиля настроек частотника HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+/**
+ * @brief Конструктор класса DriveProfile.
+ *
+ * Изначально профиль пуст.
+ *
+ * @param drive Частотник, с которым работает профиль.
+ */
+DriveProfile::DriveProfile(HS321& drive)
+                                                                :_drive(&drive){
+}
+
+/**
+ * @brief Снятие профиля с частотника.
+ *
+ * Каждая группа F0–FC читается одним кадром; в профиль попадают параметры,
+ * значения которых отличаются от заводских.
+ *
+ * @return true, если все группы прочитаны и все отличия поместились в профиль, иначе false.
+ */
+bool DriveProfile::capture() {
+    clear();
+    uint16_t buffer[largestGroupSize()];
+    bool result = true;
+    for (uint8_t groupId = GROUP_F0; groupId <= GROUP_FC; groupId++) {
+        const GroupsParameter group = static_cast<GroupsParameter>(groupId);
+        const uint8_t size = groupSizes[groupId];
+        if (!_drive->readParametersInGroups(group, 0, buffer, size)) {
+            result = false;
+            continue;
+        }
+        for (uint8_t number = 0; number < size; number++) {
+            const uint16_t address = HS321::buildParameterAddress(group, number);
+            uint16_t factory;
+            if (!accepts(address, factory) || buffer[number] == factory) {
+                continue;
+            }
+            if (_count >= HS321_PROFILE_SIZE) {
+                result = false; // Профиль заполнен
+                continue;
+            }
+            _entries[_count].address = address;
+            _entries[_count].value = buffer[number];
+            _count++;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Запись профиля в частотник.
+ *
+ * Сначала записываются все кадры, кроме параметров связи, затем — параметры связи:
+ * после них частотник может перестать отвечать на текущих настройках шины.
+ *
+ * @param maxGap Максимальное количество промежуточных параметров.
+ * @return true, если все кадры записаны успешно, иначе false.
+ */
+bool DriveProfile::apply(const uint8_t maxGap) const {
+    bool result = true;
+    for (uint8_t pass = 0; pass < 2; pass++) {
+        const bool communication = pass == 1;
+        size_t first = 0;
+        while (first < _count) {
+            const size_t end = frameEnd(first, maxGap);
+            if (isCommunication(_entries[first].address) == communication && !writeFrame(first, end)) {
+                result = false;
+            }
+            first = end;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Запись одного кадра профиля.
+ *
+ * Значения кадра собираются в буфер: параметры профиля — из профиля,
+ * промежуточные параметры — заводские значения.
+ *
+ * @param first Индекс первого параметра кадра.
+ * @param end Индекс параметра, следующего за последним в кадре.
+ * @return true, если кадр записан успешно, иначе false.
+ */
+bool DriveProfile::writeFrame(const size_t first, const size_t end) const {
+    uint16_t buffer[largestGroupSize()];
+    const uint16_t start = _entries[first].address;
+    const uint8_t span = static_cast<uint8_t>(_entries[end - 1].address - start + 1);
+    size_t next = first;
+    for (uint8_t i = 0; i < span; i++) {
+        if (next < end && _entries[next].address == start + i) {
+            buffer[i] = _entries[next].value;
+            next++;
+        } else {
+            factoryValue(start + i, buffer[i]);
+        }
+    }
+    const GroupsParameter group = static_cast<GroupsParameter>(start >> 8);
+    return _drive->writeParametersInGroups(group, static_cast<uint8_t>(start & 0xFF), buffer, span);
+}
+
+/**
+ * @brief Количество кадров, которыми будет записан профиль.
+ *
+ * @param maxGap Максимальное количество промежуточных параметров.
+ * @return Количество кадров 0x10.
+ */
+size_t DriveProfile::frameCount(const uint8_t maxGap) const {
+    size_t frames = 0;
+    for (size_t first = 0; first < _count; first = frameEnd(first, maxGap)) {
+        frames++;
+    }
+    return frames;
+}
+
+/**
+ * @brief Определение границы кадра записи.
+ *
+ * Кадр не выходит за пределы группы, не длиннее ModbusBus::MAX_WRITE_REGISTERS и не проходит
+ * через адреса, которые не могут входить в профиль. Параметр связи всегда записывается
+ * отдельным кадром.
+ *
+ * @param first Индекс первого параметра кадра.
+ * @param maxGap Максимальное количество промежуточных параметров.
+ * @return Индекс параметра, следующего за последним в кадре.
+ */
+size_t DriveProfile::frameEnd(const size_t first, const uint8_t maxGap) const {
+    const uint16_t start = _entries[first].address;
+    if (isCommunication(start)) {
+        return first + 1;
+    }
+    size_t end = first + 1;
+    while (end < _count) {
+        const uint16_t previous = _entries[end - 1].address;
+        const uint16_t next = _entries[end].address;
+        if ((next >> 8) != (previous >> 8) || next - previous - 1 > maxGap
+            || static_cast<size_t>(next - start) >= ModbusBus::MAX_WRITE_REGISTERS) {
+            break;
+        }
+        bool bridged = true;
+        for (uint16_t address = previous + 1; address <= next && bridged; address++) {
+            uint16_t factory;
+            bridged = factoryValue(address, factory) && !isCommunication(address);
+        }
+        if (!bridged) {
+            break;
+        }
+        end++;
+    }
+    return end;
+}
+
+/**
+ * @brief Установка значения параметра в профиле.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @param value Значение регистра.
+ * @return true, если значение установлено, иначе false.
+ */
+bool DriveProfile::set(const GroupsParameter group, const uint8_t numberGroup, const uint16_t value) {
+    const uint16_t address = HS321::buildParameterAddress(group, numberGroup);
+    uint16_t factory;
+    if (!accepts(address, factory)) {
+        return false;
+    }
+    size_t position = 0;
+    while (position < _count && _entries[position].address < address) {
+        position++;
+    }
+    if (position < _count && _entries[position].address == address) {
+        _entries[position].value = value;
+        return true;
+    }
+    if (_count >= HS321_PROFILE_SIZE) {
+        return false;
+    }
+    for (size_t i = _count; i > position; i--) {
+        _entries[i] = _entries[i - 1];
+    }
+    _entries[position].address = address;
+    _entries[position].value = value;
+    _count++;
+    return true;
+}
+
+/**
+ * @brief Параметр профиля по порядковому номеру.
+ *
+ * @param index Порядковый номер параметра.
+ * @param address Адрес параметра.
+ * @param value Значение регистра.
+ * @return true, если index в пределах профиля, иначе false.
+ */
+bool DriveProfile::entry(const size_t index, uint16_t& address, uint16_t& value) const {
+    if (index >= _count) {
+        return false;
+    }
+    address = _entries[index].address;
+    value = _entries[index].value;
+    return true;
+}
+
+/**
+ * @brief Размер профиля в двоичном виде.
+ *
+ * @return Количество байт: заголовок, по 3 байта на участок и по 2 байта на значение.
+ */
+size_t DriveProfile::serializedSize() const {
+    size_t runs = 0;
+    for (size_t i = 0; i < _count; i++) {
+        if (i == 0 || _entries[i].address != _entries[i - 1].address + 1) {
+            runs++;
+        }
+    }
+    return 2 + runs * 3 + _count * 2;
+}
+
+/**
+ * @brief Сериализация профиля.
+ *
+ * @param data Буфер для двоичного профиля.
+ * @param capacity Размер буфера.
+ * @return Количество записанных байт или 0, если буфер мал.
+ */
+size_t DriveProfile::serialize(uint8_t* data, const size_t capacity) const {
+    if (data == nullptr || capacity < serializedSize()) {
+        return 0;
+    }
+    size_t length = 2;
+    uint8_t runs = 0;
+    size_t first = 0;
+    while (first < _count) {
+        size_t end = first + 1;
+        while (end < _count && _entries[end].address == _entries[end - 1].address + 1 && end - first < 0xFF) {
+            end++;
+        }
+        if (runs == 0xFF) {
+            return 0; // Количество участков не помещается в заголовок
+        }
+        data[length++] = static_cast<uint8_t>(_entries[first].address >> 8);
+        data[length++] = static_cast<uint8_t>(_entries[first].address & 0xFF);
+        data[length++] = static_cast<uint8_t>(end - first);
+        for (size_t i = first; i < end; i++) {
+            data[length++] = static_cast<uint8_t>(_entries[i].value >> 8);
+            data[length++] = static_cast<uint8_t>(_entries[i].value & 0xFF);
+        }
+        runs++;
+        first = end;
+    }
+    data[0] = FORMAT;
+    data[1] = runs;
+    return length;
+}
+
+/**
+ * @brief Загрузка профиля из двоичного вида.
+ *
+ * @param data Двоичный профиль.
+ * @param length Длина двоичного профиля.
+ * @return true, если профиль загружен, иначе false.
+ */
+bool DriveProfile::deserialize(const uint8_t* data, const size_t length) {
+    clear();
+    if (data == nullptr || length < 2 || data[0] != FORMAT) {
+        return false;
+    }
+    size_t position = 2;
+    for (uint8_t run = 0; run < data[1]; run++) {
+        if (position + 3 > length) {
+            clear();
+            return false;
+        }
+        const uint16_t start = static_cast<uint16_t>((data[position] << 8) | data[position + 1]);
+        const uint8_t n = data[position + 2];
+        position += 3;
+        if (n == 0 || position + n * 2 > length) {
+            clear();
+            return false;
+        }
+        for (uint8_t i = 0; i < n; i++) {
+            const uint16_t address = start + i;
+            uint16_t factory;
+            if (_count >= HS321_PROFILE_SIZE || !accepts(address, factory)
+                || (_count > 0 && address <= _entries[_count - 1].address)) {
+                clear();
+                return false;
+            }
+            _entries[_count].address = address;
+            _entries[_count].value = static_cast<uint16_t>((data[position] << 8) | data[position + 1]);
+            _count++;
+            position += 2;
+        }
+    }
+    if (position != length) {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Заводское значение регистра параметра, который может входить в профиль.
+ *
+ * В профиль входят числовые параметры групп F0–FC, кроме F0.00.
+ *
+ * @param address Адрес параметра.
+ * @param value Заводское значение регистра.
+ * @return true, если параметр может входить в профиль, иначе false.
+ */
+bool DriveProfile::factoryValue(const uint16_t address, uint16_t& value) {
+    // Мощность задаётся моделью; FP и d не настраиваются
+    if (address == HS321::buildParameterAddress(GROUP_F0, 0) || (address >> 8) > GROUP_FC) {
+        return false;
+    }
+    Parameter param;
+    if (!ParameterGroup::findNumeric(address, param) || param.type == ParameterType::STRING) {
+        return false;
+    }
+    if (param.type == ParameterType::FLOAT) {
+        value = static_cast<uint16_t>(ScaledValue::fromFloat(param.factoryDefault.floatValue, param.decimals).value);
+    } else {
+        value = static_cast<uint16_t>(param.factoryDefault.intValue);
+    }
+    return true;
+}
+
+/**
+ * @brief Проверка, что параметр — параметр связи.
+ *
+ * FC.00 — скорость, FC.01 — формат данных, FC.02 — адрес ведомого.
+ *
+ * @param address Адрес параметра.
+ * @return true, если запись параметра меняет настройки связи, иначе false.
+ */
+bool DriveProfile::isCommunication(const uint16_t address) {
+    return address >= HS321::buildParameterAddress(GROUP_FC, 0) && address <= HS321::buildParameterAddress(GROUP_FC, 2);
+}
+
+/**
+ * @brief Заводское значение параметра, который может входить в этот профиль.
+ *
+ * Параметры связи входят в профиль только после setCommunication(true).
+ *
+ * @param address Адрес параметра.
+ * @param value Заводское значение регистра.
+ * @return true, если параметр может входить в профиль с текущими настройками, иначе false.
+ */
+bool DriveProfile::accepts(const uint16_t address, uint16_t& value) const {
+    return (_communication || !isCommunication(address)) && factoryValue(address, value);
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+/** @file DriveProfile.h
+ * @brief Профиль настроек частотника HS321: отличия параметров F0–FC от заводских значений.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "HS321.h"
+
+/**
+ * @class DriveProfile
+ * @brief Снятие, хранение и загрузка профиля настроек частотника.
+ *
+ * capture() читает каждую группу F0–FC одним кадром 0x03 и сохраняет только параметры,
+ * значения которых отличаются от заводских (factoryDefault в каталоге). apply() записывает
+ * профиль обратно минимальным количеством кадров 0x10: смежные параметры одной группы
+ * объединяются в один кадр (не длиннее ModbusBus::MAX_WRITE_REGISTERS).
+ *
+ * Профиль не содержит резервных и строковых параметров (у них нет числового заводского значения),
+ * параметров мониторинга d и F0.00 (мощность определяется моделью).
+ *
+ * Параметры связи FC.00 (скорость), FC.01 (формат данных) и FC.02 (адрес) по умолчанию
+ * в профиль не входят: их запись обрывает связь на текущих настройках шины. С
+ * setCommunication(true) они снимаются и загружаются, причём apply() записывает их
+ * последними, каждый отдельным кадром.
+ *
+ * Профиль сериализуется в компактный двоичный вид (например, для хранения в EEPROM):
+ * @code
+ * [0]     DriveProfile::FORMAT
+ * [1]     количество участков
+ * участок: адрес (2 байта, старший первым), n (1 байт), n значений по 2 байта (старший первым)
+ * @endcode
+ * Участок — последовательность параметров со смежными адресами.
+ */
+class DriveProfile {
+public:
+    /**
+     * @var FORMAT
+     * @brief Версия двоичного формата профиля.
+     */
+    static constexpr uint8_t FORMAT = 1;
+
+    /**
+     * @brief Конструктор класса.
+     * @param drive Частотник, с которым работает профиль.
+     */
+    explicit DriveProfile(HS321& drive);
+
+    /**
+     * @brief Снятие профиля с частотника.
+     *
+     * Прежнее содержимое профиля удаляется.
+     *
+     * @return true, если все группы прочитаны и все отличия поместились в профиль, иначе false.
+     */
+    bool capture();
+
+    /**
+     * @brief Запись профиля в частотник.
+     *
+     * Параметры одной группы, разделённые не более чем maxGap отсутствующими в профиле
+     * параметрами, записываются одним кадром; промежуточные параметры получают заводские
+     * значения (именно их профиль и подразумевает). Через резервные адреса кадры не объединяются.
+     *
+     * @param maxGap Максимальное количество промежуточных параметров.
+     * @return true, если все кадры записаны успешно, иначе false.
+     */
+    bool apply(uint8_t maxGap = 0) const;
+
+    /**
+     * @brief Включение параметров связи FC.00–FC.02 в профиль.
+     *
+     * Действует на последующие capture(), set() и deserialize(). После записи параметров
+     * связи частотник может отвечать уже на новых скорости, формате или адресе: шину
+     * и HS321 нужно перенастроить.
+     *
+     * @param include true — параметры связи входят в профиль, false — нет (по умолчанию).
+     */
+    void setCommunication(bool include) { _communication = include; }
+
+    /**
+     * @brief Количество кадров, которыми будет записан профиль.
+     * @param maxGap Максимальное количество промежуточных параметров (см. apply()).
+     * @return Количество кадров 0x10.
+     */
+    size_t frameCount(uint8_t maxGap = 0) const;
+
+    /**
+     * @brief Установка значения параметра в профиле.
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @param value Значение регистра.
+     * @return true, если значение установлено, иначе false (параметр не входит в профили, профиль заполнен).
+     */
+    bool set(GroupsParameter group, uint8_t numberGroup, uint16_t value);
+
+    /**
+     * @brief Удаление всех параметров профиля.
+     */
+    void clear() { _count = 0; }
+
+    /**
+     * @brief Количество параметров в профиле.
+     * @return Количество параметров.
+     */
+    size_t size() const { return _count; }
+
+    /**
+     * @brief Параметр профиля по порядковому номеру.
+     * @param index Порядковый номер (0..size()-1), параметры упорядочены по адресу.
+     * @param address Адрес параметра.
+     * @param value Значение регистра.
+     * @return true, если index в пределах профиля, иначе false.
+     */
+    bool entry(size_t index, uint16_t& address, uint16_t& value) const;
+
+    /**
+     * @brief Размер профиля в двоичном виде.
+     * @return Количество байт, которое запишет serialize().
+     */
+    size_t serializedSize() const;
+
+    /**
+     * @brief Сериализация профиля.
+     * @param data Буфер для двоичного профиля.
+     * @param capacity Размер буфера.
+     * @return Количество записанных байт или 0, если буфер мал.
+     */
+    size_t serialize(uint8_t* data, size_t capacity) const;
+
+    /**
+     * @brief Загрузка профиля из двоичного вида.
+     *
+     * Проверяет версию формата, порядок адресов и то, что каждый параметр может входить в профиль.
+     *
+     * @param data Двоичный профиль.
+     * @param length Длина двоичного профиля.
+     * @return true, если профиль загружен, иначе false (профиль остаётся пустым).
+     */
+    bool deserialize(const uint8_t* data, size_t length);
+
+private:
+    /**
+     * @struct Entry
+     * @brief Параметр профиля.
+     */
+    struct Entry {
+        uint16_t address;  ///< Адрес параметра
+        uint16_t value;    ///< Значение регистра
+    };
+
+    HS321* _drive;                        ///< Частотник, с которым работает профиль
+    Entry _entries[HS321_PROFILE_SIZE];   ///< Параметры, отсортированные по адресу
+    size_t _count = 0;                    ///< Количество параметров
+    bool _communication = false;          ///< Параметры связи FC.00–FC.02 входят в профиль
+
+    /**
+     * @brief Заводское значение регистра параметра, который может входить в профиль.
+     * @param address Адрес параметра.
+     * @param value Заводское значение регистра.
+     * @return true, если параметр может входить в профиль, иначе false.
+     */
+    static bool factoryValue(uint16_t address, uint16_t& value);
+
+    /**
+     * @brief Проверка, что параметр — параметр связи (FC.00–FC.02).
+     * @param address Адрес параметра.
+     * @return true, если запись параметра меняет настройки связи, иначе false.
+     */
+    static bool isCommunication(uint16_t address);
+
+    /**
+     * @brief Заводское значение параметра, который может входить в этот профиль.
+     * @param address Адрес параметра.
+     * @param value Заводское значение регистра.
+     * @return true, если параметр может входить в профиль с текущими настройками, иначе false.
+     */
+    bool accepts(uint16_t address, uint16_t& value) const;
+
+    /**
+     * @brief Запись одного кадра профиля.
+     * @param first Индекс первого параметра кадра.
+     * @param end Индекс параметра, следующего за последним в кадре.
+     * @return true, если кадр записан успешно, иначе false.
+     */
+    bool writeFrame(size_t first, size_t end) const;
+
+    /**
+     * @brief Определение границы кадра записи, начинающегося с указанного параметра.
+     * @param first Индекс первого параметра кадра.
+     * @param maxGap Максимальное количество промежуточных параметров.
+     * @return Индекс параметра, следующего за последним в кадре.
+     */
+    size_t frameEnd(size_t first, uint8_t maxGap) const;
+};
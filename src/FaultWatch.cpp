@@ -0,0 +1,193 @@
+#include "FaultWatch.h"
+
+/** @file FaultWatch.cpp
+ * @brief Реализация отслеживания аварий частотника HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+/**
+ * @brief Конструктор класса FaultWatch.
+ *
+ * @param drive Частотник, аварии которого отслеживаются.
+ * @param parameters Каталог ошибок для описания событий.
+ * @param interval Период опроса регистров аварии и состояния (мс).
+ */
+FaultWatch::FaultWatch(HS321& drive, const ParametersHS321& parameters, const unsigned long interval)
+                                                                :_drive(&drive),
+                                                                _parameters(&parameters),
+                                                                _interval(interval){
+}
+
+/**
+ * @brief Продвижение опроса.
+ *
+ * Продвигает шину; по завершении кадра обрабатывает его и ставит в очередь следующий кадр
+ * цикла, а в начале нового периода запускает цикл чтением кода неисправности.
+ */
+void FaultWatch::poll() {
+    _drive->bus()->poll();
+
+    if (_transaction.status == TransactionStatus::PENDING) {
+        return;
+    }
+    if (_phase != Phase::IDLE) {
+        advance(_transaction.status == TransactionStatus::COMPLETED);
+    }
+    if (_phase != Phase::IDLE) {
+        return;
+    }
+    const unsigned long now = millis();
+    // Если очередь шины заполнена, цикл запускается при следующем poll()
+    if ((!_started || now - _cycleStart >= _interval) && start(Phase::FAULT)) {
+        _cycleStart = now;
+        _started = true;
+    }
+}
+
+/**
+ * @brief Постановка кадра в очередь шины.
+ *
+ * Снимок читается прямо в самое новое событие буфера.
+ *
+ * @param phase Кадр.
+ * @return true, если кадр поставлен в очередь, иначе false (_phase становится IDLE).
+ */
+bool FaultWatch::start(const Phase phase) {
+    const uint8_t slave = _drive->slaveAddress();
+    switch (phase) {
+        case Phase::FAULT:
+            _transaction.setRead(slave, 0x8000, &_value, 1);
+            _transaction.priority = TransactionPriority::NORMAL;
+            break;
+        case Phase::STATE:
+            _transaction.setRead(slave, 0x3000, &_value, 1);
+            _transaction.priority = TransactionPriority::NORMAL;
+            break;
+        case Phase::SNAPSHOT:
+            _transaction.setRead(slave, HS321::buildParameterAddress(GROUP_d, 0), _events[_head].monitor, SIGNAL_COUNT);
+            _transaction.priority = TransactionPriority::URGENT;
+            break;
+        default:
+            _phase = Phase::IDLE;
+            return false;
+    }
+    _drive->attachStats(_transaction);
+    _phase = _drive->bus()->submit(_transaction) ? phase : Phase::IDLE;
+    return _phase != Phase::IDLE;
+}
+
+/**
+ * @brief Обработка завершённого кадра и переход к следующему.
+ *
+ * После кадра кода неисправности следует снимок (если обнаружена авария) и кадр
+ * состояния; после кадра состояния цикл завершается. Неудачный кадр кода
+ * неисправности не меняет известный код, чтобы сбой связи не породил ложное событие.
+ *
+ * @param completed Кадр прочитан успешно.
+ */
+void FaultWatch::advance(const bool completed) {
+    if (!completed) {
+        _failedFrames++;
+    }
+    switch (_phase) {
+        case Phase::FAULT:
+            if (completed) {
+                const uint16_t previous = _faultCode;
+                _faultCode = _value;
+                if (_faultCode != 0 && _faultCode != previous) {
+                    trip(_faultCode);
+                    if (_phase == Phase::SNAPSHOT) {
+                        return;
+                    }
+                }
+            }
+            start(Phase::STATE);
+            break;
+        case Phase::SNAPSHOT:
+            latch(completed);
+            start(Phase::STATE);
+            break;
+        case Phase::STATE:
+            if (completed) {
+                _runningState = _value;
+            }
+            _phase = Phase::IDLE;
+            break;
+        default:
+            _phase = Phase::IDLE;
+            break;
+    }
+}
+
+/**
+ * @brief Создание события аварии и запуск чтения снимка.
+ *
+ * Занимает следующую ячейку кольцевого буфера, вытесняя самое старое событие.
+ * Если снимок не удалось поставить в очередь, событие фиксируется без него.
+ *
+ * @param faultCode Новый код неисправности.
+ */
+void FaultWatch::trip(const uint16_t faultCode) {
+    _head = static_cast<uint8_t>((_head + 1) % HS321_FAULT_EVENTS);
+    if (_count < HS321_FAULT_EVENTS) {
+        _count++;
+    }
+    _totalEvents++;
+    FaultEvent& event = _events[_head];
+    event.faultCode = faultCode;
+    event.runningState = _runningState;
+    event.detectedAt = millis();
+    event.capturedAt = 0;
+    event.snapshotValid = false;
+    event.described = false;
+    if (!start(Phase::SNAPSHOT)) {
+        latch(false);
+    }
+}
+
+/**
+ * @brief Завершение события: описание ошибки и вызов callback.
+ *
+ * @param captured Снимок прочитан.
+ */
+void FaultWatch::latch(const bool captured) {
+    FaultEvent& event = _events[_head];
+    event.capturedAt = millis();
+    event.snapshotValid = captured;
+    event.described = _parameters->getFaultInfo(event.faultCode, event.info);
+    if (_callback != nullptr) {
+        _callback(event, _callbackContext);
+    }
+}
+
+/**
+ * @brief Событие из буфера.
+ *
+ * @param index Номер события (0 — самое новое).
+ * @return Указатель на событие или nullptr.
+ */
+const FaultEvent* FaultWatch::event(const uint8_t index) const {
+    if (index >= _count) {
+        return nullptr;
+    }
+    return &_events[(_head + HS321_FAULT_EVENTS - index) % HS321_FAULT_EVENTS];
+}
+
+/**
+ * @brief Удаление всех событий из буфера.
+ */
+void FaultWatch::clear() {
+    _count = (_phase == Phase::SNAPSHOT) ? 1 : 0;
+}
+
+/**
+ * @brief Установка функции обратного вызова, вызываемой после фиксации события.
+ *
+ * @param callback Функция обратного вызова (nullptr — отключить).
+ * @param context Пользовательский указатель, передаваемый в callback.
+ */
+void FaultWatch::onFault(const FaultCallback callback, void* context) {
+    _callback = callback;
+    _callbackContext = context;
+}
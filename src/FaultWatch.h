@@ -0,0 +1,183 @@
+#pragma once
+
+/** @file FaultWatch.h
+ * @brief Отслеживание аварий частотника HS321 со снимком группы d в момент срабатывания.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "HS321.h"
+#include "ParametersHS321.h"
+
+/**
+ * @struct FaultEvent
+ * @brief Событие аварии: код, описание и снимок параметров мониторинга.
+ */
+struct FaultEvent {
+    uint16_t faultCode = 0;                          ///< Код неисправности из регистра 0x8000
+    uint16_t runningState = 0;                       ///< Состояние работы 0x3000, прочитанное перед аварией
+    unsigned long detectedAt = 0;                    ///< Время обнаружения аварии (мс, millis())
+    unsigned long capturedAt = 0;                    ///< Время получения снимка группы d (мс, millis())
+    uint16_t monitor[groupSizes[GROUP_COUNT - 1]];   ///< Снимок d-00..d-19
+    bool snapshotValid = false;                      ///< Снимок прочитан (иначе monitor не заполнен)
+    bool described = false;                          ///< Код найден в каталоге ошибок (info заполнена)
+    FaultInfo info = { nullptr, nullptr, nullptr };  ///< Описание ошибки (строки во Flash)
+};
+
+/**
+ * @typedef FaultCallback
+ * @brief Функция обратного вызова, вызываемая после фиксации события аварии.
+ *
+ * @param event Событие (ссылка действительна до следующего вызова FaultWatch::poll()).
+ * @param context Пользовательский указатель, переданный в FaultWatch::onFault().
+ */
+typedef void (*FaultCallback)(const FaultEvent& event, void* context);
+
+/**
+ * @class FaultWatch
+ * @brief Частый опрос регистров аварии и состояния с фиксацией снимка группы d при аварии.
+ *
+ * В каждом цикле опроса читаются два регистра — код неисправности 0x8000 и состояние
+ * работы 0x3000 — по одному кадру на регистр, поэтому частый опрос почти не нагружает
+ * шину. Когда код неисправности становится ненулевым или меняется на другой, сразу,
+ * до чтения состояния, ставится кадр чтения всей группы d (одним кадром 0x03, с
+ * приоритетом URGENT, чтобы опередить остальной опрос шины). Снимок вместе с описанием
+ * ошибки из ParametersHS321::getFaultInfo() запоминается в кольцевом буфере событий.
+ *
+ * Авария, активная в момент первого опроса, также фиксируется как событие.
+ */
+class FaultWatch {
+public:
+    /**
+     * @var SIGNAL_COUNT
+     * @brief Количество параметров в группе мониторинга d.
+     */
+    static constexpr uint8_t SIGNAL_COUNT = groupSizes[GROUP_COUNT - 1];
+
+    /**
+     * @brief Конструктор класса.
+     * @param drive Частотник, аварии которого отслеживаются.
+     * @param parameters Каталог ошибок для описания событий.
+     * @param interval Период опроса регистров аварии и состояния (мс, 0 — при каждом poll()).
+     */
+    FaultWatch(HS321& drive, const ParametersHS321& parameters, unsigned long interval = 10);
+
+    /**
+     * @brief Установка периода опроса регистров аварии и состояния.
+     * @param interval Период (мс, 0 — при каждом poll()).
+     */
+    void setInterval(unsigned long interval) { _interval = interval; }
+
+    /**
+     * @brief Продвижение опроса.
+     *
+     * Должен вызываться из loop() как можно чаще. Никогда не ожидает ответа.
+     */
+    void poll();
+
+    /**
+     * @brief Количество хранимых событий.
+     * @return Количество событий (не более HS321_FAULT_EVENTS).
+     */
+    uint8_t size() const { return _count; }
+
+    /**
+     * @brief Событие из буфера.
+     * @param index Номер события (0 — самое новое).
+     * @return Указатель на событие или nullptr, если index >= size().
+     */
+    const FaultEvent* event(uint8_t index) const;
+
+    /**
+     * @brief Общее количество зафиксированных событий, включая вытесненные из буфера.
+     * @return Количество событий.
+     */
+    unsigned long totalEvents() const { return _totalEvents; }
+
+    /**
+     * @brief Удаление всех событий из буфера.
+     *
+     * Событие, снимок которого ещё читается, сохраняется.
+     */
+    void clear();
+
+    /**
+     * @brief Последний прочитанный код неисправности.
+     * @return Код из регистра 0x8000 (0 — аварии нет).
+     */
+    uint16_t faultCode() const { return _faultCode; }
+
+    /**
+     * @brief Последнее прочитанное состояние работы.
+     * @return Значение регистра 0x3000.
+     */
+    uint16_t runningState() const { return _runningState; }
+
+    /**
+     * @brief Количество кадров, завершившихся ошибкой.
+     * @return Количество неудачных кадров.
+     */
+    unsigned long failedFrames() const { return _failedFrames; }
+
+    /**
+     * @brief Установка функции обратного вызова, вызываемой после фиксации события.
+     * @param callback Функция обратного вызова (nullptr — отключить).
+     * @param context Пользовательский указатель, передаваемый в callback.
+     */
+    void onFault(FaultCallback callback, void* context = nullptr);
+
+private:
+    /**
+     * @enum Phase
+     * @brief Кадр, выполняемый в текущем цикле опроса.
+     */
+    enum class Phase : uint8_t {
+        IDLE,       ///< Ожидание следующего цикла
+        FAULT,      ///< Чтение кода неисправности 0x8000
+        SNAPSHOT,   ///< Чтение группы d после обнаружения аварии
+        STATE       ///< Чтение состояния работы 0x3000
+    };
+
+    HS321* _drive;                             ///< Частотник, аварии которого отслеживаются
+    const ParametersHS321* _parameters;        ///< Каталог ошибок
+    unsigned long _interval;                   ///< Период опроса (мс)
+    unsigned long _cycleStart = 0;             ///< Время начала текущего цикла (мс)
+    bool _started = false;                     ///< Выполнен хотя бы один цикл
+    Phase _phase = Phase::IDLE;                ///< Текущий кадр
+    ModbusTransaction _transaction;            ///< Транзакция текущего кадра
+    uint16_t _value = 0;                       ///< Буфер кадров чтения одного регистра
+    uint16_t _faultCode = 0;                   ///< Последний прочитанный код неисправности
+    uint16_t _runningState = 0;                ///< Последнее прочитанное состояние работы
+    FaultEvent _events[HS321_FAULT_EVENTS];    ///< Кольцевой буфер событий
+    uint8_t _head = 0;                         ///< Индекс самого нового события
+    uint8_t _count = 0;                        ///< Количество хранимых событий
+    unsigned long _totalEvents = 0;            ///< Общее количество событий
+    unsigned long _failedFrames = 0;           ///< Количество неудачных кадров
+    FaultCallback _callback = nullptr;         ///< Функция обратного вызова
+    void* _callbackContext = nullptr;          ///< Пользовательский указатель для callback
+
+    /**
+     * @brief Постановка кадра в очередь шины.
+     * @param phase Кадр.
+     * @return true, если кадр поставлен в очередь, иначе false.
+     */
+    bool start(Phase phase);
+
+    /**
+     * @brief Обработка завершённого кадра и переход к следующему.
+     * @param completed Кадр прочитан успешно.
+     */
+    void advance(bool completed);
+
+    /**
+     * @brief Создание события аварии и запуск чтения снимка.
+     * @param faultCode Новый код неисправности.
+     */
+    void trip(uint16_t faultCode);
+
+    /**
+     * @brief Завершение события: описание ошибки и вызов callback.
+     * @param captured Снимок прочитан.
+     */
+    void latch(bool captured);
+};
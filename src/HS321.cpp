@@ -1,4 +1,5 @@
-#include "../include/HS321.h"
+#include "HS321.h"
+#include "ParameterGroup.h"
 
 /** @file HS321.cpp
  * @brief Реализация методов класса HS321, предоставляющего интерфейс API для взаимодействия с частотником HS321.
@@ -7,8 +8,6 @@
  */
 
 //#define DEBUG
-//#define DEBUG_receiveData
-//#define DEBUG_sendData
 
 /**
  * @brief Конструктор класса HS321.
@@ -16,74 +15,29 @@
  * Инициализирует объект для взаимодействия с частотным преобразователем по протоколу Modbus RTU.
  *
  * @param slaveAddress Адрес устройства Modbus (частотника) в сети.
- * @param serialPort Указатель на объект HardwareSerial, используемый для связи с частотником.
- * @param serialDebug Указатель на объект HardwareSerial для вывода отладочной информации (может быть nullptr).
- * @param baud Скорость передачи данных (например, 9600, 19200, 115200).
- * @param transmitterModeContact Номер цифрового пина, управляющего направлением передачи RS485 (DE/RE).
+ * @param bus Шина Modbus, к которой подключён частотник.
  */
-HS321::HS321(const uint8_t slaveAddress, HardwareSerial& serialPort, HardwareSerial& serialDebug, const unsigned long baud, const uint8_t transmitterModeContact)
-                                                                :_slaveAddress(slaveAddress),
-                                                                _serialPort(serialPort),
-                                                                _serialDebug(serialDebug),
-                                                                _baud(baud),
-                                                                _transmitterModeContact(transmitterModeContact),
-                                                                _totalTimeout(0),
-                                                                _interCharTimeout(0){
+HS321::HS321(const uint8_t slaveAddress, ModbusBus& bus)
+                                                                :_bus(&bus),
+                                                                _slaveAddress(slaveAddress){
 }
 
 /**
- * @brief Инициализация объекта и настройка аппаратных параметров.
+ * @brief Инициализация объекта.
  *
- * Настраивает последовательный порт, пин управления RS485 и тайм-ауты для корректной работы с протоколом Modbus.
- * После успешной инициализации устанавливает флаг _initialized = true.
+ * Инициализирует общую шину, если она ещё не инициализирована другим частотником.
  */
 void HS321::begin() {
-    // Проверка указателей
-    if (_serialPort == nullptr) {
-        if (_serialDebug != nullptr) {
-            _serialDebug->println("Ошибка: _serialPort не должен быть nullptr");
-        }
-        _initialized = false;
-        return;
-    }
-
-    if (_serialDebug == nullptr) {
-        // Отладочный порт может быть nullptr — это допустимо
-        // Можно работать без отладки
-    } else {
-        _serialDebug->begin(_baud, SERIAL_8N1);
-    }
-
-    // Инициализация порта, SERIAL_8N1 — 8 бит данных, без паритета, 1 стоп-бит по умолчанию в библиотеке Arduino
-    _serialPort->begin(_baud);
-
-    // Настройка пина режима RS485, управляющего направлением передачи данных (DE/RE) модуля RS485 на микросхеме MAX485
-    pinMode(_transmitterModeContact, OUTPUT);
-    // По умолчанию — приём (переводим модуль в режим приёма данных)
-    digitalWrite(_transmitterModeContact, RS485Receive);
-
-    // Вычисление тайм-аутов
-    // Тайм-аут между кадрами MODBUS 2000 микросекунд (по умолчанию) 2 секунды
-    _totalTimeout = static_cast<unsigned long>(2000);
-    // Тайм-аут между байтами кадра MODBUS 3.5 символов
-    // (1.0 / baud) это скорость передачи данных
-    // 10 это количество бит в символе в кадре MODBUS
-    // 1000000 это перевод в микросекунды
-    _interCharTimeout = static_cast<unsigned long>(3.5 * 10 * 1000000 / _baud);
-
-    // Установка флага инициализации и вывод отладочной информации
-    _initialized = true;
-
-    if (_serialDebug) {
-        _serialDebug->println("HS321: Инициализация завершена");
+    if (!_bus->isInitialized()) {
+        _bus->begin();
     }
 }
 
 /**
  * @brief Чтение одного или нескольких регистров Modbus.
  *
- * Отправляет запрос на чтение заданного количества регистров с указанного адреса.
- * Проверяет целостность ответа (адрес, функция, CRC).
+ * Ставит запрос на чтение заданного количества регистров с указанного адреса в очередь шины
+ * и ожидает завершения транзакции. Целостность ответа (адрес, функция, CRC) проверяет шина.
  *
  * @param slaveAddress Адрес ведомого устройства Modbus.
  * @param startAddress Начальный адрес регистра для чтения.
@@ -95,145 +49,15 @@ bool HS321::readParameters(const uint8_t slaveAddress,
                             const uint16_t startAddress,
                             uint16_t* arrayValues,
                             const size_t numberRegisters) const {
-#ifdef DEBUG
-    _serialDebug->println("START readParameters !!!");
-#endif
-    // Проверки входных данных и корректности указателя на массив
-    if (arrayValues == nullptr || numberRegisters == 0 ) {
-        return false;
-    }
-
-    // Проверка на максимальное количество регистров (Modbus ограничение)
-    if (numberRegisters > 125) {
-        return false; // Modbus протокол ограничивает чтение 125 регистрами
-    }
-
-    uint8_t request[8];
-    request[0] = slaveAddress;                                  // Адрес устройства
-    request[1] = READ;                                          // Код функции для чтения
-    request[2] = static_cast<uint8_t>(startAddress >> 8);       // Высокий байт адреса
-    request[3] = static_cast<uint8_t>(startAddress & 0xFF);     // Низкий байт адреса
-    request[4] = static_cast<uint8_t>(numberRegisters >> 8);    // Число параметров читаемых (по умолчанию 1)
-    request[5] = static_cast<uint8_t>(numberRegisters & 0xFF);  // Число параметров читаемых (по умолчанию 1)
-
-    // Вычисление и добавление CRC
-    const uint16_t crc = calculateCRC(request, 6);
-    request[6] = static_cast<uint8_t>(crc & 0xFF);          // Низкий байт CRC
-    request[7] = static_cast<uint8_t>((crc >> 8) & 0xFF);   // Высокий байт CRC
-
-#ifdef DEBUG
-    _serialDebug->print("READ Request \"Запрос\": ");
-    for (byte i = 0; i < sizeof(request); i++) {
-        if (request[i] < 0x10) _serialDebug->print("0");
-        _serialDebug->print(request[i], HEX);
-        _serialDebug->print(" ");
-    }
-    _serialDebug->println();
-#endif
-
-    // Отправка запроса
-    sendData(request, sizeof(request));
-
-    // Расчет размера ответа
-    // Ответ: [адрес][функция][байт данных][данные...][CRC]
-    // байт данных = количество байт данных = numberRegisters * 2
-    const size_t responseSize = 5 + (numberRegisters * 2); // 3 заголовка + данные + 2 CRC
-    uint8_t response[responseSize]; // AVR поддерживает VLA (Variable Length Arrays)
-
-    // Получение ответа
-    if (!receiveData(response, responseSize)) {
-#ifdef DEBUG
-        _serialDebug->println("Ошибка приёма данных");
-        _serialDebug->println("END readParameters !!!");
-        _serialDebug->println();
-#endif
-        return false;
-    }
-
-#ifdef DEBUG
-    _serialDebug->print("READ Response \"Ответ\": ");
-    for (byte i = 0; i < responseSize; i++) {
-        if (response[i] < 0x10) _serialDebug->print("0");
-        _serialDebug->print(response[i], HEX);
-        _serialDebug->print(" ");
-    }
-    _serialDebug->println();
-#endif
-
-    // Базовые проверки ответа
-    if (response[0] != slaveAddress || response[1] != READ) {
-#ifdef DEBUG
-        _serialDebug->print("Неверный адрес или функция. Ожидалось: ");
-        _serialDebug->print(slaveAddress, HEX);
-        _serialDebug->print(" ");
-        _serialDebug->print(READ, HEX);
-        _serialDebug->print(", получено: ");
-        _serialDebug->print(response[0], HEX);
-        _serialDebug->print(" ");
-        _serialDebug->println(response[1], HEX);
-#endif
-        return false;
-    }
-
-    // Проверка количества байт данных
-    const uint8_t byteCount = response[2];
-    if (byteCount != numberRegisters * 2) {
-#ifdef DEBUG
-        _serialDebug->print("Неверное количество байт данных. Ожидалось: ");
-        _serialDebug->print(numberRegisters * 2);
-        _serialDebug->print(", получено: ");
-        _serialDebug->println(byteCount);
-#endif
-        return false;
-    }
-
-    // Проверка CRC ответа (исключая CRC байты)
-    // Сохраняем CRC из ответа (последние 2 байта)
-    const uint16_t receivedCRC = (response[responseSize - 1] << 8) | response[responseSize - 2];
-    // Вычисляем CRC для ответа без CRC байтов
-    const uint16_t calculatedCRC = calculateCRC(response, responseSize - 2);
-
-    // Сравниваем CRC
-    if (receivedCRC != calculatedCRC) {
-#ifdef DEBUG
-        _serialDebug->print("Ошибка CRC. Получено: 0x");
-        _serialDebug->print(receivedCRC, HEX);
-        _serialDebug->print(", рассчитано: 0x");
-        _serialDebug->println(calculatedCRC, HEX);
-#endif
-        return false;
-    }
-
-    // Извлечение значений из ответа
-    if (numberRegisters == 1) {
-        // Для одного регистра
-        arrayValues[0] = (static_cast<uint16_t>(response[3]) << 8) | response[4];
-    } else {
-        // Для нескольких регистров
-        for (size_t i = 0; i < numberRegisters; i++) {
-            const size_t dataIndex = 3 + (i * 2); // 3 - начало данных
-            arrayValues[i] = (static_cast<uint16_t>(response[dataIndex]) << 8) | response[dataIndex + 1];
-        }
-    }
-
-#ifdef DEBUG
-    _serialDebug->print("Прочитано значений: ");
-    for (size_t i = 0; i < numberRegisters; i++) {
-        _serialDebug->print(arrayValues[i]);
-        if (i < numberRegisters - 1) _serialDebug->print(", ");
-    }
-    _serialDebug->println();
-    _serialDebug->println("END readParameters !!!");
-    _serialDebug->println();
-#endif
-
-    return true;
+    ModbusTransaction transaction;
+    transaction.setRead(slaveAddress, startAddress, arrayValues, numberRegisters);
+    return execute(transaction);
 }
 
 /**
  * @brief Запись одного или нескольких регистров Modbus.
  *
- * Отправляет запрос на запись значений в регистры по заданному адресу.
+ * Ставит запрос на запись значений в регистры по заданному адресу в очередь шины и ожидает ответа.
  * Поддерживает функции Modbus 0x06 (один регистр) и 0x10 (диапазон регистров).
  *
  * @param slaveAddress Адрес ведомого устройства Modbus.
@@ -246,356 +70,46 @@ bool HS321::writeParameters(const uint8_t slaveAddress,
                             const uint16_t startAddress,
                             const uint16_t* arrayValues,
                             const size_t numberRegisters) const {
-
-#ifdef DEBUG
-    _serialDebug->println("START writeParameters !!!");
-#endif
-
-    // Проверка входных данных
-    if (arrayValues == nullptr || numberRegisters == 0 ) {
-#ifdef DEBUG
-        _serialDebug->println("Ошибка: неверные входные данные");
-#endif
-        return false;
-    }
-
-    // Ограничение максимального количества регистров (Modbus ограничение)
-    constexpr size_t MAX_MODBUS_REGISTERS = 123;
-    if (numberRegisters > MAX_MODBUS_REGISTERS) {
-#ifdef DEBUG
-        _serialDebug->print("Ошибка: слишком много регистров: ");
-        _serialDebug->println(numberRegisters);
-#endif
-        return false;
-    }
-
-    // Приводим void* к uint16_t* для работы с данными
-    // const auto arrayRegisterValues = static_cast<const uint16_t*>(arrayValues);
-
-    // Вычисляем размер запроса
-    const size_t requestSize = (numberRegisters == 1) ? 8 : (9 + numberRegisters * 2);
-
-    // Используем статический буфер с максимальным размером (более безопасно)
-    constexpr size_t MAX_REQUEST_SIZE = 7 + (MAX_MODBUS_REGISTERS * 2);
-    if (requestSize > MAX_REQUEST_SIZE) {
-        return false;
-    }
-
-    uint8_t request[requestSize];  // VLA (Variable Length Array) - работает в GCC/Clang
-
-    // Заполняем заголовок
-    request[0] = slaveAddress;              // Адрес устройства
-
-    if (numberRegisters == 1) {
-        request[1] = WRITE_ONE;             // Код функции 0x06 для записи в один регистр
-        request[2] = static_cast<uint8_t>(startAddress >> 8);   // Высокий байт адреса
-        request[3] = static_cast<uint8_t>(startAddress & 0xFF); // Низкий байт адреса
-        request[4] = static_cast<uint8_t>(arrayValues[0] >> 8); // Данные регистра старший байт
-        request[5] = static_cast<uint8_t>(arrayValues[0] & 0xFF);   // Данные регистра младший байт
-    } else if (numberRegisters > 1) {
-        request[1] = WRITE_RANGE;           // Код функции 0x10 для записи в диапазон регистров
-        request[2] = static_cast<uint8_t>(startAddress >> 8);
-        request[3] = static_cast<uint8_t>(startAddress & 0xFF);
-        request[4] = static_cast<uint8_t>(numberRegisters >> 8);    // Количество регистров старший байт
-        request[5] = static_cast<uint8_t>(numberRegisters & 0xFF);  // Количество регистров младший байт
-        request[6] = static_cast<uint8_t>(numberRegisters * 2); // Количество байт данных
-        // Копируем, данные с преобразованием порядка байт
-        for (size_t i = 0; i < numberRegisters; i++) {
-            request[7 + (i * 2)] = static_cast<uint8_t>(arrayValues[i] >> 8);
-            request[8 + (i * 2)] = static_cast<uint8_t>(arrayValues[i] & 0xFF);
-        }
-    }
-
-    // Вычисление CRC (все байты, кроме последних 2, которые для CRC)
-    const uint16_t crc = calculateCRC(request, requestSize - 2);
-    // Добавляем CRC в конец запроса
-    request[requestSize - 2] = static_cast<uint8_t>(crc & 0xFF); // Низкий байт CRC
-    request[requestSize - 1] = static_cast<uint8_t>((crc >> 8) & 0xFF); // Высокий байт CRC
-
-#ifdef DEBUG
-    _serialDebug->print("Запрос Modbus (");
-    _serialDebug->print(requestSize);
-    _serialDebug->print(" байт): ");
-    for (size_t i = 0; i < requestSize; i++) {
-        if (request[i] < 0x10) _serialDebug->print("0");
-        _serialDebug->print(request[i], HEX);
-        _serialDebug->print(" ");
-    }
-    _serialDebug->println();
-#endif
-
-    // Отправка запроса
-    sendData(request, requestSize);
-
-    // Получение ответа
-    // Размер ответа зависит от функции:
-    // Для 0x06: 8 байт
-    // Для 0x10: 8 байт
-    constexpr size_t responseSize = 8;  // Modbus ответ всегда 8 байт для этих функций
-    uint8_t response[responseSize];
-
-    if (!receiveData(response, responseSize)) {
-#ifdef DEBUG
-        _serialDebug->println("Ошибка приема ответа");
-        _serialDebug->println("END writeParameters !!!");
-        _serialDebug->println();
-        _serialDebug->println();
-#endif
-        return false;
-    }
-#ifdef DEBUG
-    _serialDebug->println("END writeParameters !!!");
-    _serialDebug->println();
-    _serialDebug->println();
-#endif
-    // Проверка ответа
-    return validateModbusResponse(response, responseSize, slaveAddress, request[1]);
+    ModbusTransaction transaction;
+    transaction.setWrite(slaveAddress, startAddress, arrayValues, numberRegisters);
+    return execute(transaction);
 }
 
 /**
- * @brief Проверка корректности ответа Modbus.
- *
- * Проверяет, соответствует ли ответ ожидаемому:
- * - правильный адрес устройства,
- * - отсутствие кода исключения,
- * - корректный код функции,
- * - правильная контрольная сумма CRC.
+ * @brief Выполнение транзакции с ожиданием и сохранением её результата.
  *
- * @param response Указатель на буфер с принятым ответом.
- * @param responseSize Размер ответа в байтах.
- * @param expectedAddress Ожидаемый адрес ведомого устройства.
- * @param expectedFunction Ожидаемый код функции.
- * @return true, если ответ корректен, иначе false.
+ * @param transaction Подготовленная транзакция.
+ * @return true, если транзакция завершилась успешно, иначе false.
  */
-bool HS321::validateModbusResponse(const uint8_t* response,
-                                      const size_t responseSize,
-                                      const uint8_t expectedAddress,
-                                      const uint8_t expectedFunction) const {
-    if (responseSize < 4) {  // Минимум: адрес + функция + CRC
-        return false;
-    }
-
-    // Проверка адреса устройства
-    if (response[0] != expectedAddress) {
-#ifdef DEBUG
-        _serialDebug->print("Неверный адрес в ответе: 0x");
-        _serialDebug->print(response[0], HEX);
-        _serialDebug->print(", ожидалось: 0x");
-        _serialDebug->println(expectedAddress, HEX);
-#endif
-        return false;
-    }
-
-    // Проверка на исключение
-    if (response[1] == (expectedFunction | 0x80)) {
-#ifdef DEBUG
-        _serialDebug->print("Исключение Modbus. Код ошибки: 0x");
-        _serialDebug->println(response[2], HEX);
-#endif
-        return false;
-    }
-
-    // Проверка кода функции
-    if (response[1] != expectedFunction) {
-#ifdef DEBUG
-        _serialDebug->print("Неверная функция в ответе: 0x");
-        _serialDebug->print(response[1], HEX);
-        _serialDebug->print(", ожидалось: 0x");
-        _serialDebug->println(expectedFunction, HEX);
-#endif
-        return false;
-    }
-
-    // Проверка CRC
-    const uint16_t calculatedCRC = calculateCRC(response, responseSize - 2);
-    const uint16_t receivedCRC = static_cast<uint16_t>(response[responseSize - 1] << 8) | response[responseSize - 2];
-
-    if (calculatedCRC != receivedCRC) {
-#ifdef DEBUG
-        _serialDebug->print("Ошибка CRC. Вычислено: 0x");
-        _serialDebug->print(calculatedCRC, HEX);
-        _serialDebug->print(", получено: 0x");
-        _serialDebug->println(receivedCRC, HEX);
-#endif
-        return false;
-    }
-
-    return true;
-}
-
-/**
- * @brief Вычисление контрольной суммы CRC16-Modbus.
- *
- * Использует полином 0xA001 (обратный к 0x8005) для проверки целостности данных.
- *
- * @param data Указатель на массив данных.
- * @param length Длина данных в байтах.
- * @return Вычисленное значение CRC16.
- */
-uint16_t HS321::calculateCRC(const uint8_t *data, const uint8_t length) const {
-    // Более строгая проверка
-    if (data == nullptr || length == 0) {
-        return 0xFFFF; // или другое значение ошибки
-    }
-
-    // Дополнительная проверка, что указатель валидный
-    // (если есть возможность проверить диапазон адресов)
-
-    uint16_t crc = 0xFFFF; // начальное значение CRC
-    for (uint8_t i = 0; i < length; i++) {
-        crc ^= data[i];
-        for (uint8_t j = 0; j < 8; j++) {
-            if (crc & 0x0001) {
-                crc = (crc >> 1) ^ 0xA001; // полином
-            } else {
-                crc = crc >> 1;
-            }
-        }
-    }
-
-#ifdef DEBUG
-    _serialDebug->print("CRC as uint16_t: 0x");
-    _serialDebug->println(crc, HEX);
-#endif
-
-    return crc;
+bool HS321::execute(ModbusTransaction& transaction) const {
+    attachStats(transaction);
+    const bool result = _bus->execute(transaction);
+    _lastError = transaction.error;
+    _lastExceptionCode = transaction.exceptionCode;
+    return result;
 }
 
 /**
- * @brief Отправка данных через интерфейс RS485.
+ * @brief Отказ синхронного вызова без обращения к шине.
  *
- * Переводит RS485-трансивер в режим передачи, отправляет данные,
- * после чего немедленно возвращает его в режим приёма.
- *
- * @param data Указатель на массив данных для отправки.
- * @param length Количество байт для передачи.
+ * @param error Причина отказа.
+ * @return Всегда false.
  */
-void HS321::sendData(const uint8_t* data, const size_t length) const {
-#ifdef DEBUG_sendData
-    _serialDebug->println("\t START sendData !!!");
-#endif
-
-    // Переводим устройство в режим передатчика
-    digitalWrite(_transmitterModeContact, RS485Transmit);
-    //delay(1);  // Короткая задержка для стабилизации
-
-        // Реализуйте отправку данных через последовательный порт
-        _serialPort->write(data, length);
-        _serialPort->flush();  // Ожидаем завершения передачи
-
-    // Немедленно возвращаемся в режим приема
-    digitalWrite(_transmitterModeContact, RS485Receive);
-    //delay(1);  // Важно! Дать линии стабилизироваться перед приёмом
-
-#ifdef DEBUG_sendData
-    _serialDebug->println("\t END sendData !!!");
-#endif
+bool HS321::reject(const TransactionError error) const {
+    _lastError = error;
+    _lastExceptionCode = 0;
+    return false;
 }
 
 /**
- * @brief Приём данных по протоколу Modbus с тайм-аутами.
+ * @brief Отказ синхронного вызова из-за неверных аргументов или отсутствия инициализации.
  *
- * Использует два тайм-аута:
- * - общий (TOTAL_TIMEOUT) — на весь пакет,
- * - межсимвольный (INTER_CHAR_TIMEOUT) — между байтами.
- *
- * @param buffer Буфер для сохранения принятых данных.
- * @param length Ожидаемое количество байт.
- * @return true, если все данные получены, иначе false.
+ * @return Всегда false.
  */
-bool HS321::receiveData(uint8_t* buffer, const size_t length) const {
-#ifdef DEBUG
-    _serialDebug->println("\t START receiveData !!!");
-#endif
-
-    if (buffer == nullptr || length == 0) {
-#ifdef DEBUG
-        _serialDebug->println("Ошибка: неверные входные данные");
-        _serialDebug->println("\t END receiveData !!!");
-#endif
-        return false;
-    }
-
-    size_t bytesRead = 0;
-    unsigned long lastByteTime = millis(); // Начало времени ожидания
-    const unsigned long charTimeout = static_cast<unsigned long>(ceil(_interCharTimeout * length / 1000)); // Время ожидания между символами в мс
-
-#ifdef DEBUG
-    _serialDebug->print("Waiting for ");
-    _serialDebug->print(length);
-    _serialDebug->println(" bytes...");
-#endif
-
-    // Ждем данные с тайм-аутом
-    while (bytesRead < length) {
-        // Общий тайм-аут
-        if (millis() - lastByteTime > _totalTimeout) {
-#ifdef DEBUG
-            _serialDebug->print("TOTAL TIMEOUT! Received ");
-            _serialDebug->print(bytesRead);
-            _serialDebug->print("/");
-            _serialDebug->println(length);
-#endif
-            break;
-        }
-
-        // Чтение доступных данных
-        while(_serialPort->available() > 0 && bytesRead < length) {
-            buffer[bytesRead] = _serialPort->read();
-            bytesRead++;
-            lastByteTime = millis(); // Сброс таймера при получении данных
-#ifdef DEBUG_receiveData
-            _serialDebug->print("Got byte ");
-            _serialDebug->print(bytesRead);
-            _serialDebug->print(": 0x");
-            if (buffer[bytesRead-1] < 0x10) _serialDebug->print("0");
-            _serialDebug->print(buffer[bytesRead-1], HEX);
-            _serialDebug->println();
-#endif
-        }
-
-
-        // Проверка тайм-аута между символами только если нет доступных данных
-        if (bytesRead < length) {
-            if (_serialPort->available() == 0) {
-                if (millis() - lastByteTime > charTimeout) {
-#ifdef DEBUG
-                    _serialDebug->print("INTER-CHAR TIMEOUT! Received ");
-                    _serialDebug->print(bytesRead);
-                    _serialDebug->print("/");
-                    _serialDebug->println(length);
-#endif
-                    break;
-                }
-            }
-        }
-    }
-
-#ifdef DEBUG
-    if (bytesRead > 0) {
-        _serialDebug->print("Received ");
-        _serialDebug->print(bytesRead);
-        _serialDebug->print("/");
-        _serialDebug->print(length);
-        _serialDebug->print(" bytes: ");
-        for (size_t i = 0; i < bytesRead; i++) {
-            if (buffer[i] < 0x10) _serialDebug->print("0");
-            _serialDebug->print(buffer[i], HEX);
-            _serialDebug->print(" ");
-        }
-        _serialDebug->println("");
-    } else {
-        _serialDebug->print("NO DATA RECEIVED");
-        _serialDebug->println("");
-    }
-
-    _serialDebug->println("\t END receiveData !!!");
-#endif
-
-    return (bytesRead == length);
+bool HS321::rejectRequest() const {
+    return reject(isInitialized() ? TransactionError::INVALID_REQUEST : TransactionError::NOT_INITIALIZED);
 }
 
-
 /**
  * @brief Чтение кода текущей ошибки частотного преобразователя.
  *
@@ -606,7 +120,7 @@ bool HS321::receiveData(uint8_t* buffer, const size_t length) const {
  */
 bool HS321::readFaultDescription(uint16_t* faultCode) const {
     if (!isInitialized() || faultCode == nullptr) {
-        return false;
+        return rejectRequest();
     }
     return readSingleParameter(0x8000, faultCode);
 }
@@ -621,7 +135,7 @@ bool HS321::readFaultDescription(uint16_t* faultCode) const {
  */
 bool HS321::readRunningState(uint16_t* state) const {
     if (!isInitialized() || state == nullptr) {
-        return false;
+        return rejectRequest();
     }
     return readParameters(_slaveAddress, 0x3000, state, 1);
 }
@@ -630,15 +144,19 @@ bool HS321::readRunningState(uint16_t* state) const {
  * @brief Отправка команды управления двигателем.
  *
  * Передаёт одну из команд (пуск вперёд, стоп, сброс аварии и т.д.) в регистр 0x2000.
+ * Команда ставится в срочную очередь шины и выполняется раньше ожидающих опросов.
  *
  * @param command Команда из перечисления ControlCommand.
  * @return true при успехе, иначе false.
  */
 bool HS321::writeControlCommand(const ControlCommand command) const {
     if (!isInitialized()) {
-        return false;
+        return rejectRequest();
     }
-    return writeSingleParameter(0x2000,  static_cast<uint16_t>(command));
+    ModbusTransaction transaction;
+    transaction.setWriteSingle(_slaveAddress, 0x2000, static_cast<uint16_t>(command));
+    transaction.priority = TransactionPriority::URGENT;
+    return execute(transaction);
 }
 
 
@@ -668,7 +186,7 @@ bool HS321::readSingleParameter(const uint16_t address, uint16_t* value) const {
  */
 bool HS321::readParametersInGroups(const GroupsParameter group, const uint8_t numberGroup, uint16_t* arrayValues, const size_t count) const {
     if (!isInitialized() || arrayValues == nullptr || count == 0) {
-        return false;
+        return rejectRequest();
     }
     const uint16_t startAddress = buildParameterAddress(group, numberGroup);
     return readParameters(_slaveAddress, startAddress, arrayValues, count);
@@ -686,7 +204,7 @@ bool HS321::readParametersInGroups(const GroupsParameter group, const uint8_t nu
  */
 bool HS321::readSingleGroupParameter(const GroupsParameter group, const uint8_t numberGroup, uint16_t* value) const {
     if (!isInitialized() || value == nullptr) {
-        return false;
+        return rejectRequest();
     }
     const uint16_t address = buildParameterAddress(group, numberGroup);
     return readSingleParameter(address, value);
@@ -719,7 +237,7 @@ bool HS321::writeSingleParameter(const uint16_t address, const uint16_t value) c
  */
 bool HS321::writeParametersInGroups(const GroupsParameter group, const uint8_t numberGroup, const uint16_t* arrayData, const size_t dataCount) const {
     if (!isInitialized() || arrayData == nullptr || dataCount == 0) {
-        return false;
+        return rejectRequest();
     }
     uint16_t startAddress = buildParameterAddress(group, numberGroup);
     return writeParameters(_slaveAddress, startAddress, arrayData, dataCount );
@@ -737,12 +255,286 @@ bool HS321::writeParametersInGroups(const GroupsParameter group, const uint8_t n
  */
 bool HS321::writeSingleGroupParameter(const GroupsParameter group, const uint8_t numberGroup, const uint16_t value) const {
     if (!isInitialized()) {
-        return false;
+        return rejectRequest();
     }
     uint16_t address = buildParameterAddress(group, numberGroup);
     return writeSingleParameter(address, value);
 }
 
+/**
+ * @brief Граница диапазона параметра в фиксированной точке.
+ *
+ * @param param Описание параметра из каталога.
+ * @param limit minSetting или maxSetting параметра.
+ * @return Граница в единицах младшего разряда параметра.
+ */
+static long scaledLimit(const Parameter& param, const ParameterValue& limit) {
+    if (param.type == ParameterType::FLOAT) {
+        return ScaledValue::fromFloat(limit.floatValue, param.decimals).value;
+    }
+    return limit.intValue;
+}
+
+/**
+ * @brief Чтение параметра с преобразованием в фиксированную точку.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @param value Прочитанное значение.
+ * @return true при успехе, иначе false.
+ */
+bool HS321::readScaled(const GroupsParameter group, const uint8_t numberGroup, ScaledValue& value) const {
+    Parameter param;
+    if (!ParameterGroup::findNumeric(buildParameterAddress(group, numberGroup), param) || param.type == ParameterType::STRING) {
+        return reject(TransactionError::INVALID_REQUEST);
+    }
+    uint16_t raw;
+    if (!readSingleGroupParameter(group, numberGroup, &raw)) {
+        return false;
+    }
+    // Параметры с отрицательным минимумом передаются в дополнительном коде
+    const long decoded = (scaledLimit(param, param.minSetting) < 0) ? static_cast<long>(static_cast<int16_t>(raw)) : static_cast<long>(raw);
+    value = ScaledValue(decoded, param.decimals);
+    return true;
+}
+
+/**
+ * @brief Запись параметра из фиксированной точки с проверкой диапазона.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @param value Записываемое значение.
+ * @return true при успехе, иначе false.
+ */
+bool HS321::writeScaled(const GroupsParameter group, const uint8_t numberGroup, const ScaledValue& value) const {
+    Parameter param;
+    if (!ParameterGroup::findNumeric(buildParameterAddress(group, numberGroup), param) || param.type == ParameterType::STRING) {
+        return reject(TransactionError::INVALID_REQUEST);
+    }
+    const ScaledValue scaled = value.rescale(param.decimals);
+    if (scaled.value < scaledLimit(param, param.minSetting) || scaled.value > scaledLimit(param, param.maxSetting)) {
+#ifdef DEBUG
+        if (_bus->debugPort() != nullptr) {
+            _bus->debugPort()->println(F("writeScaled: value out of range"));
+        }
+#endif
+        return reject(TransactionError::OUT_OF_RANGE); // Кадр не отправляется
+    }
+    return writeSingleGroupParameter(group, numberGroup, static_cast<uint16_t>(scaled.value));
+}
+
+/**
+ * @brief Приведение значения к другому количеству знаков после запятой.
+ *
+ * @param newDecimals Требуемое количество знаков после запятой.
+ * @return Значение с newDecimals знаками, округлённое до ближайшего.
+ */
+ScaledValue ScaledValue::rescale(const uint8_t newDecimals) const {
+    if (newDecimals >= decimals) {
+        return ScaledValue(value * powerOfTen(newDecimals - decimals), newDecimals);
+    }
+    const long divisor = powerOfTen(decimals - newDecimals);
+    const long half = divisor / 2;
+    return ScaledValue((value >= 0 ? value + half : value - half) / divisor, newDecimals);
+}
+
+/**
+ * @brief Создание значения из float с округлением.
+ *
+ * @param number Значение с плавающей точкой.
+ * @param decimals Количество знаков после запятой.
+ * @return Значение в фиксированной точке.
+ */
+ScaledValue ScaledValue::fromFloat(const float number, const uint8_t decimals) {
+    const float scaled = number * static_cast<float>(powerOfTen(decimals));
+    return ScaledValue(static_cast<long>(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f), decimals);
+}
+
+/**
+ * @brief Степень десяти.
+ *
+ * @param decimals Показатель степени.
+ * @return 10^decimals.
+ */
+long ScaledValue::powerOfTen(uint8_t decimals) {
+    long result = 1;
+    while (decimals-- > 0) {
+        result *= 10;
+    }
+    return result;
+}
+
+/**
+ * @brief Скорости, соответствующие кодам FC.00.
+ *
+ * Тип uint32_t совпадает с типом, который читает pgm_read_dword().
+ */
+static const uint32_t baudRates[] PROGMEM = { 1200, 2400, 4800, 9600, 19200, 38400 };
+
+/**
+ * @brief Код FC.00 для скорости.
+ *
+ * @param baud Скорость передачи данных.
+ * @param code Код FC.00.
+ * @return true, если скорость поддерживается частотником, иначе false.
+ */
+bool HS321::baudRateCode(const unsigned long baud, uint16_t& code) {
+    for (uint16_t i = 0; i < sizeof(baudRates) / sizeof(baudRates[0]); i++) {
+        if (pgm_read_dword(&baudRates[i]) == baud) {
+            code = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Скорость по коду FC.00.
+ *
+ * @param code Код FC.00.
+ * @return Скорость передачи данных или 0 для неизвестного кода.
+ */
+unsigned long HS321::baudRate(const uint16_t code) {
+    return (code < sizeof(baudRates) / sizeof(baudRates[0])) ? pgm_read_dword(&baudRates[code]) : 0;
+}
+
+/**
+ * @brief Поиск скорости, на которой отвечает частотник.
+ *
+ * На время поиска тайм-аут ответа шины сокращается до BAUD_PROBE_TIMEOUT, а учёт состояния
+ * связи приостанавливается: молчание на неверных скоростях не должно признать частотник
+ * недоступным и остановить перебор.
+ *
+ * @return true, если скорость найдена, иначе false.
+ */
+bool HS321::detectBaudRate() {
+    if (!isInitialized()) {
+        return rejectRequest();
+    }
+    const unsigned long original = _bus->baud();
+    const unsigned long timeout = _bus->responseTimeout();
+    const HealthPolicy policy = suspendHealthTracking();
+    _bus->setResponseTimeout(BAUD_PROBE_TIMEOUT);
+    uint16_t code;
+    bool found = baudRateCode(original, code) && confirmBaudRate(code, 1);
+    // От большей скорости к меньшей: быстрые попытки дешевле
+    for (code = sizeof(baudRates) / sizeof(baudRates[0]); !found && code-- > 0;) {
+        const unsigned long candidate = baudRate(code);
+        found = candidate != original && _bus->setBaud(candidate) && confirmBaudRate(code, 1);
+    }
+    if (!found) {
+        _bus->setBaud(original);
+    }
+    _bus->setResponseTimeout(timeout);
+    resumeHealthTracking(policy, found);
+#ifdef DEBUG
+    HardwareSerial* const debug = _bus->debugPort();
+    if (debug != nullptr) {
+        debug->print(F("HS321: скорость "));
+        debug->println(found ? _bus->baud() : 0);
+    }
+#endif
+    return found;
+}
+
+/**
+ * @brief Перевод частотника и шины на другую скорость с откатом.
+ *
+ * Ответ-исключение на запись FC.00 означает, что частотник значение не принял, и скорость
+ * не меняется. При другой ошибке записи (частотник мог переключиться, не успев ответить)
+ * шина всё равно переходит на новую скорость и проверяет связь. Учёт состояния связи
+ * с момента записи FC.00 приостановлен, чтобы неудачная проверка не помешала откату.
+ *
+ * @param baud Новая скорость.
+ * @return true, если связь на новой скорости подтверждена, иначе false.
+ */
+bool HS321::switchBaudRate(const unsigned long baud) {
+    uint16_t target;
+    if (!isInitialized() || !baudRateCode(baud, target) || (_bus->baudFixed() && baud != _bus->baud())) {
+        return rejectRequest(); // Скорость StaticModbusBus задана при компиляции
+    }
+    const unsigned long previous = _bus->baud();
+    uint16_t previousCode;
+    if (!readSingleGroupParameter(GROUP_FC, 0, &previousCode)) {
+        return false; // Нет связи на текущей скорости
+    }
+    if (previousCode == target && previous == baud) {
+        return true;
+    }
+    const HealthPolicy policy = suspendHealthTracking();
+    if (!writeSingleGroupParameter(GROUP_FC, 0, target) && _lastError == TransactionError::EXCEPTION) {
+        resumeHealthTracking(policy, false);
+        return false;
+    }
+    if (_bus->setBaud(baud) && confirmBaudRate(target, 3)) {
+        resumeHealthTracking(policy, true);
+        return true;
+    }
+
+    // Откат: частотник мог не переключиться или переключиться, но не отвечать на новой скорости
+    const TransactionError error = _lastError;
+    const uint8_t exceptionCode = _lastExceptionCode;
+    writeSingleGroupParameter(GROUP_FC, 0, previousCode);
+    _bus->setBaud(previous);
+    resumeHealthTracking(policy, confirmBaudRate(previousCode, 3));
+    _lastError = error;
+    _lastExceptionCode = exceptionCode;
+    return false;
+}
+
+/**
+ * @brief Приостановка учёта состояния связи с частотником.
+ *
+ * Частотник снова считается доступным, и неудачи до resumeHealthTracking() не признают
+ * его недоступным (failureThreshold = 0), поэтому запросы уходят на линию.
+ *
+ * @return Политика, действовавшая до вызова.
+ */
+HealthPolicy HS321::suspendHealthTracking() const {
+    const HealthPolicy policy = _bus->healthPolicy();
+    HealthPolicy suspended = policy;
+    suspended.failureThreshold = 0;
+    _bus->setHealthPolicy(suspended);
+    _bus->resetHealth(_slaveAddress);
+    return policy;
+}
+
+/**
+ * @brief Возобновление учёта состояния связи с частотником.
+ *
+ * После подтверждения скорости накопленные на других скоростях неудачи и время ответа
+ * сбрасываются.
+ *
+ * @param policy Политика, возвращённая suspendHealthTracking().
+ * @param confirmed Связь подтверждена.
+ */
+void HS321::resumeHealthTracking(const HealthPolicy& policy, const bool confirmed) const {
+    _bus->setHealthPolicy(policy);
+    if (confirmed) {
+        _bus->resetHealth(_slaveAddress);
+    }
+}
+
+/**
+ * @brief Проверка связи на текущей скорости шины.
+ *
+ * @param code Ожидаемый код скорости в FC.00.
+ * @param attempts Количество попыток чтения.
+ * @return true, если FC.00 прочитан и равен code, иначе false (несовпадение — VERIFY_MISMATCH).
+ */
+bool HS321::confirmBaudRate(const uint16_t code, uint8_t attempts) const {
+    while (attempts-- > 0) {
+        uint16_t value;
+        if (readSingleGroupParameter(GROUP_FC, 0, &value)) {
+            if (value == code) {
+                return true;
+            }
+            reject(TransactionError::VERIFY_MISMATCH);
+        }
+    }
+    return false;
+}
+
 /**
  * @brief Проверка текущих настроек связи с частотником.
  *
@@ -753,31 +545,131 @@ bool HS321::writeSingleGroupParameter(const GroupsParameter group, const uint8_t
  */
 bool HS321::checkCommunicationSettings() const {
     if (!isInitialized()) {
-        return false;
+        return rejectRequest();
     }
     constexpr size_t requestSize = 5;
     uint16_t arrayValues[requestSize];
+    HardwareSerial* const debug = _bus->debugPort();
     if ( readParametersInGroups(GROUP_FC, 0,  arrayValues, requestSize) ) {
+        if (debug == nullptr) {
+            return true;
+        }
         // Проверка FC.00 - скорость (должен быть 3 = 9600)
-        _serialDebug->print("FC.00 (Baud rate): ");
-        _serialDebug->println(arrayValues [0]);
+        debug->print(F("FC.00 (Baud rate): "));
+        debug->println(arrayValues [0]);
 
         // Проверка FC.01 - формат данных (должен быть 0 = 8N1)
-        _serialDebug->print("FC.01 (Data format): ");
-        _serialDebug->println(arrayValues [1]);
+        debug->print(F("FC.01 (Data format): "));
+        debug->println(arrayValues [1]);
 
         // Проверка FC.02 - адрес (должен быть 1 или 2)
-        _serialDebug->print("FC.02 (Address): ");
-        _serialDebug->println(arrayValues[2]);
+        debug->print(F("FC.02 (Address): "));
+        debug->println(arrayValues[2]);
 
         // Проверка FC.03 - тайм-аут связи (должен быть 10 с)
-        _serialDebug->print("FC.03 (Timeout Communication): ");
-        _serialDebug->println(arrayValues[3]);
+        debug->print(F("FC.03 (Timeout Communication): "));
+        debug->println(arrayValues[3]);
 
         // Проверка FC.05 - тип обработчика ошибки связи (должен быть 1 "бездействие")
-        _serialDebug->print("FC.05 (Error Communication): ");
-        _serialDebug->println(arrayValues[4]);
+        debug->print(F("FC.05 (Error Communication): "));
+        debug->println(arrayValues[4]);
         return true;
     }
     return false;
 }
+
+/**
+ * @brief Асинхронный запуск чтения нескольких параметров из указанной группы.
+ *
+ * Вычисляет начальный адрес по группе и номеру и запускает транзакцию чтения.
+ * Результат доступен после того, как poll() вернёт COMPLETED.
+ *
+ * @param group Группа параметров (например, GROUP_F1).
+ * @param numberGroup Номер начального параметра в группе.
+ * @param arrayValues Буфер для сохранения значений (должен существовать до завершения транзакции).
+ * @param count Количество регистров для чтения.
+ * @return true, если транзакция поставлена в очередь, иначе false.
+ */
+bool HS321::beginReadParametersInGroups(const GroupsParameter group, const uint8_t numberGroup, uint16_t* arrayValues, const size_t count) {
+    if (!isInitialized() || arrayValues == nullptr || count == 0) {
+        return false;
+    }
+    const uint16_t startAddress = buildParameterAddress(group, numberGroup);
+    if (isBusy()) {
+        return false;
+    }
+    _transaction.setRead(_slaveAddress, startAddress, arrayValues, count);
+    _transaction.priority = TransactionPriority::NORMAL;
+    attachStats(_transaction);
+    return _bus->submit(_transaction);
+}
+
+/**
+ * @brief Асинхронный запуск записи нескольких значений в параметры указанной группы.
+ *
+ * @param group Группа параметров.
+ * @param numberGroup Начальный номер параметра.
+ * @param arrayData Массив значений для записи (должен существовать до завершения транзакции).
+ * @param dataCount Количество значений.
+ * @return true, если транзакция поставлена в очередь, иначе false.
+ */
+bool HS321::beginWriteParametersInGroups(const GroupsParameter group, const uint8_t numberGroup, const uint16_t* arrayData, const size_t dataCount) {
+    if (!isInitialized() || arrayData == nullptr || dataCount == 0) {
+        return false;
+    }
+    const uint16_t startAddress = buildParameterAddress(group, numberGroup);
+    if (isBusy()) {
+        return false;
+    }
+    _transaction.setWrite(_slaveAddress, startAddress, arrayData, dataCount);
+    _transaction.priority = TransactionPriority::NORMAL;
+    attachStats(_transaction);
+    return _bus->submit(_transaction);
+}
+
+/**
+ * @brief Асинхронная отправка команды управления двигателем в регистр 0x2000.
+ *
+ * Команда ставится в срочную очередь шины и использует отдельную транзакцию,
+ * поэтому её можно отправить, не дожидаясь завершения асинхронного чтения или записи параметров.
+ *
+ * @param command Команда из перечисления ControlCommand.
+ * @return true, если транзакция поставлена в очередь, иначе false.
+ */
+bool HS321::beginWriteControlCommand(const ControlCommand command) {
+    if (!isInitialized()) {
+        return false;
+    }
+    if (_command.status == TransactionStatus::PENDING) {
+        return false;
+    }
+    _command.setWriteSingle(_slaveAddress, 0x2000, static_cast<uint16_t>(command));
+    _command.priority = TransactionPriority::URGENT;
+    attachStats(_command);
+    return _bus->submit(_command);
+}
+
+/**
+ * @brief Продвижение асинхронной транзакции.
+ *
+ * Выполняет один неблокирующий шаг общей шины. Вызывается из loop().
+ *
+ * @return Текущее состояние транзакции объекта (PENDING, пока она не завершена).
+ */
+TransactionStatus HS321::poll() {
+    _bus->poll();
+    return _transaction.status;
+}
+
+/**
+ * @brief Установка функции обратного вызова для асинхронных транзакций.
+ *
+ * @param callback Функция, вызываемая по завершении транзакции (nullptr — отключить).
+ * @param context Пользовательский указатель, передаваемый в callback.
+ */
+void HS321::onTransactionComplete(const TransactionCallback callback, void* context) {
+    _transaction.callback = callback;
+    _transaction.context = context;
+    _command.callback = callback;
+    _command.context = context;
+}
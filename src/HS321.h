@@ -7,18 +7,7 @@
  */
 
 #include <Arduino.h>
-
-/**
- * @def RS485Transmit
- * @brief Уровень сигнала для режима передачи данных по RS485 (высокий уровень).
- */
-#define RS485Transmit HIGH
-
-/**
- * @def RS485Receive
- * @brief Уровень сигнала для режима приёма данных по RS485 (низкий уровень).
- */
-#define RS485Receive LOW
+#include "ModbusBus.h"
 
 /**
  * @enum Model
@@ -85,6 +74,66 @@ enum GroupsParameter : uint16_t {
     GROUP_COUNT = GROUP_d - 97  ///< Общее количество групп параметров
 };
 
+/**
+ * @var groupSizes[]
+ * @brief Количество адресов в каждой группе параметров (номера параметров 0..N-1).
+ *
+ * Порядок значений соответствует порядку в enum GroupsParameter, группа d хранится последней
+ * (индекс GROUP_COUNT - 1, см. groupIndex()).
+ */
+constexpr uint8_t groupSizes[GROUP_COUNT] = {
+    21,  ///< GROUP_F0
+    15,  ///< GROUP_F1
+    34,  ///< GROUP_F2
+    9,   ///< GROUP_F3
+    9,   ///< GROUP_F4
+    21,  ///< GROUP_F5
+    15,  ///< GROUP_F6
+    26,  ///< GROUP_F7
+    56,  ///< GROUP_F8
+    12,  ///< GROUP_F9
+    27,  ///< GROUP_FA
+    23,  ///< GROUP_FB
+    6,   ///< GROUP_FC
+    1,   ///< GROUP_FP
+    20   ///< GROUP_d
+};
+
+/**
+ * @brief Индекс группы в массивах, упорядоченных как groupSizes[].
+ * @param group Группа параметров.
+ * @return Индекс 0..GROUP_COUNT-1.
+ */
+constexpr uint8_t groupIndex(const GroupsParameter group) {
+    return (group == GROUP_d) ? static_cast<uint8_t>(GROUP_COUNT - 1) : static_cast<uint8_t>(group);
+}
+
+/**
+ * @brief Суммарное количество адресов в группах с индексами 0..index-1.
+ * @param index Индекс группы (GROUP_COUNT — общее количество адресов всех групп).
+ * @return Смещение первого адреса группы в плоском массиве всех параметров.
+ */
+constexpr uint16_t groupOffset(const uint8_t index) {
+    return (index == 0) ? 0 : static_cast<uint16_t>(groupOffset(index - 1) + groupSizes[index - 1]);
+}
+
+/**
+ * @brief Размер наибольшей группы параметров.
+ *
+ * Любая группа целиком помещается в один кадр чтения (наибольшая — F8, 56 регистров),
+ * поэтому буфера такого размера достаточно для чтения группы целиком.
+ *
+ * @param index Индекс группы, с которой начинается поиск.
+ * @return Количество адресов в наибольшей группе.
+ */
+constexpr uint8_t largestGroupSize(const uint8_t index = 0) {
+    return (index >= GROUP_COUNT) ? 0
+         : (groupSizes[index] > largestGroupSize(index + 1)) ? groupSizes[index] : largestGroupSize(index + 1);
+}
+
+static_assert(ModbusBus::MAX_READ_REGISTERS >= largestGroupSize(),
+              "HS321_MAX_FRAME_SIZE: группа параметров должна читаться одним кадром");
+
 /**
  * @enum ControlCommand
  * @brief Команды управления работой двигателя.
@@ -134,8 +183,14 @@ enum ParameterType {
  */
 union ParameterValue {
     float floatValue;        ///< Хранение значения с плавающей точкой
-    int intValue;            ///< Хранение целочисленного значения
+    long intValue;           ///< Хранение целочисленного значения (long: на AVR значения до 65535 не помещаются в int)
     const char* stringValue; ///< Хранение строкового значения
+
+    ParameterValue() = default;
+    constexpr ParameterValue(float value) : floatValue(value) {}        ///< Значение с плавающей точкой
+    constexpr ParameterValue(int value) : intValue(value) {}            ///< Целочисленное значение
+    constexpr ParameterValue(long value) : intValue(value) {}           ///< Целочисленное значение
+    constexpr ParameterValue(const char* value) : stringValue(value) {} ///< Строковое значение
 };
 
 /**
@@ -143,6 +198,8 @@ union ParameterValue {
  * @brief Описание параметра частотного преобразователя.
  *
  * Содержит полную метаинформацию о параметре: название, диапазон, единицы измерения и т.д.
+ * У параметров, полученных из каталога (ParameterGroup, ParametersHS321), все строки
+ * находятся во Flash и выводятся через reinterpret_cast<const __FlashStringHelper*>.
  */
 struct Parameter {
     const char* name;              ///< Название параметра (например, "Частота задания")
@@ -152,6 +209,69 @@ struct Parameter {
     ParameterValue maxSetting;     ///< Максимально допустимое значение
     const char* description;       ///< Подробное описание параметра
     ParameterType type;            ///< Тип данных значения
+    uint8_t decimals;              ///< Знаков после запятой: регистр хранит значение × 10^decimals (50.00 Гц → 5000)
+};
+
+/**
+ * @struct ScaledValue
+ * @brief Значение параметра в фиксированной точке.
+ *
+ * Хранит целое число единиц младшего разряда: 50.00 Гц — value = 5000, decimals = 2.
+ * Все операции, кроме toFloat() и fromFloat(), целочисленные и не требуют эмуляции float на AVR.
+ */
+struct ScaledValue {
+    long value;        ///< Значение в единицах младшего разряда (10^-decimals)
+    uint8_t decimals;  ///< Количество знаков после запятой
+
+    /**
+     * @brief Конструктор.
+     * @param value Значение в единицах младшего разряда.
+     * @param decimals Количество знаков после запятой.
+     */
+    constexpr ScaledValue(const long value = 0, const uint8_t decimals = 0) : value(value), decimals(decimals) {}
+
+    /**
+     * @brief Целая часть значения (с отбрасыванием дробной).
+     * @return Целая часть, например 50 для 50.00.
+     */
+    long integerPart() const { return value / powerOfTen(decimals); }
+
+    /**
+     * @brief Дробная часть значения в единицах младшего разряда, без знака.
+     * @return Дробная часть, например 5 для 12.05 (decimals = 2).
+     */
+    uint16_t fraction() const { return static_cast<uint16_t>(labs(value % powerOfTen(decimals))); }
+
+    /**
+     * @brief Приведение к другому количеству знаков после запятой.
+     *
+     * При уменьшении количества знаков значение округляется до ближайшего.
+     *
+     * @param newDecimals Требуемое количество знаков после запятой.
+     * @return Значение с newDecimals знаками.
+     */
+    ScaledValue rescale(uint8_t newDecimals) const;
+
+    /**
+     * @brief Преобразование в float (медленно на AVR, только для вывода и расчётов пользователя).
+     * @return Значение с плавающей точкой.
+     */
+    float toFloat() const { return static_cast<float>(value) / static_cast<float>(powerOfTen(decimals)); }
+
+    /**
+     * @brief Создание значения из float с округлением до decimals знаков.
+     * @param number Значение с плавающей точкой.
+     * @param decimals Количество знаков после запятой.
+     * @return Значение в фиксированной точке.
+     */
+    static ScaledValue fromFloat(float number, uint8_t decimals);
+
+    /**
+     * @brief Степень десяти для количества знаков после запятой.
+     * @param decimals Количество знаков (0..4).
+     * @return 10^decimals.
+     */
+    static long powerOfTen(uint8_t decimals);
 };
 
 /**
@@ -160,23 +280,26 @@ struct Parameter {
  *
  * Реализует взаимодействие с частотником через интерфейс RS485.
  * Поддерживает чтение/запись параметров, отправку команд управления и диагностику.
+ * Объект хранит только адрес ведомого и ссылку на шину ModbusBus, поэтому на одной
+ * шине может работать несколько частотников.
+ *
+ * Во FreeRTOS, когда шину продвигает задача ModbusBus::startTask(), блокирующие методы
+ * можно вызывать из нескольких задач одновременно: каждый вызов выполняется своей
+ * транзакцией в очереди шины. lastError() при этом относится к последнему завершённому вызову.
  */
 class HS321 {
 public:
     /**
      * @brief Конструктор класса.
-     * @param slaveAddress Адрес ведомого устройства (частотника) в сети Modbus.
-     * @param serialPort Ccылка на объект HardwareSerial для связи с частотником.
-     * @param serialDebug Ccылка на объект HardwareSerial для вывода отладочной информации.
-     * @param baud Скорость передачи данных (обычно 9600, 19200, 115200).
-     * @param transmitterModeContact Номер цифрового пина для управления направлением RS485 (DE/RE).
+     * @param slaveAddress Адрес ведомого устройства (частотника) в сети Modbus (0 — широковещательная запись).
+     * @param bus Ссылка на шину Modbus, к которой подключён частотник.
      */
-    HS321(uint8_t slaveAddress, HardwareSerial& serialPort, HardwareSerial& serialDebug, unsigned long baud, uint8_t transmitterModeContact);
+    HS321(uint8_t slaveAddress, ModbusBus& bus);
 
     /**
-     * @brief Инициализация класса и настройка аппаратных параметров.
+     * @brief Инициализация класса.
      *
-     * Настройка последовательного порта, пина управления RS485 и таймаутов.
+     * Инициализирует шину, если это ещё не было сделано другим объектом.
      */
     void begin();
 
@@ -186,10 +309,32 @@ public:
     ~HS321() = default;
 
     /**
-     * @brief Проверяет, была ли успешная инициализация класса.
+     * @brief Проверяет, была ли успешная инициализация шины.
      * @return true, если инициализация прошла успешно, иначе false.
      */
-    bool isInitialized() const { return _initialized; }
+    bool isInitialized() const { return _bus->isInitialized(); }
+
+    /**
+     * @brief Адрес ведомого устройства.
+     * @return Адрес частотника в сети Modbus.
+     */
+    uint8_t slaveAddress() const { return _slaveAddress; }
+
+    /**
+     * @brief Шина, к которой подключён частотник.
+     * @return Указатель на шину Modbus.
+     */
+    ModbusBus* bus() const { return _bus; }
+
+    /**
+     * @brief Построение полного адреса параметра.
+     * @param group Группа параметра.
+     * @param subAddress Порядковый номер параметра в группе.
+     * @return Полный 16-битный адрес регистра Modbus.
+     */
+    static constexpr uint16_t buildParameterAddress(const GroupsParameter group, const uint8_t subAddress) {
+        return ((static_cast<uint16_t>(group) << 8) | subAddress);
+    }
 
     /**
      * @brief Чтение кода текущей ошибки.
@@ -250,41 +395,278 @@ public:
      */
     bool writeParametersInGroups(GroupsParameter group, uint8_t numberGroup, const uint16_t* arrayData, size_t dataCount) const;
 
+    /**
+     * @brief Чтение параметра с преобразованием в фиксированную точку по каталогу.
+     *
+     * Количество знаков после запятой берётся из каталога параметров; регистр параметров
+     * с отрицательным минимумом читается как знаковый.
+     *
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @param value Значение (например, value = 5000, decimals = 2 для 50.00 Гц).
+     * @return true в случае успеха, иначе false (нет в каталоге, строковый параметр, ошибка связи).
+     */
+    bool readScaled(GroupsParameter group, uint8_t numberGroup, ScaledValue& value) const;
+
+    /**
+     * @brief Запись параметра из фиксированной точки с проверкой диапазона по каталогу.
+     *
+     * Значение приводится к количеству знаков параметра и проверяется по minSetting/maxSetting
+     * до отправки кадра, поэтому значение вне диапазона не доходит до частотника.
+     *
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @param value Записываемое значение (с любым количеством знаков после запятой).
+     * @return true в случае успеха, иначе false (нет в каталоге, строковый параметр, вне диапазона, ошибка связи).
+     */
+    bool writeScaled(GroupsParameter group, uint8_t numberGroup, const ScaledValue& value) const;
+
     /**
      * @brief Проверка корректности настроек связи.
      * @return true, если связь работает, иначе false.
      */
     bool checkCommunicationSettings() const;
 
+    /**
+     * @brief Поиск скорости, на которой отвечает частотник.
+     *
+     * Опрашивает FC.00 на текущей скорости шины, затем на всех скоростях FC.00 от 38400
+     * до 1200 с коротким тайм-аутом (BAUD_PROBE_TIMEOUT). Ответ принимается, только если
+     * FC.00 совпадает со скоростью, на которой он получен.
+     *
+     * @return true, если скорость найдена (шина остаётся на ней), иначе false (шина возвращается на исходную скорость).
+     */
+    bool detectBaudRate();
+
+    /**
+     * @brief Перевод частотника и шины на другую скорость.
+     *
+     * Записывает код скорости в FC.00 на текущей скорости, перенастраивает шину
+     * (ModbusBus::setBaud()) и проверяет связь чтением FC.00. Если на новой скорости
+     * частотник не отвечает, выполняется откат: попытка вернуть прежний код FC.00
+     * и возврат шины на прежнюю скорость.
+     *
+     * Скорость шины общая для всех ведомых: на шине с несколькими частотниками
+     * их нужно переводить по очереди, пока остальные временно недоступны. На шине со
+     * скоростью, заданной при компиляции (StaticModbusBus), другая скорость отклоняется
+     * без записи FC.00.
+     *
+     * @param baud Скорость из FC.00: 1200, 2400, 4800, 9600, 19200 или 38400.
+     * @return true, если связь на новой скорости подтверждена, иначе false (причина — lastError()).
+     */
+    bool switchBaudRate(unsigned long baud);
+
+    /**
+     * @brief Код FC.00 для скорости.
+     * @param baud Скорость передачи данных.
+     * @param code Код FC.00 (0 — 1200 ... 5 — 38400).
+     * @return true, если скорость поддерживается частотником, иначе false.
+     */
+    static bool baudRateCode(unsigned long baud, uint16_t& code);
+
+    /**
+     * @brief Скорость по коду FC.00.
+     * @param code Код FC.00.
+     * @return Скорость передачи данных или 0 для неизвестного кода.
+     */
+    static unsigned long baudRate(uint16_t code);
+
+    /**
+     * @var BAUD_PROBE_TIMEOUT
+     * @brief Тайм-аут ответа при поиске скорости (мс).
+     */
+    static constexpr unsigned long BAUD_PROBE_TIMEOUT = 100;
+
+    /**
+     * @brief Причина неудачи последнего синхронного вызова.
+     *
+     * Обновляется каждым синхронным методом чтения/записи, включая отказы без обращения к шине
+     * (нет инициализации, неверные аргументы, значение вне диапазона в writeScaled()).
+     *
+     * @return TransactionError::NONE, если последний вызов успешен, иначе причина.
+     */
+    TransactionError lastError() const { return _lastError; }
+
+    /**
+     * @brief Код исключения Modbus последнего синхронного вызова.
+     * @return Код исключения (см. ModbusException) или 0, если ответа-исключения не было.
+     */
+    uint8_t lastExceptionCode() const { return _lastExceptionCode; }
+
+    /**
+     * @brief Рекомендуемая реакция на результат последнего синхронного вызова.
+     * @return Действие по классификации retryAction() (повторить, повторить с задержкой, отказаться).
+     */
+    RetryAction lastRetryAction() const { return retryAction(_lastError, _lastExceptionCode); }
+
+    /**
+     * @brief Асинхронный запуск чтения нескольких параметров из одной группы.
+     *
+     * Ставит запрос в очередь шины, не дожидаясь ответа. Значения будут записаны
+     * в arrayValues только после того, как poll() вернёт TransactionStatus::COMPLETED,
+     * поэтому буфер должен оставаться доступным до завершения транзакции.
+     *
+     * @param group Группа параметров.
+     * @param numberGroup Начальный номер параметра.
+     * @param arrayValues Массив для записи значений.
+     * @param count Количество параметров для чтения.
+     * @return true, если транзакция поставлена в очередь, иначе false (нет инициализации, предыдущая
+     *         транзакция объекта не завершена, очередь заполнена, неверные аргументы).
+     */
+    bool beginReadParametersInGroups(GroupsParameter group, uint8_t numberGroup, uint16_t* arrayValues, size_t count);
+
+    /**
+     * @brief Асинхронный запуск записи нескольких значений в параметры одной группы.
+     *
+     * Данные копируются в кадр запроса в момент начала передачи, поэтому arrayData
+     * должен оставаться доступным до завершения транзакции.
+     *
+     * @param group Группа параметров.
+     * @param numberGroup Начальный номер параметра.
+     * @param arrayData Массив значений для записи.
+     * @param dataCount Количество записываемых значений.
+     * @return true, если транзакция поставлена в очередь, иначе false.
+     */
+    bool beginWriteParametersInGroups(GroupsParameter group, uint8_t numberGroup, const uint16_t* arrayData, size_t dataCount);
+
+    /**
+     * @brief Асинхронная отправка команды управления двигателем.
+     *
+     * Команда ставится в срочную очередь шины и выполняется раньше ожидающих опросов.
+     * Её состояние отслеживается отдельно от транзакций параметров (см. commandStatus()).
+     *
+     * @param command Команда из перечисления ControlCommand.
+     * @return true, если транзакция поставлена в очередь, иначе false.
+     */
+    bool beginWriteControlCommand(ControlCommand command);
+
+    /**
+     * @brief Продвижение асинхронной транзакции.
+     *
+     * Должен вызываться из loop() как можно чаще. Продвигает общую шину (см. ModbusBus::poll()),
+     * поэтому вместе с транзакцией этого объекта выполняются и транзакции других частотников.
+     *
+     * @return Текущее состояние транзакции объекта.
+     */
+    TransactionStatus poll();
+
+    /**
+     * @brief Состояние последней запущенной транзакции.
+     * @return TransactionStatus последней транзакции.
+     */
+    TransactionStatus transactionStatus() const { return _transaction.status; }
+
+    /**
+     * @brief Состояние последней команды, отправленной beginWriteControlCommand().
+     * @return TransactionStatus последней команды.
+     */
+    TransactionStatus commandStatus() const { return _command.status; }
+
+    /**
+     * @brief Код исключения Modbus из последнего ответа-исключения.
+     * @return Код исключения (1 — неверная функция, 2 — неверный адрес данных, 3 — неверное значение и т.д.)
+     *         или 0, если последняя транзакция не завершилась исключением.
+     */
+    uint8_t exceptionCode() const { return _transaction.exceptionCode; }
+
+    /**
+     * @brief Причина неудачи последней асинхронной транзакции.
+     * @return TransactionError::NONE или причина (см. ModbusTransaction::retryAction()).
+     */
+    TransactionError transactionError() const { return _transaction.error; }
+
+    /**
+     * @brief Причина неудачи последней команды, отправленной beginWriteControlCommand().
+     * @return TransactionError::NONE или причина.
+     */
+    TransactionError commandError() const { return _command.error; }
+
+    /**
+     * @brief Статистика обмена с частотником.
+     *
+     * Учитываются синхронные и асинхронные транзакции объекта, а также транзакции,
+     * подключённые через attachStats() (BatchReader, MonitorScheduler).
+     *
+     * @return Ссылка на счётчики обмена.
+     */
+    const TransactionStats& stats() const { return _stats; }
+
+    /**
+     * @brief Сброс статистики обмена с частотником.
+     */
+    void resetStats() { _stats = TransactionStats(); }
+
+    /**
+     * @brief Подключение транзакции к статистике обмена с частотником.
+     * @param transaction Транзакция, адресованная этому частотнику.
+     */
+    void attachStats(ModbusTransaction& transaction) const { transaction.stats = &_stats; }
+
+    /**
+     * @brief Проверяет, выполняется ли сейчас асинхронная транзакция объекта.
+     * @return true, если транзакция в очереди или выполняется, иначе false.
+     */
+    bool isBusy() const { return _transaction.status == TransactionStatus::PENDING; }
+
+    /**
+     * @brief Установка функции обратного вызова для асинхронных транзакций.
+     *
+     * Вызывается из poll() один раз по завершении каждой транзакции, запущенной методами begin*().
+     *
+     * @param callback Функция обратного вызова (nullptr — отключить).
+     * @param context Пользовательский указатель, передаваемый в callback.
+     */
+    void onTransactionComplete(TransactionCallback callback, void* context = nullptr);
+
 private:
-    bool _initialized = false;               ///< Флаг успешной инициализации
+    ModbusBus* _bus;                         ///< Шина, к которой подключён частотник
     uint8_t _slaveAddress;                   ///< Адрес Modbus-устройства
-    HardwareSerial* _serialPort;             ///< Порт для связи с частотником
-    HardwareSerial* _serialDebug;            ///< Порт для отладочного вывода
-    unsigned long _baud;                     ///< Скорость передачи данных
-    uint8_t _transmitterModeContact;         ///< Пин управления направлением RS485
-    unsigned long _totalTimeout;             ///< Общий таймаут ожидания ответа (мс)
-    unsigned long _interCharTimeout;         ///< Таймаут между символами (мс)
+    ModbusTransaction _transaction;          ///< Транзакция асинхронного чтения/записи параметров
+    ModbusTransaction _command;              ///< Транзакция асинхронной команды управления
+    mutable TransactionError _lastError = TransactionError::NONE; ///< Причина неудачи последнего синхронного вызова
+    mutable uint8_t _lastExceptionCode = 0;  ///< Код исключения последнего синхронного вызова
+    mutable TransactionStats _stats;         ///< Статистика обмена с частотником
 
     /**
-     * @enum CodeFunction
-     * @brief Коды функций Modbus, используемые в классе.
+     * @brief Выполнение транзакции с ожиданием и сохранением результата для lastError().
+     * @param transaction Подготовленная транзакция.
+     * @return true, если транзакция завершилась успешно, иначе false.
      */
-    enum CodeFunction : uint8_t {
-        READ = 0x03,       ///< Функция Modbus 0x03 — чтение регистров
-        WRITE_ONE = 0x06,  ///< Функция Modbus 0x06 — запись одного регистра
-        WRITE_RANGE = 0x10 ///< Функция Modbus 0x10 — запись нескольких регистров
-    };
+    bool execute(ModbusTransaction& transaction) const;
 
     /**
-     * @brief Построение полного адреса параметра.
-     * @param group Группа параметра.
-     * @param subAddress Порядковый номер параметра в группе.
-     * @return Полный 16-битный адрес регистра Modbus.
+     * @brief Отказ синхронного вызова без обращения к шине.
+     * @param error Причина отказа.
+     * @return Всегда false.
      */
-    static constexpr uint16_t buildParameterAddress(const GroupsParameter group, const uint8_t subAddress) {
-        return ((static_cast<uint16_t>(group) << 8) | subAddress);
-    }
+    bool reject(TransactionError error) const;
+
+    /**
+     * @brief Отказ из-за неверных аргументов (или NOT_INITIALIZED, если шина не инициализирована).
+     * @return Всегда false.
+     */
+    bool rejectRequest() const;
+
+    /**
+     * @brief Проверка связи на текущей скорости шины чтением FC.00.
+     * @param code Ожидаемый код скорости в FC.00.
+     * @param attempts Количество попыток чтения.
+     * @return true, если FC.00 прочитан и равен code, иначе false.
+     */
+    bool confirmBaudRate(uint16_t code, uint8_t attempts) const;
+
+    /**
+     * @brief Приостановка учёта состояния связи с частотником на время смены или поиска скорости.
+     * @return Политика учёта, действовавшая до вызова.
+     */
+    HealthPolicy suspendHealthTracking() const;
+
+    /**
+     * @brief Возобновление учёта состояния связи с частотником.
+     * @param policy Политика, возвращённая suspendHealthTracking().
+     * @param confirmed Связь подтверждена: накопленная статистика ведомого сбрасывается.
+     */
+    void resumeHealthTracking(const HealthPolicy& policy, bool confirmed) const;
 
     /**
      * @brief Чтение одного регистра Modbus.
@@ -303,7 +685,7 @@ private:
     bool writeSingleParameter(uint16_t address, uint16_t value) const;
 
     /**
-     * @brief Чтение нескольких регистров Modbus.
+     * @brief Чтение нескольких регистров Modbus с ожиданием ответа.
      * @param slaveAddress Адрес ведомого.
      * @param startAddress Адрес первого регистра.
      * @param arrayValues Массив для хранения прочитанных значений.
@@ -313,7 +695,7 @@ private:
     bool readParameters(uint8_t slaveAddress, uint16_t startAddress, uint16_t* arrayValues, size_t numberRegisters = 1) const;
 
     /**
-     * @brief Запись нескольких регистров Modbus.
+     * @brief Запись нескольких регистров Modbus с ожиданием ответа.
      * @param slaveAddress Адрес ведомого.
      * @param startAddress Адрес первого регистра.
      * @param arrayValues Массив значений для записи.
@@ -321,37 +703,4 @@ private:
      * @return true при успехе, иначе false.
      */
     bool writeParameters(uint8_t slaveAddress, uint16_t startAddress, const uint16_t* arrayValues, size_t numberRegisters) const;
-
-    /**
-     * @brief Проверка корректности ответа Modbus.
-     * @param response Указатель на буфер с ответом.
-     * @param responseSize Размер ответа.
-     * @param expectedAddress Ожидаемый адрес устройства.
-     * @param expectedFunction Ожидаемая функция.
-     * @return true, если ответ корректен, иначе false.
-     */
-    bool validateModbusResponse(const uint8_t* response, size_t responseSize, uint8_t expectedAddress, uint8_t expectedFunction) const;
-
-    /**
-     * @brief Вычисление CRC16 для пакета Modbus.
-     * @param data Указатель на данные.
-     * @param length Длина данных.
-     * @return Рассчитанное значение CRC16.
-     */
-    uint16_t calculateCRC(const uint8_t* data, uint8_t length) const;
-
-    /**
-     * @brief Отправка данных через последовательный порт.
-     * @param data Указатель на массив данных.
-     * @param length Количество байт для отправки.
-     */
-    void sendData(const uint8_t* data, size_t length) const;
-
-    /**
-     * @brief Приём данных с ожиданием.
-     * @param buffer Буфер для записи принятых данных.
-     * @param length Ожидаемое количество байт.
-     * @return true при успешном приёме, иначе false.
-     */
-    bool receiveData(uint8_t* buffer, size_t length) const;
 };
@@ -0,0 +1,250 @@
+#pragma once
+
+/** @file HS321Config.h
+ * @brief Настройки сборки библиотеки: выбор возможностей и размеры статических буферов.
+ *
+ * Все буферы библиотеки — члены классов с размером, заданным при компиляции; динамическая
+ * память не используется, а наибольший буфер на стеке — largestGroupSize() регистров
+ * (112 байт) в RegisterCache::load() и DriveProfile. Объём ОЗУ определяется только тем,
+ * какие объекты создаёт приложение, и выводится HS321Footprint.h.
+ *
+ * Любое значение переопределяется флагом сборки (например, -DHS321_BUS_QUEUE_SIZE=4 в
+ * build_flags PlatformIO). Флаг -DHS321_SMALL_FOOTPRINT выбирает уменьшенные значения
+ * по умолчанию для плат с 2 КБ ОЗУ (Uno, Nano):
+ *
+ * | Настройка              | Обычно | SMALL_FOOTPRINT |
+ * |------------------------|--------|-----------------|
+ * | HS321_MAX_FRAME_SIZE   | 256    | 128             |
+ * | HS321_BUS_QUEUE_SIZE   | 8      | 2               |
+ * | HS321_BUS_MAX_SLAVES   | 8      | 2               |
+ * | HS321_BUS_GROUP_SIZE   | 4      | 2               |
+ * | HS321_BATCH_SIZE       | 32     | 8               |
+ * | HS321_BATCH_MAX_SPAN   | 125    | 32              |
+ * | HS321_PROFILE_SIZE     | 64     | 16              |
+ * | HS321_FAULT_EVENTS     | 4      | 1               |
+ * | HS321_TRACE_SIZE       | 256    | 64              |
+ * | HS321_ENABLE_TRACE     | 1      | 0               |
+ * | HS321_ENABLE_FAULT_TEXT| 1      | 0               |
+ * | HS321_CRC_NIBBLE_TABLE | нет    | да              |
+ *
+ * @author Dmitry Chernikov
+ */
+
+// --- Возможности (1 — включено, 0 — исключено из сборки) ---
+
+/**
+ * @def HS321_ENABLE_CATALOG
+ * @brief Каталог параметров во Flash (ParameterGroup, ParametersHS321::getParameter(), readScaled()/writeScaled()).
+ *
+ * Без каталога поиск параметров всегда завершается неудачей, а чтение и запись
+ * в фиксированной точке отклоняются с ошибкой INVALID_REQUEST; доступ к регистрам
+ * по адресу не меняется.
+ */
+#ifndef HS321_ENABLE_CATALOG
+#define HS321_ENABLE_CATALOG 1
+#endif
+
+/**
+ * @def HS321_ENABLE_FAULT_TEXT
+ * @brief Причины и способы устранения ошибок в таблице кодов ошибок (около 4 КБ Flash).
+ *
+ * Без них ParametersHS321::getFaultInfo() возвращает только название ошибки.
+ */
+#ifndef HS321_ENABLE_FAULT_TEXT
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_ENABLE_FAULT_TEXT 0
+#else
+#define HS321_ENABLE_FAULT_TEXT 1
+#endif
+#endif
+
+/**
+ * @def HS321_ENABLE_TRACE
+ * @brief Трассировка кадров шины (ModbusTrace, ModbusBus::setTrace()).
+ */
+#ifndef HS321_ENABLE_TRACE
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_ENABLE_TRACE 0
+#else
+#define HS321_ENABLE_TRACE 1
+#endif
+#endif
+
+/**
+ * @def HS321_ENABLE_BATCH_READER
+ * @brief Пакетное чтение разрозненных регистров (BatchReader).
+ */
+#ifndef HS321_ENABLE_BATCH_READER
+#define HS321_ENABLE_BATCH_READER 1
+#endif
+
+/**
+ * @def HS321_ENABLE_CACHE
+ * @brief Зеркало регистров в ОЗУ (RegisterCache) и шлюз Modbus (ModbusGateway), работающий поверх него.
+ */
+#ifndef HS321_ENABLE_CACHE
+#define HS321_ENABLE_CACHE 1
+#endif
+
+/**
+ * @def HS321_ENABLE_RTOS
+ * @brief Потокобезопасная работа шины во FreeRTOS (ModbusBus::startTask()).
+ *
+ * Включается автоматически на ESP32. Для STM32 с библиотекой STM32FreeRTOS задаётся
+ * флагом сборки -DHS321_ENABLE_RTOS=1.
+ */
+#ifndef HS321_ENABLE_RTOS
+#if defined(ARDUINO_ARCH_ESP32)
+#define HS321_ENABLE_RTOS 1
+#else
+#define HS321_ENABLE_RTOS 0
+#endif
+#endif
+
+// --- Размеры буферов ---
+
+/**
+ * @def HS321_MAX_FRAME_SIZE
+ * @brief Наибольший кадр Modbus RTU в байтах (буферы ModbusBus и ModbusGateway).
+ *
+ * Ограничивает количество регистров в одном кадре: (HS321_MAX_FRAME_SIZE − 5) / 2 при чтении
+ * и (HS321_MAX_FRAME_SIZE − 9) / 2 при записи. Должен вмещать чтение самой большой группы
+ * (не меньше 117 байт); 256 — максимум по спецификации Modbus.
+ */
+#ifndef HS321_MAX_FRAME_SIZE
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_MAX_FRAME_SIZE 128
+#else
+#define HS321_MAX_FRAME_SIZE 256
+#endif
+#endif
+
+/**
+ * @def HS321_BUS_QUEUE_SIZE
+ * @brief Ёмкость очереди транзакций шины для каждого приоритета (количество одновременно ожидающих транзакций).
+ */
+#ifndef HS321_BUS_QUEUE_SIZE
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_BUS_QUEUE_SIZE 2
+#else
+#define HS321_BUS_QUEUE_SIZE 8
+#endif
+#endif
+
+/**
+ * @def HS321_BUS_MAX_SLAVES
+ * @brief Количество ведомых, для которых шина ведёт учёт состояния связи (см. SlaveHealth).
+ */
+#ifndef HS321_BUS_MAX_SLAVES
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_BUS_MAX_SLAVES 2
+#else
+#define HS321_BUS_MAX_SLAVES 8
+#endif
+#endif
+
+/**
+ * @def HS321_BUS_GROUP_SIZE
+ * @brief Количество шин (портов), опрашиваемых одной ModbusBusGroup.
+ */
+#ifndef HS321_BUS_GROUP_SIZE
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_BUS_GROUP_SIZE 2
+#else
+#define HS321_BUS_GROUP_SIZE 4
+#endif
+#endif
+
+/**
+ * @def HS321_BATCH_SIZE
+ * @brief Максимальное количество регистров, регистрируемых в одном пакете BatchReader.
+ */
+#ifndef HS321_BATCH_SIZE
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_BATCH_SIZE 8
+#else
+#define HS321_BATCH_SIZE 32
+#endif
+#endif
+
+/**
+ * @def HS321_BATCH_MAX_SPAN
+ * @brief Максимальное количество регистров в одном кадре чтения BatchReader.
+ *
+ * Определяет размер промежуточного буфера пакета (2 байта на регистр); на МК с малым объёмом
+ * ОЗУ его можно уменьшить ценой большего количества кадров. Больше ModbusBus::MAX_READ_REGISTERS
+ * не используется.
+ */
+#ifndef HS321_BATCH_MAX_SPAN
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_BATCH_MAX_SPAN 32
+#else
+#define HS321_BATCH_MAX_SPAN 125
+#endif
+#endif
+
+/**
+ * @def HS321_PROFILE_SIZE
+ * @brief Максимальное количество параметров в профиле DriveProfile (4 байта ОЗУ на параметр).
+ */
+#ifndef HS321_PROFILE_SIZE
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_PROFILE_SIZE 16
+#else
+#define HS321_PROFILE_SIZE 64
+#endif
+#endif
+
+/**
+ * @def HS321_FAULT_EVENTS
+ * @brief Количество хранимых событий аварии FaultWatch (кольцевой буфер, старые события вытесняются).
+ */
+#ifndef HS321_FAULT_EVENTS
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_FAULT_EVENTS 1
+#else
+#define HS321_FAULT_EVENTS 4
+#endif
+#endif
+
+/**
+ * @def HS321_TRACE_SIZE
+ * @brief Размер кольцевого буфера трассировки ModbusTrace в байтах.
+ */
+#ifndef HS321_TRACE_SIZE
+#ifdef HS321_SMALL_FOOTPRINT
+#define HS321_TRACE_SIZE 64
+#else
+#define HS321_TRACE_SIZE 256
+#endif
+#endif
+
+/**
+ * @def HS321_CRC_NIBBLE_TABLE
+ * @brief Использовать таблицу CRC на 16 элементов (полубайтовый алгоритм) вместо таблицы на 256 элементов.
+ *
+ * Таблица на 256 элементов занимает 512 байт Flash и обрабатывает байт за одну выборку.
+ * Полубайтовая таблица занимает 32 байта Flash и требует двух выборок на байт —
+ * вариант для микроконтроллеров с малым объёмом памяти программ.
+ * Определяется в настройках сборки: -DHS321_CRC_NIBBLE_TABLE.
+ */
+#if defined(HS321_SMALL_FOOTPRINT) && !defined(HS321_CRC_NIBBLE_TABLE)
+#define HS321_CRC_NIBBLE_TABLE
+#endif
+
+/**
+ * @def HS321_TASK_STACK_SIZE
+ * @brief Размер стека задачи шины (в единицах xTaskCreate(): байты на ESP32, слова на STM32).
+ */
+#ifndef HS321_TASK_STACK_SIZE
+#if defined(ARDUINO_ARCH_ESP32)
+#define HS321_TASK_STACK_SIZE 4096
+#else
+#define HS321_TASK_STACK_SIZE 512
+#endif
+#endif
+
+static_assert(HS321_MAX_FRAME_SIZE >= 117 && HS321_MAX_FRAME_SIZE <= 256,
+              "HS321_MAX_FRAME_SIZE: кадр должен вмещать чтение самой большой группы (117..256 байт)");
+static_assert(HS321_BUS_QUEUE_SIZE >= 1 && HS321_BUS_QUEUE_SIZE <= 255, "HS321_BUS_QUEUE_SIZE: 1..255");
+static_assert(HS321_FAULT_EVENTS >= 1 && HS321_FAULT_EVENTS <= 255, "HS321_FAULT_EVENTS: 1..255");
@@ -0,0 +1,85 @@
+#pragma once
+
+/** @file HS321Footprint.h
+ * @brief Сводка объёма ОЗУ, занимаемого объектами библиотеки при текущих настройках HS321Config.h.
+ *
+ * Библиотека не использует динамическую память, поэтому ОЗУ приложения складывается из
+ * sizeof() созданных им объектов (плюс буферы HardwareSerial ядра Arduino). Сводка
+ * выводится один раз, например из setup(), и помогает подобрать настройки под плату.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "HS321Config.h"
+#include "HS321.h"
+#include "ModbusBusGroup.h"
+#include "ParametersHS321.h"
+#include "DriveProfile.h"
+#include "FaultWatch.h"
+#include "MonitorScheduler.h"
+#include "SetpointStreamer.h"
+#include "PlcProgram.h"
+#if HS321_ENABLE_TRACE
+#include "ModbusTrace.h"
+#endif
+#if HS321_ENABLE_BATCH_READER
+#include "BatchReader.h"
+#endif
+#if HS321_ENABLE_CACHE
+#include "RegisterCache.h"
+#include "ModbusGateway.h"
+#endif
+
+/**
+ * @brief Вывод строки сводки: название и размер в байтах.
+ * @param out Поток вывода.
+ * @param name Название объекта во Flash.
+ * @param size Размер в байтах.
+ */
+inline void printFootprintLine(Print& out, const __FlashStringHelper* name, const size_t size) {
+    out.print(name);
+    out.print(F(": "));
+    out.print(static_cast<unsigned long>(size));
+    out.println(F(" B"));
+}
+
+/**
+ * @brief Вывод размеров объектов библиотеки и основных настроек сборки.
+ *
+ * Размеры вычисляются при компиляции и не зависят от состояния объектов. Классы,
+ * исключённые настройками HS321_ENABLE_*, в сводку не входят.
+ *
+ * @param out Поток вывода (например, Serial).
+ */
+inline void printFootprint(Print& out) {
+    out.print(F("HS321: кадр "));
+    out.print(static_cast<unsigned long>(ModbusBus::MAX_FRAME_SIZE));
+    out.print(F(" B, очередь "));
+    out.print(static_cast<unsigned long>(HS321_BUS_QUEUE_SIZE));
+    out.print(F(" x "));
+    out.print(static_cast<unsigned long>(TransactionPriority::COUNT));
+    out.print(F(", ведомых "));
+    out.println(static_cast<unsigned long>(HS321_BUS_MAX_SLAVES));
+    printFootprintLine(out, F("ModbusBus"), sizeof(ModbusBus));
+    printFootprintLine(out, F("ModbusTransaction"), sizeof(ModbusTransaction));
+    printFootprintLine(out, F("ModbusBusGroup"), sizeof(ModbusBusGroup));
+    printFootprintLine(out, F("HS321"), sizeof(HS321));
+    printFootprintLine(out, F("ParametersHS321"), sizeof(ParametersHS321));
+    printFootprintLine(out, F("DriveProfile"), sizeof(DriveProfile));
+    printFootprintLine(out, F("FaultWatch"), sizeof(FaultWatch));
+    printFootprintLine(out, F("MonitorScheduler"), sizeof(MonitorScheduler));
+    printFootprintLine(out, F("SetpointStreamer"), sizeof(SetpointStreamer));
+    printFootprintLine(out, F("PlcProgram"), sizeof(PlcProgram));
+#if HS321_ENABLE_TRACE
+    printFootprintLine(out, F("ModbusTrace"), sizeof(ModbusTrace));
+#endif
+#if HS321_ENABLE_BATCH_READER
+    printFootprintLine(out, F("BatchReader"), sizeof(BatchReader));
+#endif
+#if HS321_ENABLE_CACHE
+    printFootprintLine(out, F("RegisterCache"), sizeof(RegisterCache));
+    printFootprintLine(out, F("ModbusGateway"), sizeof(ModbusGateway));
+#endif
+    // Наибольший буфер на стеке: чтение группы целиком (RegisterCache::load(), DriveProfile)
+    printFootprintLine(out, F("Стек (группа)"), largestGroupSize() * sizeof(uint16_t));
+}
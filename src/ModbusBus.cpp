@@ -0,0 +1,1451 @@
+#include "ModbusBus.h"
+#include "ModbusBusGroup.h"
+
+/** @file ModbusBus.cpp
+ * @brief Реализация ведущего шины Modbus RTU, общей для нескольких частотников HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+//#define DEBUG
+//#define DEBUG_sendData
+
+// Размер буфера передачи HardwareSerial, если ядро платформы его не объявляет
+#ifndef SERIAL_TX_BUFFER_SIZE
+#define SERIAL_TX_BUFFER_SIZE 64
+#endif
+
+/**
+ * @brief Подготовка транзакции чтения регистров.
+ *
+ * @param slave Адрес ведомого устройства.
+ * @param address Адрес первого регистра.
+ * @param target Буфер для прочитанных значений.
+ * @param registers Количество регистров.
+ */
+void ModbusTransaction::setRead(const uint8_t slave, const uint16_t address, uint16_t* target, const size_t registers) {
+    slaveAddress = slave;
+    function = ModbusBus::READ;
+    startAddress = address;
+    values = target;
+    count = registers;
+}
+
+/**
+ * @brief Подготовка транзакции записи регистров.
+ *
+ * Для одного регистра выбирается функция 0x06, для диапазона — 0x10.
+ *
+ * @param slave Адрес ведомого устройства.
+ * @param address Адрес первого регистра.
+ * @param source Массив значений для записи.
+ * @param registers Количество регистров.
+ */
+void ModbusTransaction::setWrite(const uint8_t slave, const uint16_t address, const uint16_t* source, const size_t registers) {
+    slaveAddress = slave;
+    function = (registers == 1) ? ModbusBus::WRITE_ONE : ModbusBus::WRITE_RANGE;
+    startAddress = address;
+    // Буфер при записи только читается
+    values = const_cast<uint16_t*>(source);
+    count = registers;
+}
+
+/**
+ * @brief Подготовка записи одного регистра со значением, хранящимся в самой транзакции.
+ *
+ * @param slave Адрес ведомого устройства.
+ * @param address Адрес регистра.
+ * @param value Значение для записи.
+ */
+void ModbusTransaction::setWriteSingle(const uint8_t slave, const uint16_t address, const uint16_t value) {
+    singleValue = value;
+    setWrite(slave, address, &singleValue, 1);
+}
+
+/**
+ * @brief Классификация ошибки транзакции для логики повторов.
+ *
+ * Помехи на линии (CRC, оборванный кадр, чужой адрес, неверная длина) обычно случайны,
+ * и запрос можно повторить сразу. Тайм-аут, занятость ведомого и заполненная очередь
+ * говорят о перегрузке: немедленный повтор её только усиливает. Неверный адрес, значение
+ * или функция не исправятся повтором.
+ *
+ * @param error Причина неудачи.
+ * @param exceptionCode Код исключения Modbus (для error == EXCEPTION).
+ * @return Рекомендуемое действие.
+ */
+RetryAction retryAction(const TransactionError error, const uint8_t exceptionCode) {
+    switch (error) {
+        case TransactionError::NONE:
+            return RetryAction::NONE;
+        case TransactionError::CRC:
+        case TransactionError::INCOMPLETE_FRAME:
+        case TransactionError::WRONG_SLAVE:
+        case TransactionError::WRONG_FUNCTION:
+        case TransactionError::WRONG_LENGTH:
+            return RetryAction::RETRY;
+        case TransactionError::TIMEOUT:
+        case TransactionError::QUEUE_FULL:
+        case TransactionError::SLAVE_OFFLINE:
+            return RetryAction::BACKOFF;
+        case TransactionError::EXCEPTION:
+            switch (static_cast<ModbusException>(exceptionCode)) {
+                case ModbusException::ACKNOWLEDGE:
+                case ModbusException::SLAVE_DEVICE_BUSY:
+                case ModbusException::GATEWAY_TARGET_FAILED:
+                    return RetryAction::BACKOFF;
+                default:
+                    return RetryAction::ABANDON;
+            }
+        default:
+            return RetryAction::ABANDON;
+    }
+}
+
+/**
+ * @brief Конструктор класса ModbusBus.
+ *
+ * @param serialPort Объект HardwareSerial, используемый для связи с частотниками.
+ * @param serialDebug Объект HardwareSerial для вывода отладочной информации.
+ * @param baud Скорость передачи данных (например, 9600, 19200, 38400).
+ * @param transmitterModeContact Номер цифрового пина, управляющего направлением передачи RS485 (DE/RE).
+ */
+ModbusBus::ModbusBus(HardwareSerial& serialPort, HardwareSerial& serialDebug, const unsigned long baud, const uint8_t transmitterModeContact)
+                                                                :_serialPort(&serialPort),
+                                                                _serialDebug(&serialDebug),
+                                                                _baud(baud),
+                                                                _transmitterModeContact(transmitterModeContact),
+                                                                _totalTimeout(2000),
+                                                                // Тайм-аут между байтами кадра MODBUS 3.5 символов (см. modbusFrameGap())
+                                                                _interCharTimeout(modbusFrameGap(baud)),
+                                                                // Время символа для оценки опустошения передатчика без деления в каждой транзакции
+                                                                _characterTime(modbusCharacterTime(baud)){
+}
+
+/**
+ * @brief Конструктор шины с параметрами, вычисленными при компиляции.
+ *
+ * Скорость такой шины не меняется (см. setBaud()).
+ *
+ * @param serialPort Объект HardwareSerial, используемый для связи с частотниками.
+ * @param serialDebug Порт отладочной информации (nullptr — без отладочного вывода).
+ * @param baud Скорость передачи данных.
+ * @param transmitterModeContact Номер цифрового пина, управляющего направлением передачи RS485 (DE/RE).
+ * @param config Тайм-ауты и регистр пина DE/RE.
+ */
+ModbusBus::ModbusBus(HardwareSerial& serialPort, HardwareSerial* serialDebug, const unsigned long baud, const uint8_t transmitterModeContact,
+                     const FixedBusConfig& config)
+                                                                :_serialPort(&serialPort),
+                                                                _serialDebug(serialDebug),
+                                                                _baud(baud),
+                                                                _transmitterModeContact(transmitterModeContact),
+                                                                _totalTimeout(2000),
+                                                                _interCharTimeout(config.frameGap),
+                                                                _characterTime(config.characterTime),
+                                                                _baudFixed(true){
+#ifdef __AVR__
+    _dePort = reinterpret_cast<volatile uint8_t*>(config.directionPort);
+    _deMask = config.directionMask;
+#endif
+}
+
+/**
+ * @brief Инициализация шины и настройка аппаратных параметров.
+ *
+ * Настраивает последовательный порт, пин управления RS485 и тайм-ауты для корректной работы с протоколом Modbus.
+ * После успешной инициализации устанавливает флаг _initialized = true.
+ */
+void ModbusBus::begin() {
+    // Проверка указателей
+    if (_serialPort == nullptr) {
+        if (_serialDebug != nullptr) {
+            _serialDebug->println(F("Ошибка: _serialPort не должен быть nullptr"));
+        }
+        _initialized = false;
+        return;
+    }
+
+    if (_serialDebug == nullptr) {
+        // Отладочный порт может быть nullptr — это допустимо
+        // Можно работать без отладки
+    } else {
+        _serialDebug->begin(_baud, SERIAL_8N1);
+    }
+
+    // Инициализация порта, SERIAL_8N1 — 8 бит данных, без паритета, 1 стоп-бит по умолчанию в библиотеке Arduino
+    _serialPort->begin(_baud);
+
+    // Настройка пина режима RS485, управляющего направлением передачи данных (DE/RE) модуля RS485 на микросхеме MAX485
+    pinMode(_transmitterModeContact, OUTPUT);
+#ifdef __AVR__
+    // Регистр и маска пина для прямой записи в порт без digitalWrite(), если не заданы при компиляции
+    if (_dePort == nullptr) {
+        _dePort = portOutputRegister(digitalPinToPort(_transmitterModeContact));
+        _deMask = digitalPinToBitMask(_transmitterModeContact);
+    }
+#endif
+    // По умолчанию — приём (переводим модуль в режим приёма данных)
+    setTransmitMode(false);
+
+#ifdef HS321_TX_ISR
+    // Определение аппаратного USART для передачи кадра по прерыванию TXC
+    _txUsart = NO_USART;
+#if defined(HAVE_HWSERIAL0)
+    if (_serialPort == &Serial) {
+        _txUsart = 0; _ucsra = &UCSR0A; _ucsrb = &UCSR0B; _udr = &UDR0;
+    }
+#endif
+#if defined(HAVE_HWSERIAL1)
+    if (_serialPort == &Serial1) {
+        _txUsart = 1; _ucsra = &UCSR1A; _ucsrb = &UCSR1B; _udr = &UDR1;
+    }
+#endif
+#if defined(HAVE_HWSERIAL2)
+    if (_serialPort == &Serial2) {
+        _txUsart = 2; _ucsra = &UCSR2A; _ucsrb = &UCSR2B; _udr = &UDR2;
+    }
+#endif
+#if defined(HAVE_HWSERIAL3)
+    if (_serialPort == &Serial3) {
+        _txUsart = 3; _ucsra = &UCSR3A; _ucsrb = &UCSR3B; _udr = &UDR3;
+    }
+#endif
+    if (_txUsart != NO_USART) {
+        _txOwners[_txUsart] = this;
+    }
+#endif
+
+    // Тайм-ауты вычислены в конструкторе (тайм-аут ответа — 2 секунды по умолчанию, см. setResponseTimeout())
+
+    // Установка флага инициализации и вывод отладочной информации
+    _initialized = true;
+
+    if (_serialDebug) {
+        _serialDebug->println(F("ModbusBus: Инициализация завершена"));
+    }
+}
+
+/**
+ * @brief Смена скорости шины между транзакциями.
+ *
+ * Дожидается выхода последнего байта, перенастраивает порт, отбрасывает принятые
+ * на старой скорости байты и пересчитывает паузу t3.5 и время символа.
+ * Скорость шины, заданная при компиляции, не меняется.
+ *
+ * @param baud Новая скорость передачи данных.
+ * @return true, если скорость изменена (или совпадает с заданной при компиляции), иначе false.
+ */
+bool ModbusBus::setBaud(const unsigned long baud) {
+    if (_baudFixed) {
+        return baud == _baud;
+    }
+    if (baud == 0 || _current != nullptr) {
+        return false;
+    }
+    _baud = baud;
+    _interCharTimeout = modbusFrameGap(baud);
+    _characterTime = modbusCharacterTime(baud);
+    if (!_initialized) {
+        return true;
+    }
+    _serialPort->flush();
+    _serialPort->end();
+    _serialPort->begin(baud);
+    while (_serialPort->available() > 0) {
+        _serialPort->read();
+    }
+#ifdef DEBUG
+    if (_serialDebug != nullptr) {
+        _serialDebug->print(F("ModbusBus: скорость "));
+        _serialDebug->println(baud);
+    }
+#endif
+    return true;
+}
+
+/**
+ * @brief Постановка транзакции в очередь шины.
+ *
+ * Проверяет параметры транзакции, переводит её в состояние PENDING и помещает в конец
+ * очереди её приоритета. Сама передача начинается в poll().
+ *
+ * При отказе причина сохраняется в transaction.error (кроме повторной постановки
+ * транзакции, которая уже в очереди: её состояние не изменяется).
+ *
+ * @param transaction Подготовленная транзакция.
+ * @return true, если транзакция поставлена в очередь, иначе false.
+ */
+bool ModbusBus::submit(ModbusTransaction& transaction) {
+    if (transaction.status == TransactionStatus::PENDING) {
+        return false;
+    }
+    transaction.exceptionCode = 0;
+    if (!_initialized) {
+        transaction.error = TransactionError::NOT_INITIALIZED;
+        return false;
+    }
+
+    // Любой отказ ниже, кроме заполненной очереди, — неверный запрос
+    transaction.error = TransactionError::INVALID_REQUEST;
+
+    // Проверки входных данных и корректности указателя на массив
+    if (transaction.values == nullptr || transaction.count == 0) {
+        return false;
+    }
+
+    // Проверка на максимальное количество регистров (Modbus ограничение)
+    switch (transaction.function) {
+        case READ:
+            // Чтение ограничено размером кадра (125 регистров по спецификации), ответа на широковещательное чтение нет
+            if (transaction.count > MAX_READ_REGISTERS || transaction.slaveAddress == BROADCAST_ADDRESS) {
+                return false;
+            }
+            break;
+        case WRITE_ONE:
+            if (transaction.count != 1) {
+                return false;
+            }
+            break;
+        case WRITE_RANGE:
+            if (transaction.count > MAX_WRITE_REGISTERS) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+
+    if (static_cast<uint8_t>(transaction.priority) >= static_cast<uint8_t>(TransactionPriority::COUNT)) {
+        return false;
+    }
+    // Поля заполняются до постановки в очередь: задача шины может запустить транзакцию сразу
+    transaction.error = TransactionError::NONE;
+    transaction.attempt = 1;
+    transaction.notBefore = millis();
+    if (!enqueue(transaction)) {
+        transaction.error = TransactionError::QUEUE_FULL;
+#ifdef DEBUG
+        if (_serialDebug != nullptr) {
+            _serialDebug->println(F("Ошибка: очередь шины заполнена"));
+        }
+#endif
+        return false;
+    }
+#if HS321_ENABLE_RTOS
+    if (foreignTask()) {
+        xTaskNotifyGive(_task);
+    }
+#endif
+    return true;
+}
+
+/**
+ * @brief Постановка транзакции в конец очереди её приоритета.
+ *
+ * @param transaction Транзакция с допустимым приоритетом.
+ * @return true, если в очереди было место, иначе false.
+ */
+bool ModbusBus::enqueue(ModbusTransaction& transaction) {
+    TransactionQueue& queue = _queues[static_cast<uint8_t>(transaction.priority)];
+    lockQueues();
+    if (queue.count >= HS321_BUS_QUEUE_SIZE) {
+        queue.stats.rejected++;
+        unlockQueues();
+        return false;
+    }
+    transaction.status = TransactionStatus::PENDING;
+    transaction.queuedAt = millis();
+    queue.items[(queue.head + queue.count) % HS321_BUS_QUEUE_SIZE] = &transaction;
+    queue.count++;
+    queue.stats.depth = queue.count;
+    if (queue.count > queue.stats.maxDepth) {
+        queue.stats.maxDepth = queue.count;
+    }
+    unlockQueues();
+    return true;
+}
+
+/**
+ * @brief Выполнение транзакции с ожиданием её завершения.
+ *
+ * Сохраняет поведение прежнего блокирующего API: крутит poll() до получения итогового состояния.
+ * Если шину продвигает задача FreeRTOS, вызывающая задача спит до уведомления о завершении.
+ *
+ * @param transaction Подготовленная транзакция.
+ * @return true, если транзакция завершилась успешно, иначе false.
+ */
+bool ModbusBus::execute(ModbusTransaction& transaction) {
+#if HS321_ENABLE_RTOS
+    const bool wait = foreignTask();
+    transaction.waiter = wait ? xTaskGetCurrentTaskHandle() : nullptr;
+#endif
+    if (!submit(transaction)) {
+#if HS321_ENABLE_RTOS
+        transaction.waiter = nullptr;
+#endif
+        return false;
+    }
+#if HS321_ENABLE_RTOS
+    if (wait) {
+        // Уведомление приходит после записи итогового состояния; посторонние уведомления пропускаются
+        while (transaction.status == TransactionStatus::PENDING) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+        return transaction.status == TransactionStatus::COMPLETED;
+    }
+#endif
+    while (transaction.status == TransactionStatus::PENDING) {
+        // Ожидание на одном порту не останавливает остальные порты группы
+        if (_group != nullptr) {
+            _group->poll();
+        } else {
+            poll();
+        }
+    }
+    return transaction.status == TransactionStatus::COMPLETED;
+}
+
+/**
+ * @brief Продвижение текущей транзакции и запуск следующей из очереди.
+ *
+ * Выполняет один неблокирующий шаг конечного автомата. Если шина свободна и с последнего
+ * байта на линии прошла пауза t3.5 (см. lineIdle()), запускает срочную транзакцию, а если
+ * срочных нет — проверку связи с недоступным ведомым, если подошёл её срок, либо следующую
+ * обычную транзакцию; проверки связи и обычные транзакции чередуются. Обычная транзакция к недоступному ведомому завершается сразу
+ * с ошибкой SLAVE_OFFLINE.
+ *
+ * Если шину продвигает задача FreeRTOS, вызов из другой задачи только сообщает о занятости шины.
+ *
+ * @return true, если на шине есть незавершённые транзакции, иначе false.
+ */
+bool ModbusBus::poll() {
+    if (foreignTask()) {
+        return isBusy();
+    }
+    if (_current == nullptr) {
+        // Новый запрос не сливается с концом предыдущего кадра на линии
+        if (!lineIdle()) {
+            return isBusy();
+        }
+        // Срочная транзакция не ждёт проверки связи с недоступным ведомым
+        ModbusTransaction* next = dequeue(TransactionPriority::URGENT);
+        if (next == nullptr) {
+            // Проверки связи чередуются с обычными транзакциями и не вытесняют их
+            if (!_probeTurnUsed && startProbe()) {
+                _probeTurnUsed = true;
+                return true;
+            }
+            next = dequeue(TransactionPriority::NORMAL);
+            _probeTurnUsed = false;
+            if (next == nullptr && startProbe()) {
+                _probeTurnUsed = true;
+                return true;
+            }
+        }
+        if (next == nullptr) {
+            return isBusy();
+        }
+        if (next->priority != TransactionPriority::URGENT && !isOnline(next->slaveAddress)) {
+            _current = next;
+            completeTransaction(TransactionError::SLAVE_OFFLINE);
+            return isBusy();
+        }
+        startTransaction(*next);
+    } else {
+        processTransaction();
+    }
+    return isBusy();
+}
+
+/**
+ * @brief Извлечение следующей транзакции из очереди указанного приоритета.
+ *
+ * Время ожидания извлечённой транзакции учитывается в статистике её очереди.
+ *
+ * @param priority Приоритет очереди.
+ * @return Указатель на транзакцию или nullptr, если готовых к запуску транзакций нет.
+ */
+ModbusTransaction* ModbusBus::dequeue(const TransactionPriority priority) {
+    lockQueues();
+    TransactionQueue& queue = _queues[static_cast<uint8_t>(priority)];
+    ModbusTransaction* const next = dequeue(queue);
+    if (next != nullptr) {
+        const unsigned long wait = millis() - next->queuedAt;
+        queue.stats.depth = queue.count;
+        queue.stats.dispatched++;
+        queue.stats.totalWait += wait;
+        if (wait > queue.stats.maxWait) {
+            queue.stats.maxWait = wait;
+        }
+    }
+    unlockQueues();
+    return next;
+}
+
+/**
+ * @brief Извлечение транзакции из очереди одного приоритета.
+ *
+ * Очередь обслуживается в порядке поступления, но если первая готовая транзакция
+ * адресована тому же ведомому, что и предыдущая, а в очереди есть готовые транзакции
+ * других ведомых, вперёд выходит первая из них. Так ведомые обслуживаются по кругу.
+ * Транзакции, ожидающие повтора (notBefore в будущем), пропускаются.
+ *
+ * @param queue Очередь.
+ * @return Указатель на транзакцию или nullptr, если готовых транзакций нет.
+ */
+ModbusTransaction* ModbusBus::dequeue(TransactionQueue& queue) {
+    const unsigned long now = millis();
+    uint8_t chosen = queue.count;
+    for (uint8_t i = 0; i < queue.count; i++) {
+        const ModbusTransaction* const candidate = queue.items[(queue.head + i) % HS321_BUS_QUEUE_SIZE];
+        if (static_cast<long>(now - candidate->notBefore) < 0) {
+            continue;
+        }
+        if (chosen == queue.count) {
+            chosen = i;
+        }
+        // Готовая транзакция другого ведомого
+        if (candidate->slaveAddress != _lastSlave) {
+            chosen = i;
+            break;
+        }
+    }
+    if (chosen == queue.count) {
+        return nullptr;
+    }
+
+    // Сдвиг пропущенных транзакций с сохранением их порядка
+    ModbusTransaction* const selected = queue.items[(queue.head + chosen) % HS321_BUS_QUEUE_SIZE];
+    for (uint8_t j = chosen; j > 0; j--) {
+        queue.items[(queue.head + j) % HS321_BUS_QUEUE_SIZE] = queue.items[(queue.head + j - 1) % HS321_BUS_QUEUE_SIZE];
+    }
+    queue.items[queue.head] = selected;
+
+    ModbusTransaction* const next = queue.items[queue.head];
+    queue.head = (queue.head + 1) % HS321_BUS_QUEUE_SIZE;
+    queue.count--;
+    return next;
+}
+
+/**
+ * @brief Сброс статистики очередей.
+ *
+ * Обнуляет счётчики и максимумы; текущая глубина каждой очереди сохраняется.
+ */
+void ModbusBus::resetQueueStats() {
+    for (TransactionQueue& queue : _queues) {
+        queue.stats = QueueStats();
+        queue.stats.depth = queue.count;
+        queue.stats.maxDepth = queue.count;
+    }
+}
+
+/**
+ * @brief Формирование кадра запроса и запуск транзакции.
+ *
+ * Для функции 0x03 формирует запрос чтения, для 0x06/0x10 — запрос записи с копированием
+ * значений в буфер кадра и преобразованием порядка байт. Дописывает CRC,
+ * сбрасывает счётчики приёма/передачи и передаёт в порт первую порцию байт.
+ *
+ * @param transaction Транзакция для запуска.
+ */
+void ModbusBus::startTransaction(ModbusTransaction& transaction) {
+    _current = &transaction;
+    _lastSlave = transaction.slaveAddress;
+
+    uint8_t* request = _frame;
+    const uint16_t startAddress = transaction.startAddress;
+    const size_t numberRegisters = transaction.count;
+    size_t length;
+
+    request[0] = transaction.slaveAddress;                      // Адрес устройства
+    request[1] = transaction.function;                          // Код функции
+    request[2] = static_cast<uint8_t>(startAddress >> 8);       // Высокий байт адреса
+    request[3] = static_cast<uint8_t>(startAddress & 0xFF);     // Низкий байт адреса
+
+    if (transaction.function == WRITE_ONE) {
+        request[4] = static_cast<uint8_t>(transaction.values[0] >> 8);     // Данные регистра старший байт
+        request[5] = static_cast<uint8_t>(transaction.values[0] & 0xFF);   // Данные регистра младший байт
+        length = 6;
+        // Ответ на 0x06: 8 байт
+        _rxLength = 8;
+    } else {
+        request[4] = static_cast<uint8_t>(numberRegisters >> 8);    // Количество регистров старший байт
+        request[5] = static_cast<uint8_t>(numberRegisters & 0xFF);  // Количество регистров младший байт
+        length = 6;
+        if (transaction.function == WRITE_RANGE) {
+            request[6] = static_cast<uint8_t>(numberRegisters * 2); // Количество байт данных
+            // Копируем, данные с преобразованием порядка байт
+            for (size_t i = 0; i < numberRegisters; i++) {
+                request[7 + (i * 2)] = static_cast<uint8_t>(transaction.values[i] >> 8);
+                request[8 + (i * 2)] = static_cast<uint8_t>(transaction.values[i] & 0xFF);
+            }
+            length = 7 + numberRegisters * 2;
+            // Ответ на 0x10: 8 байт
+            _rxLength = 8;
+        } else {
+            // Ответ: [адрес][функция][байт данных][данные...][CRC]
+            _rxLength = 5 + (numberRegisters * 2); // 3 заголовка + данные + 2 CRC
+        }
+    }
+
+    // Вычисление и добавление CRC
+    const uint16_t crc = calculateCRC(_frame, length);
+    _frame[length] = static_cast<uint8_t>(crc & 0xFF);             // Низкий байт CRC
+    _frame[length + 1] = static_cast<uint8_t>((crc >> 8) & 0xFF);  // Высокий байт CRC
+
+    _txLength = length + 2;
+    _txIndex = 0;
+    _rxIndex = 0;
+    _rxCrc = ModbusCRC::INITIAL;
+
+    // Очистка остатков предыдущих ответов, чтобы они не попали в новый кадр
+    while (_serialPort->available() > 0) {
+        _serialPort->read();
+    }
+
+    // Проверке связи с недоступным ведомым — короткий тайм-аут, чтобы не задерживать остальных
+    _responseTimeout = (&transaction == &_probe) ? _healthPolicy.probeTimeout : _totalTimeout;
+    _startTime = micros();
+#if HS321_ENABLE_TRACE
+    if (_trace != nullptr) {
+        _trace->record(0, _startTime, _frame, _txLength);
+    }
+#endif
+    _phase = TransactionPhase::TRANSMIT;
+    _phaseStart = millis();
+    sendData();
+}
+
+/**
+ * @brief Один шаг конечного автомата текущей транзакции.
+ *
+ * Последовательно проходит фазы: передача запроса, ожидание опустошения передатчика,
+ * приём ответа (или пауза после широковещательного запроса). Ни в одной фазе не ожидает поступления данных.
+ */
+void ModbusBus::processTransaction() {
+    switch (_phase) {
+        case TransactionPhase::IDLE:
+            return;
+
+        case TransactionPhase::TRANSMIT:
+            if (!sendData()) {
+                return;
+            }
+#ifdef HS321_TX_ISR
+            if (_txUsart != NO_USART) {
+                // Трансивер уже переключён на приём в обработчике прерывания TXC
+                _lastLineActivity = micros();
+                _phase = (_current->slaveAddress == BROADCAST_ADDRESS) ? TransactionPhase::TURNAROUND : TransactionPhase::RECEIVE;
+                _phaseStart = millis();
+                _receiveStart = micros();
+                return;
+            }
+#endif
+            // Все байты в буфере порта: оцениваем время их выхода на линию
+            // (байты в буфере передачи + байт в сдвиговом регистре)
+            {
+                const int freeSpace = _serialPort->availableForWrite();
+                const unsigned long pending = (freeSpace >= 0 && freeSpace < SERIAL_TX_BUFFER_SIZE)
+                                              ? static_cast<unsigned long>(SERIAL_TX_BUFFER_SIZE - freeSpace) + 1 : 1;
+                _drainTime = micros() + pending * _characterTime;
+            }
+            _phase = TransactionPhase::DRAIN;
+            return;
+
+        case TransactionPhase::DRAIN:
+            if (static_cast<long>(micros() - _drainTime) < 0) {
+                return;
+            }
+            // К этому моменту передатчик пуст, flush() возвращается сразу
+            _serialPort->flush();
+            // Возвращаемся в режим приема
+            setTransmitMode(false);
+            _lastLineActivity = micros();
+#ifdef DEBUG_sendData
+            if (_serialDebug != nullptr) {
+                _serialDebug->println(F("\t END sendData !!!"));
+            }
+#endif
+            // Ведомые не отвечают на широковещательный запрос
+            _phase = (_current->slaveAddress == BROADCAST_ADDRESS) ? TransactionPhase::TURNAROUND : TransactionPhase::RECEIVE;
+            _phaseStart = millis();
+            _receiveStart = micros();
+            return;
+
+        case TransactionPhase::RECEIVE:
+            if (receiveData()) {
+                completeTransaction(finishResponse());
+                return;
+            }
+            // Общий тайм-аут (ведомый не ответил)
+            if (millis() - _phaseStart > _responseTimeout) {
+#ifdef DEBUG
+                if (_serialDebug != nullptr) {
+                    _serialDebug->print(F("TOTAL TIMEOUT! Received "));
+                    _serialDebug->print(_rxIndex);
+                    _serialDebug->print(F("/"));
+                    _serialDebug->println(_rxLength);
+                }
+#endif
+                completeTransaction(TransactionError::TIMEOUT);
+                return;
+            }
+            // Конец кадра RTU: тишина на линии дольше t3.5 после начала ответа.
+            // Проверяется только при пустом буфере приёма, поэтому редкий вызов poll()
+            // не приводит к ложному обнаружению паузы
+            if (_rxIndex > 0 && _serialPort->available() == 0 && micros() - _lastByteTime > _interCharTimeout) {
+#ifdef DEBUG
+                if (_serialDebug != nullptr) {
+                    _serialDebug->print(F("FRAME GAP (t3.5)! Received "));
+                    _serialDebug->print(_rxIndex);
+                    _serialDebug->print(F("/"));
+                    _serialDebug->println(_rxLength);
+                }
+#endif
+                completeTransaction(TransactionError::INCOMPLETE_FRAME);
+            }
+            return;
+
+        case TransactionPhase::TURNAROUND:
+            // Пауза на обработку широковещательного запроса ведомыми
+            if (millis() - _phaseStart >= _broadcastDelay) {
+                completeTransaction(TransactionError::NONE);
+            }
+            return;
+    }
+}
+
+/**
+ * @brief Проверка принятого ответа и извлечение прочитанных значений.
+ *
+ * Ответ-исключение (функция | 0x80) распознаётся по заголовку и возвращает EXCEPTION
+ * с сохранением кода исключения. Для функции 0x03 проверяет адрес, функцию,
+ * количество байт данных и CRC, затем переписывает значения в буфер транзакции.
+ * Для функций записи выполняет validateModbusResponse(). CRC всех ответов проверяется
+ * по остатку _rxCrc, вычисленному при приёме, без повторного прохода по кадру.
+ *
+ * @return NONE, если ответ корректен, EXCEPTION для ответа-исключения, иначе причина отказа.
+ */
+TransactionError ModbusBus::finishResponse() {
+    const uint8_t* response = _frame;
+    const size_t responseSize = _rxIndex;
+    ModbusTransaction& transaction = *_current;
+
+    // Ответ-исключение: [адрес][функция | 0x80][код исключения][CRC]
+    if (responseSize == 5 && response[1] == (transaction.function | 0x80)) {
+        if (_rxCrc != 0) {
+            return TransactionError::CRC;
+        }
+        if (response[0] != transaction.slaveAddress) {
+            return TransactionError::WRONG_SLAVE;
+        }
+        transaction.exceptionCode = response[2];
+#ifdef DEBUG
+        if (_serialDebug != nullptr) {
+            _serialDebug->print(F("Исключение Modbus. Код ошибки: 0x"));
+            _serialDebug->println(transaction.exceptionCode, HEX);
+        }
+#endif
+        return TransactionError::EXCEPTION;
+    }
+
+    if (transaction.function != READ) {
+        // Проверка ответа на запись
+        return validateModbusResponse(response, responseSize, transaction.slaveAddress, transaction.function);
+    }
+
+    // Базовые проверки ответа
+    if (response[0] != transaction.slaveAddress || response[1] != READ) {
+        const TransactionError error = (response[0] != transaction.slaveAddress) ? TransactionError::WRONG_SLAVE : TransactionError::WRONG_FUNCTION;
+#ifdef DEBUG
+        if (_serialDebug != nullptr) {
+            _serialDebug->print(F("Неверный адрес или функция. Ожидалось: "));
+            _serialDebug->print(transaction.slaveAddress, HEX);
+            _serialDebug->print(F(" "));
+            _serialDebug->print(READ, HEX);
+            _serialDebug->print(F(", получено: "));
+            _serialDebug->print(response[0], HEX);
+            _serialDebug->print(F(" "));
+            _serialDebug->println(response[1], HEX);
+        }
+#endif
+        return error;
+    }
+
+    // Проверка количества байт данных
+    const uint8_t byteCount = response[2];
+    if (byteCount != transaction.count * 2) {
+#ifdef DEBUG
+        if (_serialDebug != nullptr) {
+            _serialDebug->print(F("Неверное количество байт данных. Ожидалось: "));
+            _serialDebug->print(transaction.count * 2);
+            _serialDebug->print(F(", получено: "));
+            _serialDebug->println(byteCount);
+        }
+#endif
+        return TransactionError::WRONG_LENGTH;
+    }
+
+    // Проверка CRC ответа без повторного прохода по буферу:
+    // CRC, накопленная в receiveData() по всему кадру вместе с переданной CRC
+    // (младший байт первым), для неповреждённого кадра равна нулю
+    if (_rxCrc != 0) {
+#ifdef DEBUG
+        if (_serialDebug != nullptr) {
+            _serialDebug->print(F("Ошибка CRC. Получено: 0x"));
+            _serialDebug->print(static_cast<uint16_t>((response[responseSize - 1] << 8) | response[responseSize - 2]), HEX);
+            _serialDebug->print(F(", остаток: 0x"));
+            _serialDebug->println(_rxCrc, HEX);
+        }
+#endif
+        return TransactionError::CRC;
+    }
+
+    // Извлечение значений из ответа
+    for (size_t i = 0; i < transaction.count; i++) {
+        const size_t dataIndex = 3 + (i * 2); // 3 - начало данных
+        transaction.values[i] = (static_cast<uint16_t>(response[dataIndex]) << 8) | response[dataIndex + 1];
+    }
+
+    return TransactionError::NONE;
+}
+
+/**
+ * @brief Завершение текущей транзакции.
+ *
+ * Освобождает шину и учитывает результат попытки в состоянии связи с ведомым.
+ * Если политика повторов допускает ещё одну попытку, транзакция возвращается в очередь.
+ * Иначе сохраняет причину и итоговое состояние в транзакции и вызывает её функцию
+ * обратного вызова, если она задана. Callback может сразу поставить в очередь новую транзакцию.
+ *
+ * @param error Причина неудачи (NONE — успешное завершение).
+ */
+void ModbusBus::completeTransaction(const TransactionError error) {
+    ModbusTransaction* const transaction = _current;
+    _phase = TransactionPhase::IDLE;
+    _current = nullptr;
+    // Запрос, не отправленный на линию, в статистику обмена не входит
+    if (error != TransactionError::SLAVE_OFFLINE) {
+        const unsigned long roundTrip = micros() - _startTime;
+        const unsigned long turnaround = _firstByteTime - _receiveStart;
+        recordStats(_stats, error, roundTrip, turnaround);
+        if (transaction->stats != nullptr) {
+            recordStats(*transaction->stats, error, roundTrip, turnaround);
+        }
+        // Ответ (или его отсутствие); широковещательный запрос без ответа не записывается
+#if HS321_ENABLE_TRACE
+        if (_trace != nullptr && (_rxIndex > 0 || error != TransactionError::NONE)) {
+            _trace->record(static_cast<uint8_t>(ModbusTrace::RESPONSE | static_cast<uint8_t>(error)),
+                           (_rxIndex > 0) ? _firstByteTime : micros(), _frame, _rxIndex);
+        }
+#endif
+    }
+    recordOutcome(*transaction, error);
+    if (transaction != &_probe && scheduleRetry(*transaction, error)) {
+        return;
+    }
+    const TransactionStatus status = (error == TransactionError::NONE) ? TransactionStatus::COMPLETED
+                                   : (error == TransactionError::EXCEPTION) ? TransactionStatus::EXCEPTION
+                                   : TransactionStatus::FAILED;
+    // После записи состояния транзакция может быть сразу освобождена владельцем
+    const TransactionCallback callback = transaction->callback;
+    void* const context = transaction->context;
+#if HS321_ENABLE_RTOS
+    const TaskHandle_t waiter = transaction->waiter;
+    transaction->waiter = nullptr;
+#endif
+    transaction->error = error;
+    transaction->status = status;
+#if HS321_ENABLE_RTOS
+    if (waiter != nullptr) {
+        xTaskNotifyGive(waiter);
+    }
+#endif
+    if (callback != nullptr) {
+        callback(status, context);
+    }
+}
+
+/**
+ * @brief Учёт завершённой попытки в блоке статистики.
+ *
+ * Времена учитываются только для попыток, на которые получен ответ (в том числе исключение).
+ *
+ * @param stats Блок статистики.
+ * @param error Причина неудачи (NONE — успешно).
+ * @param roundTrip Время кругового обмена (мкс).
+ * @param turnaround Время реакции ведомого (мкс).
+ */
+void ModbusBus::recordStats(TransactionStats& stats, const TransactionError error, const unsigned long roundTrip,
+                            const unsigned long turnaround) const {
+    stats.transactions++;
+    stats.bytesSent += _txLength;
+    stats.bytesReceived += _rxIndex;
+    switch (error) {
+        case TransactionError::NONE:
+            break;
+        case TransactionError::CRC:
+            stats.crcErrors++;
+            break;
+        case TransactionError::TIMEOUT:
+            stats.timeouts++;
+            break;
+        case TransactionError::EXCEPTION:
+            stats.exceptions++;
+            break;
+        default:
+            stats.otherErrors++;
+            break;
+    }
+    // Широковещательная запись и попытка без полного ответа времени ответа не дают
+    if ((error != TransactionError::NONE && error != TransactionError::EXCEPTION) || _rxIndex == 0) {
+        return;
+    }
+    if (stats.responses == 0 || roundTrip < stats.minRoundTrip) {
+        stats.minRoundTrip = roundTrip;
+    }
+    if (stats.responses == 0 || turnaround < stats.minTurnaround) {
+        stats.minTurnaround = turnaround;
+    }
+    if (roundTrip > stats.maxRoundTrip) {
+        stats.maxRoundTrip = roundTrip;
+    }
+    if (turnaround > stats.maxTurnaround) {
+        stats.maxTurnaround = turnaround;
+    }
+    stats.totalRoundTrip += roundTrip;
+    stats.totalTurnaround += turnaround;
+    stats.responses++;
+}
+
+/**
+ * @brief Повторная постановка неудачной транзакции в очередь.
+ *
+ * Повторяются ошибки с действием RETRY (без задержки) и BACKOFF (с задержкой
+ * backoff * 2^(попытка - 1), не более 64 * backoff), пока не исчерпано количество попыток.
+ * Обычная транзакция к ставшему недоступным ведомому не повторяется.
+ *
+ * @param transaction Завершившаяся неудачей попытка.
+ * @param error Причина неудачи.
+ * @return true, если транзакция поставлена на повтор, иначе false.
+ */
+bool ModbusBus::scheduleRetry(ModbusTransaction& transaction, const TransactionError error) {
+    const RetryAction action = retryAction(error, transaction.exceptionCode);
+    if ((action != RetryAction::RETRY && action != RetryAction::BACKOFF)
+        || error == TransactionError::SLAVE_OFFLINE
+        || transaction.attempt >= _retryPolicy.attempts
+        || (transaction.priority != TransactionPriority::URGENT && !isOnline(transaction.slaveAddress))
+        || !enqueue(transaction)) {
+        return false;
+    }
+    const uint8_t shift = (transaction.attempt - 1 < 6) ? transaction.attempt - 1 : 6;
+    transaction.notBefore = transaction.queuedAt + ((action == RetryAction::BACKOFF) ? (_retryPolicy.backoff << shift) : 0);
+    // Ожидание в очереди отсчитывается от окончания паузы повтора
+    transaction.queuedAt = transaction.notBefore;
+    transaction.exceptionCode = 0;
+    transaction.attempt++;
+#ifdef DEBUG
+    if (_serialDebug != nullptr) {
+        _serialDebug->print(F("Повтор транзакции, попытка "));
+        _serialDebug->println(transaction.attempt);
+    }
+#endif
+    return true;
+}
+
+/**
+ * @brief Учёт результата попытки в состоянии связи с ведомым.
+ *
+ * Любой ответ, в том числе исключение, означает, что ведомый на связи: счётчик
+ * неудач подряд сбрасывается, время ответа входит в скользящее среднее (вес 1/8).
+ * После failureThreshold неудач подряд ведомый признаётся недоступным.
+ *
+ * @param transaction Завершённая попытка.
+ * @param error Причина неудачи (NONE — успешно).
+ */
+void ModbusBus::recordOutcome(const ModbusTransaction& transaction, const TransactionError error) {
+    // Широковещательный запрос без ответа и запрос, не отправленный на линию, ничего не говорят о связи
+    if (transaction.slaveAddress == BROADCAST_ADDRESS || error == TransactionError::SLAVE_OFFLINE) {
+        return;
+    }
+    SlaveHealth* const health = findHealth(transaction.slaveAddress, true);
+    if (health == nullptr) {
+        return;
+    }
+    if (error == TransactionError::NONE || error == TransactionError::EXCEPTION) {
+        const unsigned long latency = micros() - _startTime;
+        health->latency = (health->responses == 0) ? latency : health->latency - health->latency / 8 + latency / 8;
+        health->responses++;
+        health->consecutiveFailures = 0;
+        if (!health->online) {
+            health->online = true;
+#ifdef DEBUG
+            if (_serialDebug != nullptr) {
+                _serialDebug->print(F("Ведомый снова на связи: "));
+                _serialDebug->println(transaction.slaveAddress);
+            }
+#endif
+        }
+        return;
+    }
+    health->failures++;
+    if (health->consecutiveFailures < 0xFF) {
+        health->consecutiveFailures++;
+    }
+    if (health->online && _healthPolicy.failureThreshold != 0 && health->consecutiveFailures >= _healthPolicy.failureThreshold) {
+        health->online = false;
+        health->nextProbe = millis() + _healthPolicy.probeInterval;
+#ifdef DEBUG
+        if (_serialDebug != nullptr) {
+            _serialDebug->print(F("Ведомый недоступен: "));
+            _serialDebug->println(transaction.slaveAddress);
+        }
+#endif
+    }
+}
+
+/**
+ * @brief Проверка паузы t3.5 на линии перед передачей нового запроса.
+ *
+ * Пауза отсчитывается от последнего принятого байта или от конца передачи запроса,
+ * поэтому соблюдается после каждого ответа, а не только после широковещательной записи.
+ *
+ * @return true, если линия свободна не меньше t3.5, иначе false.
+ */
+bool ModbusBus::lineIdle() {
+    while (_serialPort->available() > 0) {
+        _serialPort->read();
+        _lastLineActivity = micros();
+    }
+    return micros() - _lastLineActivity >= _interCharTimeout;
+}
+
+/**
+ * @brief Запуск проверки связи с недоступным ведомым.
+ *
+ * Проверка — чтение одного регистра probeRegister с тайм-аутом probeTimeout.
+ * Её результат учитывается в recordOutcome() как результат обычной попытки.
+ *
+ * @return true, если проверка запущена, иначе false.
+ */
+bool ModbusBus::startProbe() {
+    const unsigned long now = millis();
+    for (SlaveHealth& entry : _health) {
+        if (entry.address == BROADCAST_ADDRESS || entry.online || static_cast<long>(now - entry.nextProbe) < 0) {
+            continue;
+        }
+        entry.nextProbe = now + _healthPolicy.probeInterval;
+        _probe.setRead(entry.address, _healthPolicy.probeRegister, &_probeValue, 1);
+        _probe.status = TransactionStatus::PENDING;
+        _probe.error = TransactionError::NONE;
+        _probe.exceptionCode = 0;
+        _probe.attempt = 1;
+        startTransaction(_probe);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Поиск записи состояния связи ведомого.
+ *
+ * @param slave Адрес ведомого.
+ * @param create Занять свободную запись, если ведомого ещё нет.
+ * @return Указатель на запись или nullptr (ведомого нет, свободных записей нет).
+ */
+SlaveHealth* ModbusBus::findHealth(const uint8_t slave, const bool create) {
+    SlaveHealth* free = nullptr;
+    for (SlaveHealth& entry : _health) {
+        if (entry.address == slave) {
+            return &entry;
+        }
+        if (free == nullptr && entry.address == BROADCAST_ADDRESS) {
+            free = &entry;
+        }
+    }
+    if (!create || free == nullptr) {
+        return nullptr;
+    }
+    *free = SlaveHealth();
+    free->address = slave;
+    return free;
+}
+
+/**
+ * @brief Состояние связи с ведомым.
+ *
+ * @param slave Адрес ведомого.
+ * @return Указатель на состояние или nullptr, если с ведомым ещё не было обмена.
+ */
+const SlaveHealth* ModbusBus::health(const uint8_t slave) const {
+    if (slave == BROADCAST_ADDRESS) {
+        return nullptr;
+    }
+    for (const SlaveHealth& entry : _health) {
+        if (entry.address == slave) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Проверка доступности ведомого.
+ *
+ * Ведомые без записи состояния (ещё не было обмена, таблица заполнена) считаются доступными.
+ *
+ * @param slave Адрес ведомого.
+ * @return true, если ведомый не признан недоступным, иначе false.
+ */
+bool ModbusBus::isOnline(const uint8_t slave) const {
+    const SlaveHealth* const state = health(slave);
+    return state == nullptr || state->online;
+}
+
+/**
+ * @brief Сброс учёта состояния связи.
+ */
+void ModbusBus::resetHealth() {
+    for (SlaveHealth& entry : _health) {
+        entry = SlaveHealth();
+    }
+}
+
+/**
+ * @brief Сброс учёта состояния связи с одним ведомым.
+ *
+ * @param slave Адрес ведомого.
+ */
+void ModbusBus::resetHealth(const uint8_t slave) {
+    SlaveHealth* const entry = (slave == BROADCAST_ADDRESS) ? nullptr : findHealth(slave, false);
+    if (entry != nullptr) {
+        *entry = SlaveHealth();
+    }
+}
+
+/**
+ * @brief Проверка корректности ответа Modbus.
+ *
+ * Проверяет, соответствует ли ответ ожидаемому:
+ * - правильный адрес устройства,
+ * - отсутствие кода исключения,
+ * - корректный код функции,
+ * - правильная контрольная сумма CRC (по остатку _rxCrc, накопленному при приёме).
+ *
+ * @param response Указатель на буфер с принятым ответом.
+ * @param responseSize Размер ответа в байтах.
+ * @param expectedAddress Ожидаемый адрес ведомого устройства.
+ * @param expectedFunction Ожидаемый код функции.
+ * @return NONE, если ответ корректен, иначе причина отказа.
+ */
+TransactionError ModbusBus::validateModbusResponse(const uint8_t* response,
+                                      const size_t responseSize,
+                                      const uint8_t expectedAddress,
+                                      const uint8_t expectedFunction) const {
+    if (responseSize < 4) {  // Минимум: адрес + функция + CRC
+        return TransactionError::WRONG_LENGTH;
+    }
+
+    // Проверка адреса устройства
+    if (response[0] != expectedAddress) {
+#ifdef DEBUG
+        if (_serialDebug != nullptr) {
+            _serialDebug->print(F("Неверный адрес в ответе: 0x"));
+            _serialDebug->print(response[0], HEX);
+            _serialDebug->print(F(", ожидалось: 0x"));
+            _serialDebug->println(expectedAddress, HEX);
+        }
+#endif
+        return TransactionError::WRONG_SLAVE;
+    }
+
+    // Проверка на исключение
+    if (response[1] == (expectedFunction | 0x80)) {
+#ifdef DEBUG
+        if (_serialDebug != nullptr) {
+            _serialDebug->print(F("Исключение Modbus. Код ошибки: 0x"));
+            _serialDebug->println(response[2], HEX);
+        }
+#endif
+        return TransactionError::EXCEPTION;
+    }
+
+    // Проверка кода функции
+    if (response[1] != expectedFunction) {
+#ifdef DEBUG
+        if (_serialDebug != nullptr) {
+            _serialDebug->print(F("Неверная функция в ответе: 0x"));
+            _serialDebug->print(response[1], HEX);
+            _serialDebug->print(F(", ожидалось: 0x"));
+            _serialDebug->println(expectedFunction, HEX);
+        }
+#endif
+        return TransactionError::WRONG_FUNCTION;
+    }
+
+    // Проверка CRC по остатку, накопленному в receiveData(): для неповреждённого кадра он равен нулю
+    if (_rxCrc != 0) {
+#ifdef DEBUG
+        if (_serialDebug != nullptr) {
+            _serialDebug->print(F("Ошибка CRC. Получено: 0x"));
+            _serialDebug->print(static_cast<uint16_t>((response[responseSize - 1] << 8) | response[responseSize - 2]), HEX);
+            _serialDebug->print(F(", остаток: 0x"));
+            _serialDebug->println(_rxCrc, HEX);
+        }
+#endif
+        return TransactionError::CRC;
+    }
+
+    return TransactionError::NONE;
+}
+
+/**
+ * @brief Вычисление контрольной суммы CRC16-Modbus.
+ *
+ * Использует полином 0xA001 (обратный к 0x8005) для проверки целостности данных.
+ * Расчёт выполняется по таблице во Flash (см. ModbusCRC).
+ *
+ * @param data Указатель на массив данных.
+ * @param length Длина данных в байтах.
+ * @return Вычисленное значение CRC16.
+ */
+uint16_t ModbusBus::calculateCRC(const uint8_t *data, const size_t length) const {
+    // Более строгая проверка
+    if (data == nullptr || length == 0) {
+        return 0xFFFF; // или другое значение ошибки
+    }
+
+    return ModbusCRC::calculate(data, length);
+}
+
+/**
+ * @brief Неблокирующая передача запроса через интерфейс RS485.
+ *
+ * При первом вызове переводит RS485-трансивер в режим передачи.
+ * Если порт — аппаратный USART AVR, кадр передаётся прямо из буфера шины
+ * в обработчике прерывания TXC, который сам возвращает трансивер в режим приёма.
+ * Иначе в порт передаются только те байты, которые помещаются в его буфер передачи,
+ * чтобы write() не блокировался, а возврат в режим приёма выполняется в poll()
+ * после опустошения передатчика.
+ *
+ * @return true, если все байты запроса переданы, иначе false.
+ */
+bool ModbusBus::sendData() {
+#ifdef HS321_TX_ISR
+    if (_txUsart != NO_USART) {
+        if (_txIndex == 0) {
+            // Переводим устройство в режим передатчика
+            setTransmitMode(true);
+            _txDone = false;
+            _txIndex = 1;
+            const uint8_t oldSREG = SREG;
+            cli();
+            // Сброс флага TXC записью единицы, с сохранением U2X и MPCM
+            *_ucsra = (*_ucsra & (_BV(U2X0) | _BV(MPCM0))) | _BV(TXC0);
+            *_udr = _frame[0];
+            *_ucsrb |= _BV(TXCIE0);
+            SREG = oldSREG;
+        }
+        return _txDone;
+    }
+#endif
+
+    if (_txIndex == 0) {
+#ifdef DEBUG_sendData
+        if (_serialDebug != nullptr) {
+            _serialDebug->println(F("\t START sendData !!!"));
+        }
+#endif
+        // Переводим устройство в режим передатчика
+        setTransmitMode(true);
+    }
+
+    while (_txIndex < _txLength) {
+        const int freeSpace = _serialPort->availableForWrite();
+        if (freeSpace <= 0) {
+            return false;
+        }
+        size_t chunk = _txLength - _txIndex;
+        if (chunk > static_cast<size_t>(freeSpace)) {
+            chunk = static_cast<size_t>(freeSpace);
+        }
+        _txIndex += _serialPort->write(_frame + _txIndex, chunk);
+    }
+    return true;
+}
+
+/**
+ * @brief Неблокирующий приём ответа Modbus.
+ *
+ * Переносит в буфер кадра все доступные в порту байты, но не более ожидаемой длины ответа.
+ * Ожидаемая длина уточняется по заголовку по мере приёма: ответ-исключение
+ * (функция | 0x80) всегда занимает 5 байт, а ответ на чтение — 5 байт плюс счётчик данных.
+ * Тайм-ауты (общий и пауза t3.5) контролируются в poll().
+ *
+ * @return true, если приняты все ожидаемые байты, иначе false.
+ */
+bool ModbusBus::receiveData() {
+    // Чтение доступных данных
+    while (_serialPort->available() > 0 && _rxIndex < _rxLength) {
+        const uint8_t data = static_cast<uint8_t>(_serialPort->read());
+        _frame[_rxIndex] = data;
+        _rxCrc = ModbusCRC::update(_rxCrc, data); // CRC считается по мере приёма
+        _rxIndex++;
+        _lastByteTime = micros(); // Сброс таймера паузы t3.5 при получении данных
+        _lastLineActivity = _lastByteTime;
+        if (_rxIndex == 1) {
+            _firstByteTime = _lastByteTime;
+        }
+
+        // Уточнение длины кадра по заголовку
+        if (_rxIndex == 2 && (_frame[1] & 0x80)) {
+            _rxLength = 5; // [адрес][функция | 0x80][код исключения][CRC]
+        } else if (_rxIndex == 3 && _frame[1] == READ) {
+            const size_t frameLength = 5 + static_cast<size_t>(_frame[2]); // заголовок + данные + CRC
+            _rxLength = (frameLength < MAX_FRAME_SIZE) ? frameLength : MAX_FRAME_SIZE;
+        }
+    }
+    return _rxIndex == _rxLength;
+}
+
+/**
+ * @brief Захват очередей на время их изменения.
+ *
+ * Во FreeRTOS очереди изменяют и задачи, ставящие транзакции, и задача шины; критическая
+ * секция длится несколько присваиваний. Без FreeRTOS очереди изменяются только из loop().
+ */
+void ModbusBus::lockQueues() {
+#if HS321_ENABLE_RTOS && defined(ARDUINO_ARCH_ESP32)
+    portENTER_CRITICAL(&_queueLock);
+#elif HS321_ENABLE_RTOS
+    taskENTER_CRITICAL();
+#endif
+}
+
+/**
+ * @brief Освобождение очередей после lockQueues().
+ */
+void ModbusBus::unlockQueues() {
+#if HS321_ENABLE_RTOS && defined(ARDUINO_ARCH_ESP32)
+    portEXIT_CRITICAL(&_queueLock);
+#elif HS321_ENABLE_RTOS
+    taskEXIT_CRITICAL();
+#endif
+}
+
+/**
+ * @brief Проверяет, вызван ли метод не из задачи, владеющей шиной.
+ *
+ * @return true, если задача шины запущена и вызов выполняется в другой задаче, иначе false.
+ */
+bool ModbusBus::foreignTask() const {
+#if HS321_ENABLE_RTOS
+    return _task != nullptr && xTaskGetCurrentTaskHandle() != _task;
+#else
+    return false;
+#endif
+}
+
+#if HS321_ENABLE_RTOS
+/**
+ * @brief Запуск задачи FreeRTOS, владеющей шиной.
+ *
+ * @param priority Приоритет задачи.
+ * @param core Ядро, на котором выполняется задача (-1 — любое).
+ * @return true, если задача запущена, иначе false.
+ */
+bool ModbusBus::startTask(const UBaseType_t priority, const int core) {
+    if (_task != nullptr) {
+        return false;
+    }
+    TaskHandle_t task = nullptr;
+#if defined(ARDUINO_ARCH_ESP32)
+    const BaseType_t created = xTaskCreatePinnedToCore(taskMain, "HS321 bus", HS321_TASK_STACK_SIZE, this, priority, &task,
+                                                       (core < 0) ? tskNO_AFFINITY : static_cast<BaseType_t>(core));
+#else
+    (void)core;
+    const BaseType_t created = xTaskCreate(taskMain, "HS321 bus", HS321_TASK_STACK_SIZE, this, priority, &task);
+#endif
+    if (created != pdPASS) {
+        return false;
+    }
+    _task = task;
+    // Транзакции, поставленные до появления задачи, запускаются сразу
+    xTaskNotifyGive(_task);
+    return true;
+}
+
+/**
+ * @brief Тело задачи шины.
+ *
+ * Шина продвигается раз в тик или сразу после уведомления из submit(): байты ответа
+ * между шагами накапливает буфер приёма HardwareSerial, который ядро заполняет в
+ * прерывании UART (на ESP32 — из аппаратного FIFO), поэтому задача не крутится в ожидании.
+ * Тик ожидания также запускает вовремя проверки связи и отложенные повторы.
+ *
+ * @param bus Указатель на ModbusBus.
+ */
+void ModbusBus::taskMain(void* bus) {
+    ModbusBus* const self = static_cast<ModbusBus*>(bus);
+    // Задача могла стартовать раньше, чем startTask() сохранил её дескриптор
+    while (self->_task == nullptr) {
+        vTaskDelay(1);
+    }
+    for (;;) {
+        self->poll();
+        ulTaskNotifyTake(pdTRUE, 1);
+    }
+}
+#endif
+
+#ifdef HS321_TX_ISR
+
+ModbusBus* volatile ModbusBus::_txOwners[ModbusBus::MAX_USART] = { nullptr, nullptr, nullptr, nullptr };
+
+/**
+ * @brief Обработка прерывания USART TX Complete.
+ *
+ * Флаг TXC устанавливается, когда сдвиговый регистр и UDR пусты. Пока в кадре есть байты,
+ * следующий байт записывается в UDR прямо из буфера шины; после последнего стоп-бита
+ * трансивер переключается на приём и прерывание TXC запрещается.
+ *
+ * @param usart Номер аппаратного USART (0..3).
+ */
+void ModbusBus::txCompleteInterrupt(const uint8_t usart) {
+    ModbusBus* const owner = _txOwners[usart];
+    if (owner == nullptr) {
+        return;
+    }
+    const size_t index = owner->_txIndex;
+    if (index < owner->_txLength) {
+        *owner->_udr = owner->_frame[index];
+        owner->_txIndex = index + 1;
+    } else {
+        owner->setTransmitMode(false);
+        *owner->_ucsrb &= static_cast<uint8_t>(~_BV(TXCIE0));
+        owner->_txDone = true;
+    }
+}
+
+#if defined(HAVE_HWSERIAL0)
+#if defined(USART_TX_vect)
+ISR(USART_TX_vect) { ModbusBus::txCompleteInterrupt(0); }
+#elif defined(USART0_TX_vect)
+ISR(USART0_TX_vect) { ModbusBus::txCompleteInterrupt(0); }
+#endif
+#endif
+
+#if defined(HAVE_HWSERIAL1) && defined(USART1_TX_vect)
+ISR(USART1_TX_vect) { ModbusBus::txCompleteInterrupt(1); }
+#endif
+
+#if defined(HAVE_HWSERIAL2) && defined(USART2_TX_vect)
+ISR(USART2_TX_vect) { ModbusBus::txCompleteInterrupt(2); }
+#endif
+
+#if defined(HAVE_HWSERIAL3) && defined(USART3_TX_vect)
+ISR(USART3_TX_vect) { ModbusBus::txCompleteInterrupt(3); }
+#endif
+
+#endif
@@ -0,0 +1,921 @@
+#pragma once
+
+/** @file ModbusBus.h
+ * @brief Ведущий шины Modbus RTU: один порт RS485, общий для нескольких ведомых устройств.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include <Arduino.h>
+#include "HS321Config.h"
+#include "ModbusCRC.h"
+#if HS321_ENABLE_TRACE
+#include "ModbusTrace.h"
+#endif
+#if HS321_ENABLE_RTOS
+#if defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <STM32FreeRTOS.h>
+#endif
+#endif
+
+/**
+ * @def RS485Transmit
+ * @brief Уровень сигнала для режима передачи данных по RS485 (высокий уровень).
+ */
+#define RS485Transmit HIGH
+
+/**
+ * @def RS485Receive
+ * @brief Уровень сигнала для режима приёма данных по RS485 (низкий уровень).
+ */
+#define RS485Receive LOW
+
+/**
+ * @def HS321_TX_ISR
+ * @brief Передача кадра по прерыванию USART TX Complete (только AVR).
+ *
+ * Кадр передаётся напрямую из буфера шины по одному байту в обработчике
+ * прерывания TXC, который же и возвращает трансивер RS485 в режим приёма сразу после
+ * последнего стоп-бита. Отключается флагом сборки -DHS321_DISABLE_TX_ISR
+ * (например, если векторы USARTn_TX_vect используются приложением).
+ */
+#if defined(__AVR__) && !defined(HS321_DISABLE_TX_ISR)
+#define HS321_TX_ISR
+#endif
+
+/**
+ * @enum TransactionStatus
+ * @brief Состояние асинхронной транзакции Modbus.
+ *
+ * Хранится в ModbusTransaction и передаётся в функцию обратного вызова по завершении транзакции.
+ */
+enum class TransactionStatus : uint8_t {
+    IDLE,       ///< Транзакция не запускалась
+    PENDING,    ///< Транзакция в очереди или выполняется (передача запроса или ожидание ответа)
+    COMPLETED,  ///< Ответ получен и прошёл все проверки
+    EXCEPTION,  ///< Ведомый вернул ответ-исключение Modbus (код — ModbusTransaction::exceptionCode)
+    FAILED      ///< Ошибка: тайм-аут, обрыв кадра, неверный ответ или ошибка CRC
+};
+
+/**
+ * @enum TransactionError
+ * @brief Причина неудачного завершения транзакции Modbus.
+ *
+ * Хранится в ModbusTransaction::error; позволяет решить, имеет ли смысл повтор (см. retryAction()).
+ */
+enum class TransactionError : uint8_t {
+    NONE,              ///< Ошибки нет
+    NOT_INITIALIZED,   ///< Шина не инициализирована
+    INVALID_REQUEST,   ///< Неверные параметры запроса (буфер, количество регистров, функция, чтение по адресу 0)
+    QUEUE_FULL,        ///< Очередь шины заполнена
+    TIMEOUT,           ///< Ведомый не ответил за общий тайм-аут
+    INCOMPLETE_FRAME,  ///< Ответ оборван: пауза t3.5 до приёма всех байт
+    CRC,               ///< Ошибка контрольной суммы ответа
+    WRONG_SLAVE,       ///< Ответ с адресом другого ведомого
+    WRONG_FUNCTION,    ///< Неверный код функции в ответе
+    WRONG_LENGTH,      ///< Неверное количество байт данных в ответе
+    EXCEPTION,         ///< Ответ-исключение Modbus (код — ModbusTransaction::exceptionCode)
+    OUT_OF_RANGE,      ///< Значение вне диапазона параметра, запрос не отправлялся
+    SLAVE_OFFLINE,     ///< Ведомый признан недоступным, запрос не отправлялся (см. SlaveHealth)
+    VERIFY_MISMATCH    ///< Прочитанное для проверки значение не совпало с ожидаемым (например, FC.00)
+};
+
+/**
+ * @enum ModbusException
+ * @brief Коды исключений Modbus из ответа-исключения.
+ */
+enum class ModbusException : uint8_t {
+    ILLEGAL_FUNCTION = 0x01,         ///< Функция не поддерживается ведомым
+    ILLEGAL_DATA_ADDRESS = 0x02,     ///< Адрес регистра не существует
+    ILLEGAL_DATA_VALUE = 0x03,       ///< Недопустимое значение или количество регистров
+    SLAVE_DEVICE_FAILURE = 0x04,     ///< Неустранимая ошибка ведомого
+    ACKNOWLEDGE = 0x05,              ///< Запрос принят, но выполняется долго
+    SLAVE_DEVICE_BUSY = 0x06,        ///< Ведомый занят
+    MEMORY_PARITY_ERROR = 0x08,      ///< Ошибка памяти ведомого
+    GATEWAY_PATH_UNAVAILABLE = 0x0A, ///< Шлюз: нет пути к ведомому
+    GATEWAY_TARGET_FAILED = 0x0B     ///< Шлюз: ведомый не ответил
+};
+
+/**
+ * @enum RetryAction
+ * @brief Рекомендуемая реакция на неудачную транзакцию.
+ */
+enum class RetryAction : uint8_t {
+    NONE,      ///< Транзакция успешна, повтор не нужен
+    RETRY,     ///< Помеха на линии (CRC, оборванный или чужой кадр): повторить сразу
+    BACKOFF,   ///< Ведомый или шина перегружены (тайм-аут, занят, очередь заполнена): повторить с задержкой
+    ABANDON    ///< Повтор не поможет (неверный адрес, значение, функция или запрос)
+};
+
+/**
+ * @brief Классификация ошибки транзакции для логики повторов.
+ * @param error Причина неудачи.
+ * @param exceptionCode Код исключения Modbus (для error == EXCEPTION).
+ * @return Рекомендуемое действие.
+ */
+RetryAction retryAction(TransactionError error, uint8_t exceptionCode);
+
+/**
+ * @enum TransactionPriority
+ * @brief Приоритет транзакции в очереди шины.
+ *
+ * Транзакции с приоритетом URGENT выполняются раньше всех ожидающих транзакций NORMAL.
+ * Уже передаваемый кадр не прерывается.
+ */
+enum class TransactionPriority : uint8_t {
+    URGENT,     ///< Команды управления (пуск, останов, сброс аварии)
+    NORMAL,     ///< Чтение и запись параметров, опрос мониторинга
+    COUNT       ///< Количество приоритетов (используется для размера массивов)
+};
+
+/**
+ * @struct QueueStats
+ * @brief Статистика очереди шины для одного приоритета.
+ *
+ * Позволяет оценить, успевает ли шина при выбранной скорости обслуживать заданную частоту опроса.
+ */
+struct QueueStats {
+    uint8_t depth = 0;                  ///< Текущее количество ожидающих транзакций
+    uint8_t maxDepth = 0;               ///< Максимальное количество ожидающих транзакций
+    unsigned long dispatched = 0;       ///< Количество транзакций, переданных на шину
+    unsigned long rejected = 0;         ///< Количество транзакций, не поставленных из-за заполненной очереди
+    unsigned long totalWait = 0;        ///< Суммарное время ожидания в очереди без пауз перед повторами (мс)
+    unsigned long maxWait = 0;          ///< Максимальное время ожидания в очереди (мс)
+
+    /**
+     * @brief Среднее время ожидания транзакции в очереди.
+     * @return Среднее время ожидания (мс) или 0, если транзакций не было.
+     */
+    unsigned long averageWait() const { return dispatched ? totalWait / dispatched : 0; }
+};
+
+/**
+ * @struct TransactionStats
+ * @brief Счётчики обмена по шине: попытки, байты, ошибки и времена ответа.
+ *
+ * Обновляется один раз при завершении каждой попытки несколькими сложениями и сравнениями,
+ * поэтому может оставаться включённым в рабочей прошивке. Время кругового обмена —
+ * от начала передачи запроса до приёма последнего байта ответа; время реакции — от
+ * переключения трансивера на приём до первого байта ответа.
+ */
+struct TransactionStats {
+    unsigned long transactions = 0;          ///< Количество попыток, переданных на линию
+    unsigned long bytesSent = 0;             ///< Передано байт
+    unsigned long bytesReceived = 0;         ///< Принято байт
+    unsigned long crcErrors = 0;             ///< Ответов с неверной CRC
+    unsigned long timeouts = 0;              ///< Попыток без ответа
+    unsigned long exceptions = 0;            ///< Ответов-исключений
+    unsigned long otherErrors = 0;           ///< Прочих неудачных попыток (оборванный кадр, чужой адрес, неверная длина)
+    unsigned long responses = 0;             ///< Количество ответов, по которым считаются времена
+    unsigned long minRoundTrip = 0;          ///< Минимальное время кругового обмена (мкс)
+    unsigned long maxRoundTrip = 0;          ///< Максимальное время кругового обмена (мкс)
+    unsigned long totalRoundTrip = 0;        ///< Суммарное время кругового обмена (мкс)
+    unsigned long minTurnaround = 0;         ///< Минимальное время реакции ведомого (мкс)
+    unsigned long maxTurnaround = 0;         ///< Максимальное время реакции ведомого (мкс)
+    unsigned long totalTurnaround = 0;       ///< Суммарное время реакции ведомого (мкс)
+
+    /**
+     * @brief Среднее время кругового обмена.
+     * @return Среднее время (мкс) или 0, если ответов не было.
+     */
+    unsigned long averageRoundTrip() const { return responses ? totalRoundTrip / responses : 0; }
+
+    /**
+     * @brief Среднее время реакции ведомого.
+     * @return Среднее время (мкс) или 0, если ответов не было.
+     */
+    unsigned long averageTurnaround() const { return responses ? totalTurnaround / responses : 0; }
+};
+
+/**
+ * @brief Пауза t3.5 между кадрами Modbus RTU.
+ *
+ * 3.5 символа по 10 бит; для скоростей выше 19200 бод спецификация фиксирует 1750 мкс.
+ *
+ * @param baud Скорость передачи данных.
+ * @return Пауза в микросекундах.
+ */
+constexpr unsigned long modbusFrameGap(const unsigned long baud) {
+    return (baud > 19200) ? 1750UL : 35UL * 1000000UL / baud;
+}
+
+/**
+ * @brief Время передачи одного символа (10 бит) с округлением вверх.
+ * @param baud Скорость передачи данных.
+ * @return Время в микросекундах.
+ */
+constexpr unsigned long modbusCharacterTime(const unsigned long baud) {
+    return (10UL * 1000000UL + baud - 1) / baud;
+}
+
+/**
+ * @struct FixedBusConfig
+ * @brief Параметры шины, вычисленные при компиляции (см. StaticModbusBus).
+ */
+struct FixedBusConfig {
+    unsigned long frameGap;        ///< Пауза t3.5 между кадрами (мкс)
+    unsigned long characterTime;   ///< Время передачи одного символа (мкс)
+    uintptr_t directionPort;       ///< Адрес регистра PORTx пина DE/RE (0 — определяется в begin())
+    uint8_t directionMask;         ///< Битовая маска пина DE/RE в регистре PORTx
+};
+
+/**
+ * @struct RetryPolicy
+ * @brief Политика повторов неудачных транзакций.
+ *
+ * Транзакция повторяется, если retryAction() её ошибки — RETRY (сразу) или BACKOFF
+ * (с задержкой backoff, удваиваемой с каждой попыткой). Ожидающая повтора транзакция
+ * не занимает шину: в это время выполняются транзакции других ведомых.
+ */
+struct RetryPolicy {
+    uint8_t attempts = 1;                ///< Общее количество попыток (1 — без повторов)
+    unsigned long backoff = 20;          ///< Задержка перед первым повтором BACKOFF (мс)
+};
+
+/**
+ * @struct HealthPolicy
+ * @brief Политика учёта состояния связи с ведомыми.
+ */
+struct HealthPolicy {
+    uint8_t failureThreshold = 3;        ///< Неудачных попыток подряд до признания ведомого недоступным (0 — не признавать)
+    unsigned long probeInterval = 1000;  ///< Период проверки связи с недоступным ведомым (мс)
+    unsigned long probeTimeout = 100;    ///< Тайм-аут ответа на проверку связи (мс)
+    uint16_t probeRegister = 0x0C00;     ///< Регистр, читаемый при проверке связи (FC.00, как в HS321::checkCommunicationSettings())
+};
+
+/**
+ * @struct SlaveHealth
+ * @brief Состояние связи с одним ведомым.
+ */
+struct SlaveHealth {
+    uint8_t address = 0;                 ///< Адрес ведомого (0 — запись не используется)
+    bool online = true;                  ///< Ведомый доступен
+    uint8_t consecutiveFailures = 0;     ///< Неудачных попыток подряд (ответ-исключение неудачей связи не считается)
+    unsigned long responses = 0;         ///< Количество полученных ответов
+    unsigned long failures = 0;          ///< Количество попыток без корректного ответа
+    unsigned long latency = 0;           ///< Скользящее среднее времени ответа (мкс)
+    unsigned long nextProbe = 0;         ///< Время следующей проверки связи (мс), если ведомый недоступен
+};
+
+/**
+ * @typedef TransactionCallback
+ * @brief Функция обратного вызова, вызываемая по завершении асинхронной транзакции.
+ *
+ * @param status Итоговое состояние транзакции (COMPLETED, EXCEPTION или FAILED).
+ * @param context Пользовательский указатель, сохранённый в транзакции.
+ */
+typedef void (*TransactionCallback)(TransactionStatus status, void* context);
+
+/**
+ * @struct ModbusTransaction
+ * @brief Описание одной транзакции Modbus (запрос и результат).
+ *
+ * Память под транзакцию принадлежит вызывающему коду и должна существовать,
+ * пока состояние равно PENDING: шина хранит в очереди только указатель на неё.
+ */
+struct ModbusTransaction {
+    uint8_t slaveAddress = 0;                          ///< Адрес ведомого (0 — широковещательная запись)
+    uint8_t function = 0;                              ///< Код функции Modbus (0x03, 0x06, 0x10)
+    uint16_t startAddress = 0;                         ///< Адрес первого регистра
+    uint16_t* values = nullptr;                        ///< Буфер значений: приёмник при чтении, источник при записи
+    size_t count = 0;                                  ///< Количество регистров
+    uint16_t singleValue = 0;                          ///< Хранилище значения для записи одного регистра
+    volatile TransactionStatus status = TransactionStatus::IDLE; ///< Текущее состояние транзакции
+    uint8_t exceptionCode = 0;                         ///< Код исключения Modbus (при status == EXCEPTION)
+    TransactionError error = TransactionError::NONE;   ///< Причина неудачи (при status == FAILED или EXCEPTION)
+    TransactionPriority priority = TransactionPriority::NORMAL; ///< Приоритет в очереди шины
+    TransactionCallback callback = nullptr;            ///< Функция обратного вызова (может быть nullptr)
+    void* context = nullptr;                           ///< Пользовательский указатель для callback
+    unsigned long queuedAt = 0;                        ///< Время постановки в очередь или окончания паузы повтора (мс), заполняется шиной
+    unsigned long notBefore = 0;                       ///< Время, раньше которого транзакция не запускается (мс), заполняется шиной
+    uint8_t attempt = 0;                               ///< Номер текущей попытки (1 — первая), заполняется шиной
+    TransactionStats* stats = nullptr;                 ///< Дополнительный блок статистики транзакции (см. HS321::attachStats())
+#if HS321_ENABLE_RTOS
+    TaskHandle_t waiter = nullptr;                     ///< Задача, ожидающая завершения в ModbusBus::execute(), заполняется шиной
+#endif
+
+    /**
+     * @brief Подготовка чтения регистров (функция 0x03).
+     * @param slave Адрес ведомого.
+     * @param address Адрес первого регистра.
+     * @param target Буфер для прочитанных значений (должен существовать до завершения транзакции).
+     * @param registers Количество регистров (1..MAX_READ_REGISTERS).
+     */
+    void setRead(uint8_t slave, uint16_t address, uint16_t* target, size_t registers);
+
+    /**
+     * @brief Подготовка записи регистров (0x06 для одного регистра, 0x10 для диапазона).
+     *
+     * Значения копируются в кадр в момент начала передачи, поэтому source
+     * должен существовать, пока транзакция находится в очереди.
+     *
+     * @param slave Адрес ведомого (0 — широковещательная запись).
+     * @param address Адрес первого регистра.
+     * @param source Массив значений для записи.
+     * @param registers Количество регистров (1..MAX_WRITE_REGISTERS).
+     */
+    void setWrite(uint8_t slave, uint16_t address, const uint16_t* source, size_t registers);
+
+    /**
+     * @brief Подготовка записи одного регистра (функция 0x06) со значением внутри транзакции.
+     * @param slave Адрес ведомого (0 — широковещательная запись).
+     * @param address Адрес регистра.
+     * @param value Значение для записи.
+     */
+    void setWriteSingle(uint8_t slave, uint16_t address, uint16_t value);
+
+    /**
+     * @brief Рекомендуемая реакция на результат транзакции.
+     * @return Действие по классификации retryAction().
+     */
+    RetryAction retryAction() const { return ::retryAction(error, exceptionCode); }
+};
+
+class ModbusBusGroup;
+
+/**
+ * @class ModbusBus
+ * @brief Ведущий шины Modbus RTU на одном порту RS485.
+ *
+ * Владеет последовательным портом, пином управления направлением RS485 (DE/RE), тайм-аутами
+ * и буфером кадра. Транзакции от любого количества ведомых устройств ставятся в очередь
+ * своего приоритета и выполняются строго по одной: сначала срочные, затем обычные.
+ * Внутри приоритета ведомые обслуживаются по кругу, чтобы устройство с длинной очередью
+ * не задерживало остальные.
+ * Поддерживает широковещательную запись (адрес 0), на которую ведомые не отвечают.
+ *
+ * Каждый экземпляр владеет только своим портом, поэтому на платах с несколькими UART
+ * шины работают параллельно; их совместный опрос выполняет ModbusBusGroup.
+ *
+ * Во FreeRTOS (HS321_ENABLE_RTOS) шину продвигает собственная задача (startTask()).
+ * Транзакции ставятся в очередь из любых задач, а задача, вызвавшая execute() (и все
+ * блокирующие методы HS321), спит до уведомления о завершении транзакции вместо опроса.
+ * Функции обратного вызова транзакций выполняются в задаче шины.
+ */
+class ModbusBus {
+public:
+    /**
+     * @enum CodeFunction
+     * @brief Коды функций Modbus, используемые библиотекой.
+     */
+    enum CodeFunction : uint8_t {
+        READ = 0x03,       ///< Функция Modbus 0x03 — чтение регистров
+        WRITE_ONE = 0x06,  ///< Функция Modbus 0x06 — запись одного регистра
+        WRITE_RANGE = 0x10 ///< Функция Modbus 0x10 — запись нескольких регистров
+    };
+
+    /**
+     * @var BROADCAST_ADDRESS
+     * @brief Широковещательный адрес Modbus: запись принимают все ведомые, ответа нет.
+     */
+    static constexpr uint8_t BROADCAST_ADDRESS = 0;
+
+    /**
+     * @var MAX_FRAME_SIZE
+     * @brief Максимальный размер кадра Modbus RTU в байтах (ADU), см. HS321_MAX_FRAME_SIZE.
+     */
+    static constexpr size_t MAX_FRAME_SIZE = HS321_MAX_FRAME_SIZE;
+
+    /**
+     * @var MAX_READ_REGISTERS
+     * @brief Наибольшее количество регистров в кадре чтения (125 при кадре 256 байт).
+     */
+    static constexpr size_t MAX_READ_REGISTERS = (MAX_FRAME_SIZE - 5) / 2;
+
+    /**
+     * @var MAX_WRITE_REGISTERS
+     * @brief Наибольшее количество регистров в кадре записи (123 при кадре 256 байт).
+     */
+    static constexpr size_t MAX_WRITE_REGISTERS = (MAX_FRAME_SIZE - 9) / 2;
+
+    /**
+     * @brief Конструктор класса.
+     * @param serialPort Ссылка на объект HardwareSerial для связи с частотниками.
+     * @param serialDebug Ссылка на объект HardwareSerial для вывода отладочной информации.
+     * @param baud Скорость передачи данных (обычно 9600, 19200, 38400).
+     * @param transmitterModeContact Номер цифрового пина для управления направлением RS485 (DE/RE).
+     */
+    ModbusBus(HardwareSerial& serialPort, HardwareSerial& serialDebug, unsigned long baud, uint8_t transmitterModeContact);
+
+    /**
+     * @brief Инициализация порта, пина управления RS485 и тайм-аутов.
+     */
+    void begin();
+
+    /**
+     * @brief Проверяет, была ли успешная инициализация шины.
+     * @return true, если инициализация прошла успешно, иначе false.
+     */
+    bool isInitialized() const { return _initialized; }
+
+    /**
+     * @brief Постановка транзакции в очередь шины.
+     * @param transaction Подготовленная транзакция (setRead/setWrite/setWriteSingle).
+     * @return true, если транзакция поставлена в очередь своего приоритета, иначе false (очередь заполнена,
+     *         неверные параметры, транзакция уже в очереди, чтение по широковещательному адресу);
+     *         причина, кроме повторной постановки, сохраняется в transaction.error.
+     */
+    bool submit(ModbusTransaction& transaction);
+
+    /**
+     * @brief Выполнение транзакции с ожиданием её завершения.
+     *
+     * Ставит транзакцию в очередь и вызывает poll() до её завершения; транзакции,
+     * стоящие в очереди раньше, выполняются в процессе ожидания. Если шина входит
+     * в ModbusBusGroup, во время ожидания продвигаются все шины группы.
+     *
+     * @param transaction Подготовленная транзакция.
+     * @return true, если транзакция завершилась успешно (COMPLETED), иначе false.
+     */
+    bool execute(ModbusTransaction& transaction);
+
+    /**
+     * @brief Продвижение текущей транзакции и запуск следующей из очереди.
+     *
+     * Должен вызываться из loop() как можно чаще. Никогда не ожидает поступления данных.
+     *
+     * @return true, если на шине есть незавершённые транзакции, иначе false.
+     */
+    bool poll();
+
+#if HS321_ENABLE_RTOS
+    /**
+     * @brief Запуск задачи FreeRTOS, владеющей шиной.
+     *
+     * Задача продвигает шину, пока есть транзакции, и засыпает до постановки новой
+     * транзакции, когда шина свободна. После запуска poll(), вызванный из других задач
+     * (в том числе из loop() и компонентов библиотеки), только сообщает о занятости шины.
+     *
+     * @note Настройки шины (begin(), setBaud(), политики) меняются до запуска задачи.
+     *
+     * @param priority Приоритет задачи.
+     * @param core Ядро, на котором выполняется задача (-1 — любое; учитывается только на ESP32).
+     * @return true, если задача запущена, иначе false (уже запущена или не хватило памяти).
+     */
+    bool startTask(UBaseType_t priority = 5, int core = -1);
+
+    /**
+     * @brief Проверяет, запущена ли задача шины.
+     * @return true, если шину продвигает задача startTask(), иначе false.
+     */
+    bool hasTask() const { return _task != nullptr; }
+#endif
+
+    /**
+     * @brief Проверяет, есть ли выполняемая или ожидающая транзакция.
+     * @return true, если шина занята, иначе false.
+     */
+    bool isBusy() const { return _current != nullptr || queued() > 0; }
+
+    /**
+     * @brief Количество транзакций, ожидающих в очереди (без учёта выполняемой).
+     * @return Количество транзакций в очереди.
+     */
+    size_t queued() const {
+        return _queues[static_cast<uint8_t>(TransactionPriority::URGENT)].count
+             + _queues[static_cast<uint8_t>(TransactionPriority::NORMAL)].count;
+    }
+
+    /**
+     * @brief Статистика очереди указанного приоритета.
+     * @param priority Приоритет очереди.
+     * @return Ссылка на статистику очереди.
+     */
+    const QueueStats& queueStats(TransactionPriority priority) const { return _queues[static_cast<uint8_t>(priority)].stats; }
+
+    /**
+     * @brief Сброс статистики очередей (текущая глубина сохраняется).
+     */
+    void resetQueueStats();
+
+    /**
+     * @brief Статистика обмена по всей шине.
+     * @return Ссылка на счётчики обмена.
+     */
+    const TransactionStats& transactionStats() const { return _stats; }
+
+    /**
+     * @brief Сброс статистики обмена по всей шине.
+     */
+    void resetTransactionStats() { _stats = TransactionStats(); }
+
+#if HS321_ENABLE_TRACE
+    /**
+     * @brief Подключение трассировки кадров.
+     *
+     * Каждый запрос и ответ копируется в кольцевой буфер трассировки с меткой времени;
+     * в отличие от отладочного вывода это не влияет на временные характеристики обмена.
+     *
+     * @param trace Буфер трассировки (nullptr — отключить).
+     */
+    void setTrace(ModbusTrace* trace) { _trace = trace; }
+#endif
+
+    /**
+     * @brief Установка паузы после широковещательной записи.
+     *
+     * Ведомые не отвечают на широковещательные запросы, но им нужно время на их обработку
+     * перед следующим запросом.
+     *
+     * @param delayMs Пауза в миллисекундах (по умолчанию 100 мс).
+     */
+    void setBroadcastDelay(unsigned long delayMs) { _broadcastDelay = delayMs; }
+
+    /**
+     * @brief Установка политики повторов неудачных транзакций.
+     * @param policy Политика повторов (по умолчанию повторов нет).
+     */
+    void setRetryPolicy(const RetryPolicy& policy) { _retryPolicy = policy; }
+
+    /**
+     * @brief Установка политики учёта состояния связи с ведомыми.
+     *
+     * Ведомый, не ответивший failureThreshold раз подряд, признаётся недоступным: обычные
+     * транзакции к нему завершаются сразу с ошибкой SLAVE_OFFLINE, не занимая шину на время
+     * тайм-аута, а шина раз в probeInterval читает у него регистр probeRegister с коротким
+     * тайм-аутом. После первого ответа ведомый снова считается доступным. Срочные транзакции
+     * (команды управления) передаются всегда.
+     *
+     * @param policy Политика учёта состояния связи.
+     */
+    void setHealthPolicy(const HealthPolicy& policy) { _healthPolicy = policy; }
+
+    /**
+     * @brief Политика учёта состояния связи с ведомыми.
+     * @return Текущая политика.
+     */
+    const HealthPolicy& healthPolicy() const { return _healthPolicy; }
+
+    /**
+     * @brief Состояние связи с ведомым.
+     * @param slave Адрес ведомого.
+     * @return Указатель на состояние или nullptr, если с ведомым ещё не было обмена.
+     */
+    const SlaveHealth* health(uint8_t slave) const;
+
+    /**
+     * @brief Проверяет, доступен ли ведомый.
+     * @param slave Адрес ведомого.
+     * @return true, если ведомый не признан недоступным, иначе false.
+     */
+    bool isOnline(uint8_t slave) const;
+
+    /**
+     * @brief Сброс учёта состояния связи: все ведомые снова считаются доступными.
+     */
+    void resetHealth();
+
+    /**
+     * @brief Сброс учёта состояния связи с одним ведомым: он снова считается доступным.
+     * @param slave Адрес ведомого.
+     */
+    void resetHealth(uint8_t slave);
+
+    /**
+     * @brief Порт вывода отладочной информации.
+     * @return Указатель на отладочный порт (может быть nullptr).
+     */
+    HardwareSerial* debugPort() const { return _serialDebug; }
+
+    /**
+     * @brief Смена скорости шины во время работы.
+     *
+     * Выполняется только между транзакциями: порт перенастраивается, а пауза t3.5 и время
+     * символа пересчитываются вместе, поэтому ни одна транзакция не видит смешанных
+     * настроек. Транзакции в очереди передаются уже на новой скорости. Скорость
+     * StaticModbusBus задана при компиляции и не меняется (см. baudFixed()).
+     *
+     * @param baud Новая скорость передачи данных.
+     * @return true, если скорость изменена, иначе false (выполняется транзакция, baud == 0,
+     *         скорость шины задана при компиляции и отличается от baud).
+     */
+    bool setBaud(unsigned long baud);
+
+    /**
+     * @brief Признак скорости, заданной при компиляции (StaticModbusBus).
+     * @return true, если setBaud() не меняет скорость, иначе false.
+     */
+    bool baudFixed() const { return _baudFixed; }
+
+    /**
+     * @brief Текущая скорость шины.
+     * @return Скорость передачи данных.
+     */
+    unsigned long baud() const { return _baud; }
+
+    /**
+     * @brief Установка тайм-аута ответа ведомого.
+     * @param timeoutMs Тайм-аут (мс), по умолчанию 2000.
+     */
+    void setResponseTimeout(unsigned long timeoutMs) { _totalTimeout = timeoutMs; }
+
+    /**
+     * @brief Тайм-аут ответа ведомого.
+     * @return Тайм-аут (мс).
+     */
+    unsigned long responseTimeout() const { return _totalTimeout; }
+
+#ifdef HS321_TX_ISR
+    /**
+     * @brief Обработка прерывания USART TX Complete.
+     *
+     * Вызывается из обработчиков USARTn_TX_vect. Передаёт следующий байт кадра либо,
+     * после последнего байта, переключает трансивер RS485 на приём.
+     * Не предназначен для вызова из кода приложения.
+     *
+     * @param usart Номер аппаратного USART (0..3).
+     */
+    static void txCompleteInterrupt(uint8_t usart);
+#endif
+
+protected:
+    /**
+     * @brief Конструктор для шин с конфигурацией, заданной при компиляции (см. StaticModbusBus).
+     * @param serialPort Ссылка на объект HardwareSerial для связи с частотниками.
+     * @param serialDebug Указатель на порт отладочной информации (nullptr — без отладочного вывода).
+     * @param baud Скорость передачи данных.
+     * @param transmitterModeContact Номер цифрового пина для управления направлением RS485 (DE/RE).
+     * @param config Тайм-ауты и регистр пина DE/RE, вычисленные при компиляции.
+     */
+    ModbusBus(HardwareSerial& serialPort, HardwareSerial* serialDebug, unsigned long baud, uint8_t transmitterModeContact,
+              const FixedBusConfig& config);
+
+private:
+    friend class ModbusBusGroup;
+
+    /**
+     * @enum TransactionPhase
+     * @brief Фаза конечного автомата транзакции.
+     */
+    enum class TransactionPhase : uint8_t {
+        IDLE,       ///< Нет активной транзакции
+        TRANSMIT,   ///< Запрос передаётся в порт
+        DRAIN,      ///< Ожидание выхода последних байт из передатчика
+        RECEIVE,    ///< Приём ответа
+        TURNAROUND  ///< Пауза после широковещательного запроса
+    };
+
+    bool _initialized = false;               ///< Флаг успешной инициализации
+    HardwareSerial* _serialPort;             ///< Порт для связи с частотниками
+    HardwareSerial* _serialDebug;            ///< Порт для отладочного вывода
+    unsigned long _baud;                     ///< Скорость передачи данных
+    uint8_t _transmitterModeContact;         ///< Пин управления направлением RS485
+    unsigned long _totalTimeout;             ///< Общий таймаут ожидания ответа (мс)
+    unsigned long _interCharTimeout;         ///< Пауза t3.5 между кадрами (мкс)
+    unsigned long _characterTime;            ///< Время передачи одного символа (мкс)
+    bool _baudFixed = false;                 ///< Скорость задана при компиляции (StaticModbusBus)
+    unsigned long _broadcastDelay = 100;     ///< Пауза после широковещательной записи (мс)
+    ModbusBusGroup* _group = nullptr;        ///< Группа, в которую входит шина (nullptr — не входит)
+    RetryPolicy _retryPolicy;                ///< Политика повторов
+    HealthPolicy _healthPolicy;              ///< Политика учёта состояния связи
+    SlaveHealth _health[HS321_BUS_MAX_SLAVES]; ///< Состояние связи с ведомыми
+    ModbusTransaction _probe;                ///< Транзакция проверки связи с недоступным ведомым
+    uint16_t _probeValue = 0;                ///< Буфер значения проверки связи
+#if HS321_ENABLE_RTOS
+    TaskHandle_t _task = nullptr;            ///< Задача, владеющая шиной (nullptr — шину продвигает poll())
+#if defined(ARDUINO_ARCH_ESP32)
+    portMUX_TYPE _queueLock = portMUX_INITIALIZER_UNLOCKED; ///< Блокировка очередей между задачами и ядрами
+#endif
+#endif
+
+    /**
+     * @struct TransactionQueue
+     * @brief Кольцевой буфер ожидающих транзакций одного приоритета.
+     */
+    struct TransactionQueue {
+        ModbusTransaction* items[HS321_BUS_QUEUE_SIZE]; ///< Указатели на транзакции
+        uint8_t head = 0;                    ///< Индекс первой транзакции в очереди
+        uint8_t count = 0;                   ///< Количество транзакций в очереди
+        QueueStats stats;                    ///< Статистика очереди
+    };
+
+    TransactionQueue _queues[static_cast<uint8_t>(TransactionPriority::COUNT)]; ///< Очереди по приоритетам
+    uint8_t _lastSlave = 0;                  ///< Адрес ведомого последней запущенной транзакции
+
+    ModbusTransaction* _current = nullptr;   ///< Выполняемая транзакция
+    TransactionPhase _phase = TransactionPhase::IDLE; ///< Текущая фаза транзакции
+    uint8_t _frame[MAX_FRAME_SIZE];          ///< Буфер кадра: сначала запрос, затем ответ
+    size_t _txLength = 0;                    ///< Длина запроса в байтах
+    volatile size_t _txIndex = 0;            ///< Количество байт запроса, уже переданных в порт
+    size_t _rxLength = 0;                    ///< Ожидаемая длина ответа в байтах
+    size_t _rxIndex = 0;                     ///< Количество принятых байт ответа
+    uint16_t _rxCrc = 0;                     ///< CRC принятой части ответа, обновляется побайтно
+    unsigned long _phaseStart = 0;           ///< Время начала текущей фазы (мс)
+    unsigned long _responseTimeout = 0;      ///< Тайм-аут ответа текущей транзакции (мс)
+    unsigned long _startTime = 0;            ///< Время начала передачи текущей транзакции (мкс)
+    unsigned long _receiveStart = 0;         ///< Время переключения трансивера на приём (мкс)
+    unsigned long _firstByteTime = 0;        ///< Время приёма первого байта ответа (мкс)
+    TransactionStats _stats;                 ///< Статистика обмена по шине
+#if HS321_ENABLE_TRACE
+    ModbusTrace* _trace = nullptr;           ///< Трассировка кадров (nullptr — отключена)
+#endif
+    unsigned long _lastByteTime = 0;         ///< Время приёма последнего байта (мкс)
+    unsigned long _lastLineActivity = 0;     ///< Время последнего байта на линии: приёма или конца передачи (мкс)
+    bool _probeTurnUsed = false;             ///< Последней запущена проверка связи (следующей идёт обычная транзакция)
+    unsigned long _drainTime = 0;            ///< Расчётное время передачи остатка буфера (мкс)
+
+#ifdef __AVR__
+    volatile uint8_t* _dePort = nullptr;     ///< Регистр PORTx пина управления RS485
+    uint8_t _deMask = 0;                     ///< Битовая маска пина управления RS485 в регистре PORTx
+#endif
+
+#ifdef HS321_TX_ISR
+    /**
+     * @var NO_USART
+     * @brief Признак того, что порт не является аппаратным USART и передача идёт через буфер HardwareSerial.
+     */
+    static constexpr uint8_t NO_USART = 0xFF;
+
+    /**
+     * @var MAX_USART
+     * @brief Максимальное количество аппаратных USART (ATmega2560).
+     */
+    static constexpr uint8_t MAX_USART = 4;
+
+    static ModbusBus* volatile _txOwners[MAX_USART]; ///< Шины, передающие кадр через соответствующий USART
+    uint8_t _txUsart = NO_USART;             ///< Номер USART порта связи
+    volatile uint8_t* _ucsra = nullptr;      ///< Регистр состояния UCSRnA
+    volatile uint8_t* _ucsrb = nullptr;      ///< Регистр управления UCSRnB
+    volatile uint8_t* _udr = nullptr;        ///< Регистр данных UDRn
+    volatile bool _txDone = false;           ///< Последний стоп-бит кадра передан
+#endif
+
+    /**
+     * @brief Извлечение следующей транзакции из очереди указанного приоритета.
+     * @param priority Приоритет очереди.
+     * @return Указатель на транзакцию или nullptr, если готовых транзакций нет.
+     */
+    ModbusTransaction* dequeue(TransactionPriority priority);
+
+    /**
+     * @brief Извлечение транзакции из очереди одного приоритета с обходом ведомых по кругу.
+     * @param queue Очередь.
+     * @return Указатель на транзакцию или nullptr, если очередь пуста.
+     */
+    ModbusTransaction* dequeue(TransactionQueue& queue);
+
+    /**
+     * @brief Захват очередей на время их изменения (без FreeRTOS ничего не делает).
+     */
+    void lockQueues();
+
+    /**
+     * @brief Освобождение очередей после lockQueues().
+     */
+    void unlockQueues();
+
+    /**
+     * @brief Проверяет, вызван ли метод не из задачи, владеющей шиной.
+     * @return true, если задача шины запущена и вызов выполняется в другой задаче, иначе false.
+     */
+    bool foreignTask() const;
+
+#if HS321_ENABLE_RTOS
+    /**
+     * @brief Тело задачи шины.
+     * @param bus Указатель на ModbusBus.
+     */
+    static void taskMain(void* bus);
+#endif
+
+    /**
+     * @brief Формирование кадра запроса по описанию транзакции и запуск его передачи.
+     * @param transaction Транзакция для запуска.
+     */
+    void startTransaction(ModbusTransaction& transaction);
+
+    /**
+     * @brief Один шаг конечного автомата текущей транзакции.
+     */
+    void processTransaction();
+
+    /**
+     * @brief Проверка принятого ответа и извлечение прочитанных значений.
+     * @return NONE, EXCEPTION (ответ-исключение) или причина отказа.
+     */
+    TransactionError finishResponse();
+
+    /**
+     * @brief Завершение текущей транзакции и вызов callback.
+     * @param error Причина неудачи (NONE — COMPLETED, EXCEPTION — EXCEPTION, иначе FAILED).
+     */
+    void completeTransaction(TransactionError error);
+
+    /**
+     * @brief Учёт результата попытки в состоянии связи с ведомым.
+     * @param transaction Завершённая попытка.
+     * @param error Причина неудачи (NONE — успешно).
+     */
+    void recordOutcome(const ModbusTransaction& transaction, TransactionError error);
+
+    /**
+     * @brief Учёт завершённой попытки в блоке статистики.
+     * @param stats Блок статистики.
+     * @param error Причина неудачи (NONE — успешно).
+     * @param roundTrip Время кругового обмена (мкс).
+     * @param turnaround Время реакции ведомого (мкс).
+     */
+    void recordStats(TransactionStats& stats, TransactionError error, unsigned long roundTrip, unsigned long turnaround) const;
+
+    /**
+     * @brief Повторная постановка неудачной транзакции в очередь по политике повторов.
+     * @param transaction Завершившаяся неудачей попытка.
+     * @param error Причина неудачи.
+     * @return true, если транзакция поставлена на повтор, иначе false.
+     */
+    bool scheduleRetry(ModbusTransaction& transaction, TransactionError error);
+
+    /**
+     * @brief Проверка паузы t3.5 на линии перед передачей нового запроса.
+     *
+     * Байты, принятые вне транзакции (запоздалый ответ), отбрасываются и продлевают паузу.
+     *
+     * @return true, если с последнего байта на линии прошло не меньше t3.5, иначе false.
+     */
+    bool lineIdle();
+
+    /**
+     * @brief Запуск проверки связи с недоступным ведомым, если подошёл её срок.
+     * @return true, если проверка запущена, иначе false.
+     */
+    bool startProbe();
+
+    /**
+     * @brief Поиск записи состояния связи ведомого.
+     * @param slave Адрес ведомого.
+     * @param create Занять свободную запись, если ведомого ещё нет.
+     * @return Указатель на запись или nullptr.
+     */
+    SlaveHealth* findHealth(uint8_t slave, bool create);
+
+    /**
+     * @brief Постановка транзакции в конец очереди её приоритета.
+     * @param transaction Транзакция.
+     * @return true, если в очереди было место, иначе false.
+     */
+    bool enqueue(ModbusTransaction& transaction);
+
+    /**
+     * @brief Проверка корректности ответа Modbus.
+     * @param response Указатель на буфер с ответом.
+     * @param responseSize Размер ответа.
+     * @param expectedAddress Ожидаемый адрес устройства.
+     * @param expectedFunction Ожидаемая функция.
+     * @return NONE, если ответ корректен, иначе причина отказа.
+     */
+    TransactionError validateModbusResponse(const uint8_t* response, size_t responseSize, uint8_t expectedAddress, uint8_t expectedFunction) const;
+
+    /**
+     * @brief Вычисление CRC16 для пакета Modbus.
+     * @param data Указатель на данные.
+     * @param length Длина данных.
+     * @return Рассчитанное значение CRC16.
+     */
+    uint16_t calculateCRC(const uint8_t* data, size_t length) const;
+
+    /**
+     * @brief Переключение направления трансивера RS485 (DE/RE).
+     *
+     * Встраивается в место вызова, в том числе в обработчик TXC. На AVR пишет напрямую
+     * в регистр PORTx с запретом прерываний на время операции чтение-модификация-запись,
+     * на остальных платформах использует digitalWrite().
+     *
+     * @param transmit true — режим передачи, false — режим приёма.
+     */
+    void setTransmitMode(const bool transmit) {
+#ifdef __AVR__
+        const uint8_t oldSREG = SREG;
+        cli();
+        if (transmit) {
+            *_dePort |= _deMask;
+        } else {
+            *_dePort &= static_cast<uint8_t>(~_deMask);
+        }
+        SREG = oldSREG;
+#else
+        digitalWrite(_transmitterModeContact, transmit ? RS485Transmit : RS485Receive);
+#endif
+    }
+
+    /**
+     * @brief Неблокирующая передача запроса через последовательный порт.
+     *
+     * Переводит трансивер RS485 в режим передачи при первом вызове и дописывает в порт
+     * столько байт запроса, сколько помещается в его буфер передачи.
+     *
+     * @return true, если все байты запроса переданы, иначе false.
+     */
+    bool sendData();
+
+    /**
+     * @brief Неблокирующий приём байт ответа.
+     *
+     * Переносит доступные байты из порта в буфер кадра, не ожидая новых.
+     *
+     * @return true, если принят весь ожидаемый ответ, иначе false.
+     */
+    bool receiveData();
+};
@@ -0,0 +1,121 @@
+#include "ModbusBusGroup.h"
+
+/** @file ModbusBusGroup.cpp
+ * @brief Реализация совместного опроса нескольких шин Modbus RTU.
+ *
+ * @author Dmitry Chernikov
+ */
+
+/**
+ * @brief Деструктор класса ModbusBusGroup.
+ *
+ * Шины продолжают работать самостоятельно: execute() снова продвигает только свою шину.
+ */
+ModbusBusGroup::~ModbusBusGroup() {
+    for (uint8_t i = 0; i < _count; i++) {
+        _buses[i]->_group = nullptr;
+    }
+}
+
+/**
+ * @brief Добавление шины в группу.
+ *
+ * @param bus Шина на отдельном порту.
+ * @return true, если шина добавлена, иначе false.
+ */
+bool ModbusBusGroup::add(ModbusBus& bus) {
+    if (_count >= HS321_BUS_GROUP_SIZE || bus._group != nullptr) {
+        return false;
+    }
+    bus._group = this;
+    _buses[_count++] = &bus;
+    return true;
+}
+
+/**
+ * @brief Инициализация всех шин группы.
+ */
+void ModbusBusGroup::begin() {
+    for (uint8_t i = 0; i < _count; i++) {
+        _buses[i]->begin();
+    }
+}
+
+/**
+ * @brief Продвижение всех шин группы.
+ *
+ * Шины опрашиваются в порядке добавления; шаг каждой шины неблокирующий, поэтому
+ * задержка обслуживания порта не превышает времени одного прохода по группе.
+ *
+ * @return true, если хотя бы на одной шине есть незавершённые транзакции, иначе false.
+ */
+bool ModbusBusGroup::poll() {
+    bool busy = false;
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_buses[i]->poll()) {
+            busy = true;
+        }
+    }
+    return busy;
+}
+
+/**
+ * @brief Проверяет, есть ли выполняемые или ожидающие транзакции на шинах группы.
+ *
+ * @return true, если хотя бы одна шина занята, иначе false.
+ */
+bool ModbusBusGroup::isBusy() const {
+    for (uint8_t i = 0; i < _count; i++) {
+        if (_buses[i]->isBusy()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Суммарная статистика обмена по всем шинам группы.
+ *
+ * @return Статистика обмена.
+ */
+TransactionStats ModbusBusGroup::transactionStats() const {
+    TransactionStats total;
+    for (uint8_t i = 0; i < _count; i++) {
+        const TransactionStats& stats = _buses[i]->transactionStats();
+        total.transactions += stats.transactions;
+        total.bytesSent += stats.bytesSent;
+        total.bytesReceived += stats.bytesReceived;
+        total.crcErrors += stats.crcErrors;
+        total.timeouts += stats.timeouts;
+        total.exceptions += stats.exceptions;
+        total.otherErrors += stats.otherErrors;
+        if (stats.responses == 0) {
+            continue;
+        }
+        if (total.responses == 0 || stats.minRoundTrip < total.minRoundTrip) {
+            total.minRoundTrip = stats.minRoundTrip;
+        }
+        if (total.responses == 0 || stats.minTurnaround < total.minTurnaround) {
+            total.minTurnaround = stats.minTurnaround;
+        }
+        if (stats.maxRoundTrip > total.maxRoundTrip) {
+            total.maxRoundTrip = stats.maxRoundTrip;
+        }
+        if (stats.maxTurnaround > total.maxTurnaround) {
+            total.maxTurnaround = stats.maxTurnaround;
+        }
+        total.responses += stats.responses;
+        total.totalRoundTrip += stats.totalRoundTrip;
+        total.totalTurnaround += stats.totalTurnaround;
+    }
+    return total;
+}
+
+/**
+ * @brief Сброс статистики обмена всех шин группы.
+ */
+void ModbusBusGroup::resetTransactionStats() {
+    for (uint8_t i = 0; i < _count; i++) {
+        _buses[i]->resetTransactionStats();
+    }
+}
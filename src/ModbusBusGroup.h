@@ -0,0 +1,108 @@
+#pragma once
+
+/** @file ModbusBusGroup.h
+ * @brief Совместный опрос нескольких шин Modbus RTU на платах с несколькими UART.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "ModbusBus.h"
+
+/**
+ * @class ModbusBusGroup
+ * @brief Группа шин ModbusBus, транзакции которых выполняются параллельно.
+ *
+ * Каждая шина владеет своим портом (Serial1, Serial2, Serial3) и пином DE/RE, поэтому
+ * кадры на разных портах передаются и принимаются одновременно. Один вызов poll()
+ * продвигает все шины группы, и общая пропускная способность растёт пропорционально
+ * количеству портов.
+ *
+ * Блокирующие методы HS321 (ModbusBus::execute()) шины, входящей в группу, во время
+ * ожидания ответа продвигают всю группу: синхронный запрос к частотнику на одном порту
+ * не останавливает асинхронный опрос на остальных.
+ *
+ * @code
+ * ModbusBus bus1(Serial1, Serial, 9600, 2);
+ * ModbusBus bus2(Serial2, Serial, 9600, 3);
+ * ModbusBusGroup buses;
+ * buses.add(bus1);
+ * buses.add(bus2);
+ * buses.begin();
+ * // в loop():
+ * buses.poll();
+ * @endcode
+ */
+class ModbusBusGroup {
+public:
+    /**
+     * @brief Конструктор класса.
+     */
+    ModbusBusGroup() = default;
+
+    /**
+     * @brief Деструктор класса: шины исключаются из группы.
+     */
+    ~ModbusBusGroup();
+
+    ModbusBusGroup(const ModbusBusGroup&) = delete;
+    ModbusBusGroup& operator=(const ModbusBusGroup&) = delete;
+
+    /**
+     * @brief Добавление шины в группу.
+     * @param bus Шина на отдельном порту.
+     * @return true, если шина добавлена, иначе false (группа заполнена или шина уже входит в группу).
+     */
+    bool add(ModbusBus& bus);
+
+    /**
+     * @brief Инициализация всех шин группы (ModbusBus::begin()).
+     */
+    void begin();
+
+    /**
+     * @brief Продвижение всех шин группы.
+     *
+     * Вызывает ModbusBus::poll() каждой шины по одному разу. Должен вызываться из loop()
+     * как можно чаще. Никогда не ожидает поступления данных.
+     *
+     * @return true, если хотя бы на одной шине есть незавершённые транзакции, иначе false.
+     */
+    bool poll();
+
+    /**
+     * @brief Проверяет, есть ли выполняемые или ожидающие транзакции на шинах группы.
+     * @return true, если хотя бы одна шина занята, иначе false.
+     */
+    bool isBusy() const;
+
+    /**
+     * @brief Количество шин в группе.
+     * @return Количество шин.
+     */
+    uint8_t size() const { return _count; }
+
+    /**
+     * @brief Шина группы по номеру.
+     * @param index Номер шины в порядке добавления.
+     * @return Указатель на шину или nullptr, если index >= size().
+     */
+    ModbusBus* bus(uint8_t index) const { return (index < _count) ? _buses[index] : nullptr; }
+
+    /**
+     * @brief Суммарная статистика обмена по всем шинам группы.
+     *
+     * Счётчики складываются, минимальные и максимальные времена берутся по всем шинам.
+     *
+     * @return Статистика обмена.
+     */
+    TransactionStats transactionStats() const;
+
+    /**
+     * @brief Сброс статистики обмена всех шин группы.
+     */
+    void resetTransactionStats();
+
+private:
+    ModbusBus* _buses[HS321_BUS_GROUP_SIZE]; ///< Шины группы
+    uint8_t _count = 0;                      ///< Количество шин
+};
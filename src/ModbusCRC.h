@@ -0,0 +1,51 @@
+#pragma once
+
+/** @file ModbusCRC.h
+ * @brief Табличный расчёт контрольной суммы CRC16-Modbus.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include <Arduino.h>
+#include "HS321Config.h"
+
+/**
+ * @class ModbusCRC
+ * @brief Расчёт CRC16-Modbus (полином 0xA001, начальное значение 0xFFFF) по таблице во Flash (PROGMEM).
+ *
+ * Поддерживает как расчёт по целому буферу, так и пошаговое обновление,
+ * позволяющее вычислять CRC по мере приёма байт.
+ */
+class ModbusCRC {
+public:
+    /**
+     * @var INITIAL
+     * @brief Начальное значение CRC16-Modbus.
+     */
+    static constexpr uint16_t INITIAL = 0xFFFF;
+
+    /**
+     * @brief Обновление CRC очередным байтом.
+     * @param crc Текущее значение CRC (для первого байта — INITIAL).
+     * @param data Очередной байт данных.
+     * @return Новое значение CRC.
+     */
+    static uint16_t update(uint16_t crc, uint8_t data);
+
+    /**
+     * @brief Обновление CRC блоком данных.
+     * @param crc Текущее значение CRC.
+     * @param data Указатель на данные.
+     * @param length Длина данных в байтах.
+     * @return Новое значение CRC.
+     */
+    static uint16_t update(uint16_t crc, const uint8_t* data, size_t length);
+
+    /**
+     * @brief Расчёт CRC16-Modbus для буфера.
+     * @param data Указатель на данные.
+     * @param length Длина данных в байтах.
+     * @return Рассчитанное значение CRC16.
+     */
+    static uint16_t calculate(const uint8_t* data, size_t length) { return update(INITIAL, data, length); }
+};
@@ -0,0 +1,394 @@
+#include "HS321Config.h"
+
+#if HS321_ENABLE_CACHE
+
+#include "ModbusGateway.h"
+
+/** @file ModbusGateway.cpp
+ * @brief Реализация шлюза Modbus RTU для частотника HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#ifndef SERIAL_TX_BUFFER_SIZE
+#define SERIAL_TX_BUFFER_SIZE 64
+#endif
+
+/**
+ * @brief Конструктор класса ModbusGateway.
+ *
+ * @param port Порт, к которому подключены внешние ведущие.
+ * @param baud Скорость порта.
+ * @param address Адрес шлюза как ведомого.
+ * @param drive Частотник, данные которого раздаются.
+ * @param cache Зеркало регистров частотника.
+ * @param transmitterModeContact Пин управления направлением RS485 порта шлюза.
+ */
+ModbusGateway::ModbusGateway(HardwareSerial& port, const unsigned long baud, const uint8_t address, HS321& drive,
+                             RegisterCache& cache, const uint8_t transmitterModeContact)
+                                                                :_port(&port),
+                                                                _baud(baud),
+                                                                _address(address),
+                                                                _drive(&drive),
+                                                                _cache(&cache),
+                                                                _transmitterModeContact(transmitterModeContact),
+                                                                _frameGap(modbusFrameGap(baud)),
+                                                                _characterTime(modbusCharacterTime(baud)),
+                                                                _status{ { 0x1000, 0, 0, false }, { 0x3000, 0, 0, false }, { 0x8000, 0, 0, false } }{
+}
+
+/**
+ * @brief Инициализация порта шлюза и пина управления направлением.
+ *
+ * Трансивер переводится в режим приёма.
+ */
+void ModbusGateway::begin() {
+    _port->begin(_baud);
+    if (_transmitterModeContact != NO_PIN) {
+        pinMode(_transmitterModeContact, OUTPUT);
+    }
+    setTransmitMode(false);
+    _phase = Phase::RECEIVE;
+    _length = 0;
+}
+
+/**
+ * @brief Продвижение шлюза и шины частотника.
+ */
+void ModbusGateway::poll() {
+    _drive->bus()->poll();
+
+    switch (_phase) {
+        case Phase::RECEIVE:
+            receive();
+            return;
+
+        case Phase::FORWARD:
+            // Кадры ведущего, принятые во время обработки, отбрасываются
+            while (_port->available() > 0) {
+                _port->read();
+                _lastByteTime = micros();
+                _length = 1;
+            }
+            if (_transaction.status != TransactionStatus::PENDING) {
+                if (_length != 0) {
+                    _stats.rejected++;
+                }
+                completeForward();
+            }
+            return;
+
+        case Phase::TRANSMIT:
+            while (_txIndex < _length) {
+                const int freeSpace = _port->availableForWrite();
+                if (freeSpace <= 0) {
+                    return;
+                }
+                size_t chunk = _length - _txIndex;
+                if (chunk > static_cast<size_t>(freeSpace)) {
+                    chunk = static_cast<size_t>(freeSpace);
+                }
+                _txIndex += _port->write(_frame + _txIndex, chunk);
+            }
+            // Все байты в буфере порта: оцениваем время их выхода на линию, как ModbusBus
+            {
+                const int freeSpace = _port->availableForWrite();
+                const unsigned long pending = (freeSpace >= 0 && freeSpace < SERIAL_TX_BUFFER_SIZE)
+                                              ? static_cast<unsigned long>(SERIAL_TX_BUFFER_SIZE - freeSpace) + 1 : 1;
+                _drainTime = micros() + pending * _characterTime;
+            }
+            _phase = Phase::DRAIN;
+            return;
+
+        case Phase::DRAIN:
+            if (static_cast<long>(micros() - _drainTime) < 0) {
+                return;
+            }
+            _port->flush();
+            setTransmitMode(false);
+            // Байты, принятые во время передачи (эхо трансивера), не относятся к запросу
+            while (_port->available() > 0) {
+                _port->read();
+            }
+            _length = 0;
+            _phase = Phase::RECEIVE;
+            return;
+    }
+}
+
+/**
+ * @brief Приём байт запроса и обработка кадра после паузы t3.5.
+ *
+ * Конец кадра определяется по паузе t3.5 после последнего байта, как требует Modbus RTU.
+ */
+void ModbusGateway::receive() {
+    while (_port->available() > 0) {
+        const uint8_t data = static_cast<uint8_t>(_port->read());
+        if (_length < sizeof(_frame)) {
+            _frame[_length] = data;
+        }
+        _length++;
+        _lastByteTime = micros();
+    }
+    if (_length == 0 || micros() - _lastByteTime < _frameGap) {
+        return;
+    }
+    handleFrame();
+    if (_phase == Phase::RECEIVE) {
+        _length = 0;
+    }
+}
+
+/**
+ * @brief Разбор и обработка принятого кадра.
+ *
+ * Кадры других ведомых игнорируются молча, кадры с ошибкой CRC отбрасываются без ответа.
+ * Кадр известной функции короче её заголовка получает ILLEGAL_DATA_VALUE, неизвестная
+ * функция — ILLEGAL_FUNCTION.
+ */
+void ModbusGateway::handleFrame() {
+    if (_length < 4 || _length > sizeof(_frame) || ModbusCRC::calculate(_frame, _length) != 0) {
+        _stats.rejected++;
+        return;
+    }
+    const uint8_t slave = _frame[0];
+    if (slave != _address && slave != ModbusBus::BROADCAST_ADDRESS) {
+        return;
+    }
+    _stats.requests++;
+    _broadcast = (slave == ModbusBus::BROADCAST_ADDRESS);
+    _function = _frame[1];
+    if (_function != ModbusBus::READ && _function != ModbusBus::WRITE_ONE && _function != ModbusBus::WRITE_RANGE) {
+        respondException(ModbusException::ILLEGAL_FUNCTION);
+        return;
+    }
+    if (_length < 8) {
+        respondException(ModbusException::ILLEGAL_DATA_VALUE); // Нет адреса и количества (значения)
+        return;
+    }
+    _start = static_cast<uint16_t>((_frame[2] << 8) | _frame[3]);
+    _count = static_cast<uint16_t>((_frame[4] << 8) | _frame[5]);
+
+    switch (_function) {
+        case ModbusBus::READ:
+            if (_broadcast) {
+                return; // Чтение по широковещательному адресу не имеет смысла
+            }
+            if (_count == 0 || _count > ModbusBus::MAX_READ_REGISTERS) {
+                respondException(ModbusException::ILLEGAL_DATA_VALUE);
+            } else if (serveFromMirror()) {
+                _stats.cacheHits++;
+                respondRead();
+            } else {
+                _transaction.setRead(_drive->slaveAddress(), _start, _values, _count);
+                forward(TransactionPriority::NORMAL);
+            }
+            return;
+
+        case ModbusBus::WRITE_ONE:
+            _values[0] = _count;
+            _transaction.setWriteSingle(_drive->slaveAddress(), _start, _count);
+            forward((_start == 0x2000) ? TransactionPriority::URGENT : TransactionPriority::NORMAL);
+            return;
+
+        case ModbusBus::WRITE_RANGE:
+            if (_count == 0 || _count > ModbusBus::MAX_WRITE_REGISTERS || _length != 9 + static_cast<size_t>(_count) * 2 || _frame[6] != _count * 2) {
+                respondException(ModbusException::ILLEGAL_DATA_VALUE);
+                return;
+            }
+            for (uint16_t i = 0; i < _count; i++) {
+                _values[i] = static_cast<uint16_t>((_frame[7 + i * 2] << 8) | _frame[8 + i * 2]);
+            }
+            _transaction.setWrite(_drive->slaveAddress(), _start, _values, _count);
+            forward((_start <= 0x2000 && 0x2000 < _start + _count) ? TransactionPriority::URGENT : TransactionPriority::NORMAL);
+            return;
+
+        default:
+            respondException(ModbusException::ILLEGAL_FUNCTION);
+            return;
+    }
+}
+
+/**
+ * @brief Обслуживание чтения, если все регистры есть в зеркале.
+ *
+ * @return true, если все значения взяты из зеркала, иначе false.
+ */
+bool ModbusGateway::serveFromMirror() {
+    const unsigned long now = millis();
+    for (uint16_t i = 0; i < _count; i++) {
+        const uint16_t address = static_cast<uint16_t>(_start + i);
+        if (_cache->lookup(address, &_values[i])) {
+            continue;
+        }
+        const StatusRegister* status = findStatus(address);
+        if (status == nullptr || !status->valid || now - status->stamp > _statusTtl) {
+            return false;
+        }
+        _values[i] = status->value;
+    }
+    return true;
+}
+
+/**
+ * @brief Передача текущего запроса частотнику.
+ *
+ * @param priority Приоритет в очереди шины.
+ */
+void ModbusGateway::forward(const TransactionPriority priority) {
+    _transaction.priority = priority;
+    _drive->attachStats(_transaction);
+    if (!_drive->bus()->submit(_transaction)) {
+        // Очередь шины заполнена: ведущему предлагается повторить запрос позже
+        respondException(ModbusException::SLAVE_DEVICE_BUSY);
+        return;
+    }
+    _stats.forwarded++;
+    _length = 0;
+    _phase = Phase::FORWARD;
+}
+
+/**
+ * @brief Обработка ответа частотника и формирование ответа ведущему.
+ *
+ * Успешно прочитанные и записанные значения сохраняются в зеркале; записанные значения
+ * заменяют и ожидающие записи значения RegisterCache. Команда 0x2000 меняет состояние
+ * и код неисправности, поэтому их значения в зеркале сбрасываются.
+ */
+void ModbusGateway::completeForward() {
+    if (_transaction.status == TransactionStatus::EXCEPTION) {
+        respondException(static_cast<ModbusException>(_transaction.exceptionCode));
+        return;
+    }
+    if (_transaction.status != TransactionStatus::COMPLETED) {
+        respondException((_transaction.error == TransactionError::SLAVE_OFFLINE || _transaction.error == TransactionError::NOT_INITIALIZED)
+                         ? ModbusException::GATEWAY_PATH_UNAVAILABLE : ModbusException::GATEWAY_TARGET_FAILED);
+        return;
+    }
+    const uint16_t registers = (_function == ModbusBus::WRITE_ONE) ? 1 : _count;
+    storeMirror(_start, _values, registers, _function != ModbusBus::READ);
+    if (_function == ModbusBus::READ) {
+        respondRead();
+        return;
+    }
+    if (_start <= 0x2000 && 0x2000 < _start + registers) {
+        findStatus(0x3000)->valid = false;
+        findStatus(0x8000)->valid = false;
+    }
+    respondWrite();
+}
+
+/**
+ * @brief Сохранение значений в зеркале.
+ *
+ * @param address Адрес первого регистра.
+ * @param values Значения.
+ * @param count Количество регистров.
+ * @param written Значения записаны в частотник (заменяют ожидающую запись RegisterCache).
+ */
+void ModbusGateway::storeMirror(const uint16_t address, const uint16_t* values, const size_t count, const bool written) {
+    if (written) {
+        _cache->replace(address, values, count);
+    } else {
+        _cache->fill(address, values, count);
+    }
+    const unsigned long now = millis();
+    for (size_t i = 0; i < count; i++) {
+        StatusRegister* status = findStatus(static_cast<uint16_t>(address + i));
+        if (status != nullptr) {
+            status->value = values[i];
+            status->stamp = now;
+            status->valid = true;
+        }
+    }
+}
+
+/**
+ * @brief Поиск регистра в зеркале шлюза.
+ *
+ * @param address Адрес регистра.
+ * @return Указатель на запись или nullptr.
+ */
+ModbusGateway::StatusRegister* ModbusGateway::findStatus(const uint16_t address) {
+    for (StatusRegister& status : _status) {
+        if (status.address == address) {
+            return &status;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Формирование ответа на чтение из _values.
+ */
+void ModbusGateway::respondRead() {
+    _frame[0] = _address;
+    _frame[1] = ModbusBus::READ;
+    _frame[2] = static_cast<uint8_t>(_count * 2);
+    for (uint16_t i = 0; i < _count; i++) {
+        _frame[3 + i * 2] = static_cast<uint8_t>(_values[i] >> 8);
+        _frame[4 + i * 2] = static_cast<uint8_t>(_values[i] & 0xFF);
+    }
+    _length = 3 + static_cast<size_t>(_count) * 2;
+    transmit();
+}
+
+/**
+ * @brief Формирование ответа на запись: эхо адреса и количества (значения для 0x06).
+ */
+void ModbusGateway::respondWrite() {
+    _frame[0] = _address;
+    _frame[1] = _function;
+    _frame[2] = static_cast<uint8_t>(_start >> 8);
+    _frame[3] = static_cast<uint8_t>(_start & 0xFF);
+    _frame[4] = static_cast<uint8_t>(_count >> 8);
+    _frame[5] = static_cast<uint8_t>(_count & 0xFF);
+    _length = 6;
+    transmit();
+}
+
+/**
+ * @brief Формирование ответа-исключения.
+ *
+ * @param code Код исключения Modbus.
+ */
+void ModbusGateway::respondException(const ModbusException code) {
+    _stats.exceptions++;
+    _frame[0] = _address;
+    _frame[1] = static_cast<uint8_t>(_function | 0x80);
+    _frame[2] = static_cast<uint8_t>(code);
+    _length = 3;
+    transmit();
+}
+
+/**
+ * @brief Запуск передачи ответа.
+ *
+ * Дописывает CRC к кадру длиной _length. На широковещательный запрос ответ не передаётся.
+ */
+void ModbusGateway::transmit() {
+    if (_broadcast) {
+        _length = 0;
+        _phase = Phase::RECEIVE;
+        return;
+    }
+    const uint16_t crc = ModbusCRC::calculate(_frame, _length);
+    _frame[_length++] = static_cast<uint8_t>(crc & 0xFF);
+    _frame[_length++] = static_cast<uint8_t>(crc >> 8);
+    _txIndex = 0;
+    setTransmitMode(true);
+    _phase = Phase::TRANSMIT;
+}
+
+/**
+ * @brief Переключение направления трансивера RS485 порта шлюза.
+ *
+ * @param transmit true — режим передачи, false — режим приёма.
+ */
+void ModbusGateway::setTransmitMode(const bool transmit) {
+    if (_transmitterModeContact != NO_PIN) {
+        digitalWrite(_transmitterModeContact, transmit ? RS485Transmit : RS485Receive);
+    }
+}
+
+#endif // HS321_ENABLE_CACHE
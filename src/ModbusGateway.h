@@ -0,0 +1,228 @@
+#pragma once
+
+/** @file ModbusGateway.h
+ * @brief Шлюз Modbus RTU: ведомый на втором порту, обслуживающий внешних ведущих из зеркала регистров HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "HS321.h"
+#include "RegisterCache.h"
+
+/**
+ * @struct GatewayStats
+ * @brief Счётчики запросов шлюза.
+ */
+struct GatewayStats {
+    unsigned long requests = 0;      ///< Принято кадров, адресованных шлюзу
+    unsigned long cacheHits = 0;     ///< Чтений, обслуженных из зеркала без обращения к частотнику
+    unsigned long forwarded = 0;     ///< Запросов, переданных частотнику через очередь шины
+    unsigned long exceptions = 0;    ///< Отправлено ответов-исключений
+    unsigned long rejected = 0;      ///< Отброшено кадров (ошибка CRC, короткий кадр, шлюз занят)
+};
+
+/**
+ * @class ModbusGateway
+ * @brief Ведомый Modbus RTU, который раздаёт данные одного частотника нескольким ведущим.
+ *
+ * Частотник HS321 допускает только одного ведущего, поэтому HMI, ПЛК и другие системы
+ * подключаются к шлюзу, а к частотнику обращается только ModbusBus этой платы.
+ *
+ * Чтение (0x03) обслуживается из зеркала: параметры групп F и d берутся из RegisterCache
+ * (параметры d — не старше его TTL), а регистры 0x1000, 0x3000 и 0x8000 — из собственного
+ * зеркала шлюза (не старше statusTtl). Если хотя бы одного регистра запроса в зеркале нет,
+ * запрос целиком передаётся частотнику, а ответ сохраняется в зеркале: ведущие, опрашивающие
+ * одни и те же регистры чаще TTL, порождают один физический опрос.
+ *
+ * Запись (0x06, 0x10) всегда передаётся частотнику через очередь шины, команды управления
+ * 0x2000 — с приоритетом URGENT. Ответ ведущему отправляется только после ответа частотника;
+ * ответ-исключение частотника передаётся ведущему, а его отсутствие — исключением 0x0B
+ * (GATEWAY_TARGET_FAILED). Широковещательная запись (адрес 0) выполняется без ответа.
+ * Запись внешнего ведущего, подтверждённая частотником, новее локальной: она заменяет
+ * значение RegisterCache, ожидающее flush(), и эта локальная запись отменяется.
+ *
+ * Шлюз обрабатывает один запрос за раз: кадры, принятые, пока предыдущий запрос
+ * передаётся частотнику, отбрасываются (ведущий повторит запрос по тайм-ауту).
+ * Для нескольких ведущих на разных портах создаётся по шлюзу на порт с общими HS321 и RegisterCache.
+ *
+ * @note Тайм-аут ответа шины частотника (ModbusBus::setResponseTimeout()) должен быть меньше
+ *       тайм-аута внешних ведущих, иначе они не дождутся исключения 0x0B.
+ */
+class ModbusGateway {
+public:
+    /**
+     * @var NO_PIN
+     * @brief Признак порта без управления направлением (RS232, полнодуплексный RS422).
+     */
+    static constexpr uint8_t NO_PIN = 0xFF;
+
+    /**
+     * @brief Конструктор класса.
+     * @param port Порт, к которому подключены внешние ведущие.
+     * @param baud Скорость порта.
+     * @param address Адрес шлюза как ведомого (1..247).
+     * @param drive Частотник, данные которого раздаются.
+     * @param cache Зеркало регистров частотника.
+     * @param transmitterModeContact Пин управления направлением RS485 порта шлюза (NO_PIN — без управления).
+     */
+    ModbusGateway(HardwareSerial& port, unsigned long baud, uint8_t address, HS321& drive, RegisterCache& cache,
+                  uint8_t transmitterModeContact = NO_PIN);
+
+    /**
+     * @brief Инициализация порта шлюза и пина управления направлением.
+     */
+    void begin();
+
+    /**
+     * @brief Продвижение шлюза и шины частотника.
+     *
+     * Должен вызываться из loop() как можно чаще. Никогда не ожидает ответа.
+     */
+    void poll();
+
+    /**
+     * @brief Установка времени актуальности зеркала регистров 0x1000, 0x3000 и 0x8000.
+     * @param ttl Время в миллисекундах (0 — всегда читать с частотника).
+     */
+    void setStatusTtl(unsigned long ttl) { _statusTtl = ttl; }
+
+    /**
+     * @brief Счётчики запросов шлюза.
+     * @return Ссылка на счётчики.
+     */
+    const GatewayStats& stats() const { return _stats; }
+
+    /**
+     * @brief Сброс счётчиков запросов.
+     */
+    void resetStats() { _stats = GatewayStats(); }
+
+    /**
+     * @brief Проверяет, обрабатывается ли запрос.
+     * @return true, если запрос передаётся частотнику или отправляется ответ, иначе false.
+     */
+    bool isBusy() const { return _phase != Phase::RECEIVE; }
+
+private:
+    /**
+     * @enum Phase
+     * @brief Фаза обработки запроса.
+     */
+    enum class Phase : uint8_t {
+        RECEIVE,    ///< Приём запроса
+        FORWARD,    ///< Запрос передаётся частотнику
+        TRANSMIT,   ///< Ответ передаётся в порт
+        DRAIN       ///< Ожидание выхода последних байт ответа
+    };
+
+    /**
+     * @struct StatusRegister
+     * @brief Зеркало регистра вне групп параметров.
+     */
+    struct StatusRegister {
+        uint16_t address;            ///< Адрес регистра
+        uint16_t value;              ///< Значение
+        unsigned long stamp;         ///< Время получения значения (мс)
+        bool valid;                  ///< Значение получено
+    };
+
+    /**
+     * @var STATUS_COUNT
+     * @brief Количество регистров в зеркале шлюза (0x1000, 0x3000, 0x8000).
+     */
+    static constexpr uint8_t STATUS_COUNT = 3;
+
+    HardwareSerial* _port;                   ///< Порт внешних ведущих
+    unsigned long _baud;                     ///< Скорость порта
+    uint8_t _address;                        ///< Адрес шлюза
+    HS321* _drive;                           ///< Частотник
+    RegisterCache* _cache;                   ///< Зеркало регистров параметров
+    uint8_t _transmitterModeContact;         ///< Пин управления направлением RS485
+    unsigned long _frameGap;                 ///< Пауза t3.5 на скорости порта (мкс)
+    unsigned long _characterTime;            ///< Время передачи символа (мкс)
+    unsigned long _statusTtl = 500;          ///< Время актуальности зеркала StatusRegister (мс)
+    StatusRegister _status[STATUS_COUNT];    ///< Зеркало регистров 0x1000, 0x3000, 0x8000
+    Phase _phase = Phase::RECEIVE;           ///< Текущая фаза
+    uint8_t _frame[ModbusBus::MAX_FRAME_SIZE]; ///< Буфер кадра: запрос, затем ответ
+    size_t _length = 0;                      ///< Принято байт запроса или длина ответа
+    size_t _txIndex = 0;                     ///< Передано байт ответа в порт
+    unsigned long _lastByteTime = 0;         ///< Время приёма последнего байта запроса (мкс)
+    unsigned long _drainTime = 0;            ///< Расчётное время выхода последнего байта ответа (мкс)
+    bool _broadcast = false;                 ///< Текущий запрос широковещательный
+    uint8_t _function = 0;                   ///< Функция текущего запроса
+    uint16_t _start = 0;                     ///< Адрес первого регистра текущего запроса
+    uint16_t _count = 0;                     ///< Количество регистров (значение для 0x06)
+    uint16_t _values[ModbusBus::MAX_READ_REGISTERS]; ///< Значения текущего запроса (чтение или запись)
+    ModbusTransaction _transaction;          ///< Транзакция передачи запроса частотнику
+    GatewayStats _stats;                     ///< Счётчики запросов
+
+    /**
+     * @brief Приём байт запроса и обработка кадра после паузы t3.5.
+     */
+    void receive();
+
+    /**
+     * @brief Разбор и обработка принятого кадра.
+     */
+    void handleFrame();
+
+    /**
+     * @brief Обслуживание чтения, если все регистры есть в зеркале.
+     * @return true, если значения взяты из зеркала, иначе false.
+     */
+    bool serveFromMirror();
+
+    /**
+     * @brief Передача текущего запроса частотнику.
+     * @param priority Приоритет в очереди шины.
+     */
+    void forward(TransactionPriority priority);
+
+    /**
+     * @brief Обработка ответа частотника и формирование ответа ведущему.
+     */
+    void completeForward();
+
+    /**
+     * @brief Сохранение значений в зеркале.
+     * @param address Адрес первого регистра.
+     * @param values Значения.
+     * @param count Количество регистров.
+     * @param written Значения записаны в частотник (заменяют ожидающую запись RegisterCache).
+     */
+    void storeMirror(uint16_t address, const uint16_t* values, size_t count, bool written);
+
+    /**
+     * @brief Поиск регистра в зеркале шлюза.
+     * @param address Адрес регистра.
+     * @return Указатель на запись или nullptr, если регистра нет в зеркале шлюза.
+     */
+    StatusRegister* findStatus(uint16_t address);
+
+    /**
+     * @brief Формирование ответа на чтение из _values.
+     */
+    void respondRead();
+
+    /**
+     * @brief Формирование ответа на запись (эхо адреса и количества/значения).
+     */
+    void respondWrite();
+
+    /**
+     * @brief Формирование ответа-исключения.
+     * @param code Код исключения Modbus.
+     */
+    void respondException(ModbusException code);
+
+    /**
+     * @brief Запуск передачи ответа длиной _length (без CRC) или возврат к приёму для широковещательного запроса.
+     */
+    void transmit();
+
+    /**
+     * @brief Переключение направления трансивера RS485 порта шлюза.
+     * @param transmit true — режим передачи, false — режим приёма.
+     */
+    void setTransmitMode(bool transmit);
+};
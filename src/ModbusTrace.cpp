@@ -0,0 +1,144 @@
+#include "HS321Config.h"
+
+#if HS321_ENABLE_TRACE
+
+#include "ModbusTrace.h"
+
+/** @file ModbusTrace.cpp
+ * @brief Реализация трассировки кадров Modbus в кольцевой буфер ОЗУ.
+ *
+ * @author Dmitry Chernikov
+ */
+
+/**
+ * @brief Запись кадра в буфер.
+ *
+ * Освобождает место, удаляя самые старые записи, затем копирует заголовок и байты кадра.
+ *
+ * @param flags RESPONSE для ответа и код TransactionError в младших битах.
+ * @param timestamp Метка времени (мкс).
+ * @param frame Байты кадра.
+ * @param length Длина кадра.
+ */
+void ModbusTrace::record(const uint8_t flags, const unsigned long timestamp, const uint8_t* frame, const size_t length) {
+    const size_t total = HEADER_SIZE + length;
+    if (length > 0xFF || total > HS321_TRACE_SIZE || (frame == nullptr && length > 0)) {
+        _dropped++;
+        return;
+    }
+    while (HS321_TRACE_SIZE - _size < total) {
+        dropOldest();
+    }
+
+    const uint8_t header[HEADER_SIZE] = {
+        MARKER,
+        flags,
+        static_cast<uint8_t>(timestamp >> 24),
+        static_cast<uint8_t>((timestamp >> 16) & 0xFF),
+        static_cast<uint8_t>((timestamp >> 8) & 0xFF),
+        static_cast<uint8_t>(timestamp & 0xFF),
+        static_cast<uint8_t>(length)
+    };
+    size_t head = (_tail + _size) % HS321_TRACE_SIZE;
+    for (uint8_t i = 0; i < HEADER_SIZE; i++) {
+        _buffer[head] = header[i];
+        head = (head + 1) % HS321_TRACE_SIZE;
+    }
+    for (size_t i = 0; i < length; i++) {
+        _buffer[head] = frame[i];
+        head = (head + 1) % HS321_TRACE_SIZE;
+    }
+    _size += total;
+}
+
+/**
+ * @brief Выгрузка всех записей с очисткой буфера.
+ *
+ * @param out Поток вывода.
+ */
+void ModbusTrace::dump(Print& out) {
+    while (_size > 0) {
+        out.write(pop());
+    }
+}
+
+/**
+ * @brief Выгрузка части записей без ожидания освобождения передатчика.
+ *
+ * @param out Последовательный порт.
+ * @return Количество переданных байт.
+ */
+size_t ModbusTrace::stream(HardwareSerial& out) {
+    const int space = out.availableForWrite();
+    return send(out, (space > 0) ? static_cast<size_t>(space) : 0);
+}
+
+/**
+ * @brief Выгрузка части записей в произвольный поток.
+ *
+ * @param out Поток вывода.
+ * @param budget Наибольшее количество байт, если поток не сообщает свободное место.
+ * @return Количество переданных байт.
+ */
+size_t ModbusTrace::stream(Print& out, const size_t budget) {
+    const int space = out.availableForWrite();
+    // 0 у Print без собственной реализации availableForWrite() означает «неизвестно»
+    return send(out, (space > 0) ? static_cast<size_t>(space) : budget);
+}
+
+/**
+ * @brief Передача не более limit невыгруженных байт.
+ *
+ * @param out Поток вывода.
+ * @param limit Наибольшее количество байт.
+ * @return Количество переданных байт.
+ */
+size_t ModbusTrace::send(Print& out, const size_t limit) {
+    size_t sent = 0;
+    while (_size > 0 && sent < limit) {
+        out.write(pop());
+        sent++;
+    }
+    return sent;
+}
+
+/**
+ * @brief Удаление всех записей.
+ */
+void ModbusTrace::clear() {
+    _tail = 0;
+    _size = 0;
+    _tailRemaining = 0;
+}
+
+/**
+ * @brief Удаление самой старой записи (или невыгруженного остатка частично выгруженной записи).
+ */
+void ModbusTrace::dropOldest() {
+    const size_t length = (_tailRemaining > 0) ? _tailRemaining
+                        : HEADER_SIZE + _buffer[(_tail + HEADER_SIZE - 1) % HS321_TRACE_SIZE];
+    _tail = (_tail + length) % HS321_TRACE_SIZE;
+    _size -= length;
+    _tailRemaining = 0;
+    _dropped++;
+}
+
+/**
+ * @brief Извлечение первого невыгруженного байта.
+ *
+ * На границе записи запоминает её длину, чтобы dropOldest() мог удалить невыгруженный остаток.
+ *
+ * @return Байт буфера.
+ */
+uint8_t ModbusTrace::pop() {
+    if (_tailRemaining == 0) {
+        _tailRemaining = HEADER_SIZE + _buffer[(_tail + HEADER_SIZE - 1) % HS321_TRACE_SIZE];
+    }
+    const uint8_t data = _buffer[_tail];
+    _tail = (_tail + 1) % HS321_TRACE_SIZE;
+    _size--;
+    _tailRemaining--;
+    return data;
+}
+
+#endif // HS321_ENABLE_TRACE
@@ -0,0 +1,155 @@
+#pragma once
+
+/** @file ModbusTrace.h
+ * @brief Трассировка кадров Modbus в кольцевой буфер ОЗУ.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include <Arduino.h>
+#include "HS321Config.h"
+
+#if !HS321_ENABLE_TRACE
+#error "Трассировка отключена (HS321_ENABLE_TRACE = 0)"
+#endif
+
+/**
+ * @class ModbusTrace
+ * @brief Запись сырых кадров шины с метками времени без вывода в порт.
+ *
+ * В отличие от отладочного вывода (DEBUG) запись кадра — только копирование байт в ОЗУ,
+ * поэтому трассировка не меняет временные характеристики обмена. Буфер выгружается
+ * позже по запросу (dump()) или понемногу из loop() (stream()) без ожидания освобождения
+ * передатчика. При переполнении удаляются самые старые записи.
+ *
+ * Формат записи (в буфере и в выгрузке одинаковый, многобайтные поля — старшим байтом вперёд):
+ * @code
+ * [0]     MARKER (0xA5)
+ * [1]     бит 7 — направление (0 — запрос, 1 — ответ), биты 0–6 — TransactionError ответа
+ * [2..5]  метка времени micros() (начало передачи запроса или первый байт ответа)
+ * [6]     n — длина кадра
+ * [7..]   n байт кадра
+ * @endcode
+ * Ответ без принятых байт (тайм-аут) записывается с n = 0. Декодер на стороне ПК — tools/decode_trace.py.
+ *
+ * @code
+ * ModbusTrace trace;
+ * bus.setTrace(&trace);
+ * ...
+ * trace.stream(Serial); // в loop()
+ * @endcode
+ */
+class ModbusTrace {
+public:
+    /**
+     * @var MARKER
+     * @brief Первый байт каждой записи (для синхронизации декодера).
+     */
+    static constexpr uint8_t MARKER = 0xA5;
+
+    /**
+     * @var RESPONSE
+     * @brief Флаг направления «ответ» во втором байте записи.
+     */
+    static constexpr uint8_t RESPONSE = 0x80;
+
+    /**
+     * @var HEADER_SIZE
+     * @brief Размер заголовка записи в байтах.
+     */
+    static constexpr uint8_t HEADER_SIZE = 7;
+
+    /**
+     * @var STREAM_BUDGET
+     * @brief Байт за вызов stream() для потока, не сообщающего свободное место.
+     */
+    static constexpr size_t STREAM_BUDGET = 16;
+
+    /**
+     * @brief Запись кадра.
+     *
+     * Запись, не помещающаяся в буфер целиком, отбрасывается.
+     *
+     * @param flags RESPONSE для ответа и код TransactionError в младших битах.
+     * @param timestamp Метка времени (мкс).
+     * @param frame Байты кадра.
+     * @param length Длина кадра.
+     */
+    void record(uint8_t flags, unsigned long timestamp, const uint8_t* frame, size_t length);
+
+    /**
+     * @brief Выгрузка всех записей с очисткой буфера.
+     *
+     * Блокирует на время передачи; вызывается, когда обмен по шине не идёт.
+     *
+     * @param out Поток вывода.
+     */
+    void dump(Print& out);
+
+    /**
+     * @brief Выгрузка части записей без ожидания в аппаратный порт.
+     *
+     * Передаёт столько байт, сколько помещается в буфер передачи порта (availableForWrite()),
+     * поэтому может вызываться в каждом проходе loop(). Если старая запись удаляется
+     * во время её передачи, декодер пропускает оборванную запись по маркеру.
+     *
+     * @param out Последовательный порт.
+     * @return Количество переданных байт (0, если буфер передачи заполнен).
+     */
+    size_t stream(HardwareSerial& out);
+
+    /**
+     * @brief Выгрузка части записей в произвольный поток.
+     *
+     * Для Print, не сообщающего свободное место (availableForWrite() возвращает 0 по
+     * умолчанию), 0 означает «неизвестно», и передаётся не больше budget байт.
+     *
+     * @param out Поток вывода.
+     * @param budget Наибольшее количество байт за вызов, если поток не сообщает свободное место.
+     * @return Количество переданных байт.
+     */
+    size_t stream(Print& out, size_t budget = STREAM_BUDGET);
+
+    /**
+     * @brief Удаление всех записей.
+     */
+    void clear();
+
+    /**
+     * @brief Количество байт в буфере.
+     * @return Количество невыгруженных байт.
+     */
+    size_t size() const { return _size; }
+
+    /**
+     * @brief Количество записей, удалённых при переполнении или не поместившихся в буфер.
+     * @return Количество потерянных записей.
+     */
+    unsigned long dropped() const { return _dropped; }
+
+private:
+    uint8_t _buffer[HS321_TRACE_SIZE];       ///< Кольцевой буфер записей
+    size_t _tail = 0;                        ///< Индекс первого невыгруженного байта
+    size_t _size = 0;                        ///< Количество невыгруженных байт
+    size_t _tailRemaining = 0;               ///< Остаток частично выгруженной первой записи (0 — _tail на границе записи)
+    unsigned long _dropped = 0;              ///< Количество потерянных записей
+
+    /**
+     * @brief Удаление самой старой записи.
+     */
+    void dropOldest();
+
+    /**
+     * @brief Извлечение первого невыгруженного байта.
+     * @return Байт буфера.
+     */
+    uint8_t pop();
+
+    /**
+     * @brief Передача не более limit невыгруженных байт.
+     * @param out Поток вывода.
+     * @param limit Наибольшее количество байт.
+     * @return Количество переданных байт.
+     */
+    size_t send(Print& out, size_t limit);
+};
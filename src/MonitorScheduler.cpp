@@ -0,0 +1,333 @@
+#include "MonitorScheduler.h"
+#include "ParameterGroup.h"
+
+/** @file MonitorScheduler.cpp
+ * @brief Реализация планировщика опроса параметров мониторинга частотника HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+/**
+ * @brief Конструктор класса MonitorScheduler.
+ *
+ * Изначально ни один сигнал не опрашивается.
+ *
+ * @param drive Частотник, параметры которого опрашиваются.
+ */
+MonitorScheduler::MonitorScheduler(HS321& drive)
+                                                                :_drive(&drive){
+}
+
+/**
+ * @brief Назначение периода опроса сигналу.
+ *
+ * Сигнал с новым периодом опрашивается при ближайшем вызове poll().
+ *
+ * @param numberGroup Номер параметра в группе d.
+ * @param period Период опроса в миллисекундах (0 — исключить сигнал из опроса).
+ * @return true, если период назначен, иначе false.
+ */
+bool MonitorScheduler::setPeriod(const uint8_t numberGroup, const unsigned long period) {
+    if (numberGroup >= SIGNAL_COUNT) {
+        return false;
+    }
+    _signals[numberGroup].period = period;
+    _signals[numberGroup].due = millis();
+    return true;
+}
+
+/**
+ * @brief Продвижение опроса.
+ *
+ * Продвигает шину; по завершении кадра публикует значения, а при свободной
+ * транзакции ставит в очередь кадр для сигналов с наступившим сроком.
+ */
+void MonitorScheduler::poll() {
+    _drive->bus()->poll();
+
+    if (_transaction.status == TransactionStatus::PENDING) {
+        return;
+    }
+    if (_count > 0) {
+        // Кадр завершён
+        if (_transaction.status == TransactionStatus::COMPLETED) {
+            publish();
+        } else {
+            _failedFrames++;
+        }
+        _count = 0;
+    }
+    dispatch(millis());
+}
+
+/**
+ * @brief Выбор сигналов с наступившим сроком и постановка кадра в очередь шины.
+ *
+ * Кадр охватывает диапазон от младшего до старшего сигнала с наступившим сроком.
+ * Срок каждого сигнала в диапазоне переносится на следующий период; если сигнал опоздал
+ * больше чем на период, пропущенные периоды учитываются, а отсчёт начинается заново от now.
+ *
+ * @param now Текущее время (мс).
+ */
+void MonitorScheduler::dispatch(const unsigned long now) {
+    int first = -1;
+    int last = -1;
+    for (uint8_t i = 0; i < SIGNAL_COUNT; i++) {
+        const Signal& signal = _signals[i];
+        if (signal.period != 0 && static_cast<long>(now - signal.due) >= 0) {
+            if (first < 0) {
+                first = i;
+            }
+            last = i;
+        }
+    }
+    if (first < 0) {
+        return;
+    }
+
+    _first = static_cast<uint8_t>(first);
+    _count = static_cast<uint8_t>(last - first + 1);
+    _transaction.setRead(_drive->slaveAddress(), HS321::buildParameterAddress(GROUP_d, _first), _buffer, _count);
+    _drive->attachStats(_transaction);
+    if (!_drive->bus()->submit(_transaction)) {
+        // Очередь шины заполнена: повторная попытка при следующем poll()
+        _count = 0;
+        return;
+    }
+
+    for (uint8_t i = _first; i < _first + _count; i++) {
+        Signal& signal = _signals[i];
+        if (signal.period == 0) {
+            continue;
+        }
+        const unsigned long late = now - signal.due;
+        if (static_cast<long>(late) < 0) {
+            // Попутное обновление сигнала с ненаступившим сроком
+            signal.due = now + signal.period;
+        } else if (late >= signal.period) {
+            const unsigned long missed = late / signal.period;
+            signal.missed += missed;
+            _missedTotal += missed;
+            signal.due = now + signal.period;
+        } else {
+            signal.due += signal.period;
+        }
+    }
+}
+
+/**
+ * @brief Публикация значений прочитанного кадра.
+ *
+ * Все значения кадра получают общую отметку времени получения ответа.
+ */
+void MonitorScheduler::publish() {
+    _snapshotTime = millis();
+    bool changed = false;
+    for (uint8_t i = 0; i < _count; i++) {
+        MonitorSample& sample = _signals[_first + i].sample;
+        sample.value = _buffer[i];
+        sample.timestamp = _snapshotTime;
+        sample.valid = true;
+        if (detectChange(_first + i)) {
+            changed = true;
+        }
+    }
+    if (_callback != nullptr) {
+        _callback(*this, _callbackContext);
+    }
+    if (changed && _changeCallback != nullptr) {
+        _changeCallback(*this, _changeContext);
+    }
+}
+
+/**
+ * @brief Проверка нового значения сигнала по зоне нечувствительности.
+ *
+ * Сигналы без периода опроса, прочитанные попутно, изменений не публикуют.
+ *
+ * @param numberGroup Номер параметра в группе d.
+ * @return true, если значение опубликовано как изменение.
+ */
+bool MonitorScheduler::detectChange(const uint8_t numberGroup) {
+    Signal& signal = _signals[numberGroup];
+    if (signal.period == 0) {
+        return false;
+    }
+    const uint16_t value = signal.sample.value;
+    if (signal.hasReported) {
+        const uint16_t distance = (value > signal.reported) ? value - signal.reported : signal.reported - value;
+        if (distance == 0 || distance <= signal.deadband) {
+            if (distance != 0) {
+                _suppressed++;
+            }
+            return false;
+        }
+    }
+    signal.reported = value;
+    signal.hasReported = true;
+    _pending |= 1UL << numberGroup;
+    return true;
+}
+
+/**
+ * @brief Установка зоны нечувствительности сигнала в единицах регистра.
+ *
+ * @param numberGroup Номер параметра в группе d.
+ * @param deadband Допустимое отклонение.
+ * @return true, если зона установлена, иначе false.
+ */
+bool MonitorScheduler::setDeadband(const uint8_t numberGroup, const uint16_t deadband) {
+    if (numberGroup >= SIGNAL_COUNT) {
+        return false;
+    }
+    _signals[numberGroup].deadband = deadband;
+    return true;
+}
+
+/**
+ * @brief Установка зоны нечувствительности в процентах от диапазона параметра.
+ *
+ * Диапазон берётся из каталога и переводится в единицы регистра (× 10^decimals);
+ * зона округляется вниз.
+ *
+ * @param numberGroup Номер параметра в группе d.
+ * @param percent Процент диапазона (0..100).
+ * @return true, если зона установлена, иначе false.
+ */
+bool MonitorScheduler::setDeadbandPercent(const uint8_t numberGroup, const uint8_t percent) {
+    Parameter param;
+    if (numberGroup >= SIGNAL_COUNT || percent > 100
+            || !ParameterGroup::findNumeric(HS321::buildParameterAddress(GROUP_d, numberGroup), param)
+            || param.type == ParameterType::STRING) {
+        return false;
+    }
+    long span;
+    if (param.type == ParameterType::FLOAT) {
+        span = ScaledValue::fromFloat(param.maxSetting.floatValue, param.decimals).value
+               - ScaledValue::fromFloat(param.minSetting.floatValue, param.decimals).value;
+    } else {
+        span = param.maxSetting.intValue - param.minSetting.intValue;
+    }
+    const long deadband = span * percent / 100;
+    return setDeadband(numberGroup, static_cast<uint16_t>((deadband > 0xFFFF) ? 0xFFFF : deadband));
+}
+
+/**
+ * @brief Зона нечувствительности сигнала.
+ *
+ * @param numberGroup Номер параметра в группе d.
+ * @return Допустимое отклонение в единицах регистра (0 для номера вне группы).
+ */
+uint16_t MonitorScheduler::deadband(const uint8_t numberGroup) const {
+    return (numberGroup < SIGNAL_COUNT) ? _signals[numberGroup].deadband : 0;
+}
+
+/**
+ * @brief Упаковка накопленных изменений в пакет.
+ *
+ * Записи идут по возрастанию номера параметра. Разность с последним переданным
+ * значением, помещающаяся в int8_t, занимает один байт, иначе передаётся значение целиком.
+ *
+ * @param buffer Буфер пакета.
+ * @param size Размер буфера.
+ * @return Длина пакета или 0.
+ */
+size_t MonitorScheduler::encodeChanges(uint8_t* buffer, const size_t size) {
+    if (buffer == nullptr || _pending == 0 || size < 1 + MAX_CHANGE_SIZE) {
+        return 0;
+    }
+    size_t length = 1;
+    uint8_t entries = 0;
+    for (uint8_t i = 0; i < SIGNAL_COUNT && length + MAX_CHANGE_SIZE <= size; i++) {
+        if ((_pending & (1UL << i)) == 0) {
+            continue;
+        }
+        Signal& signal = _signals[i];
+        const int16_t delta = static_cast<int16_t>(signal.reported - signal.sent);
+        if (signal.hasSent && delta >= -128 && delta <= 127) {
+            buffer[length++] = i;
+            buffer[length++] = static_cast<uint8_t>(delta);
+        } else {
+            buffer[length++] = static_cast<uint8_t>(i | CHANGE_ABSOLUTE);
+            buffer[length++] = static_cast<uint8_t>(signal.reported >> 8);
+            buffer[length++] = static_cast<uint8_t>(signal.reported & 0xFF);
+        }
+        signal.sent = signal.reported;
+        signal.hasSent = true;
+        _pending &= ~(1UL << i);
+        entries++;
+    }
+    buffer[0] = entries;
+    return length;
+}
+
+/**
+ * @brief Повторная передача всех значений абсолютными записями.
+ */
+void MonitorScheduler::resyncChanges() {
+    for (uint8_t i = 0; i < SIGNAL_COUNT; i++) {
+        Signal& signal = _signals[i];
+        signal.hasSent = false;
+        if (signal.period != 0 && signal.hasReported) {
+            _pending |= 1UL << i;
+        }
+    }
+}
+
+/**
+ * @brief Установка функции обратного вызова, вызываемой после кадра с изменениями.
+ *
+ * @param callback Функция обратного вызова (nullptr — отключить).
+ * @param context Пользовательский указатель, передаваемый в callback.
+ */
+void MonitorScheduler::onChange(const MonitorCallback callback, void* context) {
+    _changeCallback = callback;
+    _changeContext = context;
+}
+
+/**
+ * @brief Последнее значение сигнала.
+ *
+ * @param numberGroup Номер параметра в группе d.
+ * @return Ссылка на значение.
+ */
+const MonitorSample& MonitorScheduler::sample(const uint8_t numberGroup) const {
+    static const MonitorSample empty;
+    if (numberGroup >= SIGNAL_COUNT) {
+        return empty;
+    }
+    return _signals[numberGroup].sample;
+}
+
+/**
+ * @brief Количество пропущенных сроков опроса сигнала.
+ *
+ * @param numberGroup Номер параметра в группе d.
+ * @return Количество пропущенных периодов.
+ */
+unsigned long MonitorScheduler::missedDeadlines(const uint8_t numberGroup) const {
+    return (numberGroup < SIGNAL_COUNT) ? _signals[numberGroup].missed : 0;
+}
+
+/**
+ * @brief Сброс счётчиков пропущенных сроков, ошибок и отброшенных значений.
+ */
+void MonitorScheduler::resetStatistics() {
+    for (Signal& signal : _signals) {
+        signal.missed = 0;
+    }
+    _missedTotal = 0;
+    _failedFrames = 0;
+    _suppressed = 0;
+}
+
+/**
+ * @brief Установка функции обратного вызова, вызываемой после каждого прочитанного кадра.
+ *
+ * @param callback Функция обратного вызова (nullptr — отключить).
+ * @param context Пользовательский указатель, передаваемый в callback.
+ */
+void MonitorScheduler::onSnapshot(const MonitorCallback callback, void* context) {
+    _callback = callback;
+    _callbackContext = context;
+}
@@ -0,0 +1,256 @@
+#pragma once
+
+/** @file MonitorScheduler.h
+ * @brief Периодический опрос параметров мониторинга (группа d) частотника HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "HS321.h"
+
+/**
+ * @struct MonitorSample
+ * @brief Последнее прочитанное значение параметра мониторинга.
+ */
+struct MonitorSample {
+    uint16_t value = 0;             ///< Значение регистра
+    unsigned long timestamp = 0;    ///< Время получения ответа (мс, millis())
+    bool valid = false;             ///< Значение хотя бы раз прочитано
+};
+
+class MonitorScheduler;
+
+/**
+ * @typedef MonitorCallback
+ * @brief Функция обратного вызова, вызываемая после каждого прочитанного кадра.
+ *
+ * @param scheduler Планировщик, значения которого обновились.
+ * @param context Пользовательский указатель, переданный в MonitorScheduler::onSnapshot().
+ */
+typedef void (*MonitorCallback)(const MonitorScheduler& scheduler, void* context);
+
+/**
+ * @class MonitorScheduler
+ * @brief Планировщик опроса параметров группы d с индивидуальным периодом для каждого сигнала.
+ *
+ * Каждому сигналу (номер параметра группы d) назначается период опроса. При каждом вызове poll()
+ * планировщик выбирает сигналы, срок опроса которых наступил, и читает их одним кадром 0x03,
+ * охватывающим диапазон от младшего до старшего из них; попавшие в диапазон сигналы с
+ * ненаступившим сроком обновляются попутно. Значения публикуются с отметкой времени.
+ *
+ * Если сигнал читается позже, чем через целый период после назначенного срока, пропущенные
+ * периоды учитываются как нарушения сроков — признак того, что заданные периоды превышают
+ * пропускную способность шины.
+ *
+ * Для передачи по медленному каналу (SCADA) планировщик публикует только изменения
+ * (report-by-exception): значение сигнала считается изменившимся, если оно отличается от
+ * последнего опубликованного больше чем на зону нечувствительности (setDeadband(),
+ * setDeadbandPercent()). Изменения накапливаются до вызова encodeChanges(), который
+ * упаковывает их в компактный пакет с разностным кодированием:
+ *
+ *     [количество записей] затем записи [метка][данные]
+ *     метка: биты 0–4 — номер параметра группы d, бит 7 — абсолютное значение
+ *     данные: разность с предыдущим переданным значением (int8_t) или значение (uint16_t, старший байт первым)
+ *
+ * Разность считается по модулю 2^16, поэтому приёмник восстанавливает значение сложением
+ * в uint16_t. Первая передача сигнала (и первая после resyncChanges()) — абсолютная.
+ */
+class MonitorScheduler {
+public:
+    /**
+     * @var SIGNAL_COUNT
+     * @brief Количество параметров в группе мониторинга d.
+     */
+    static constexpr uint8_t SIGNAL_COUNT = groupSizes[GROUP_COUNT - 1];
+
+    /**
+     * @brief Конструктор класса.
+     * @param drive Частотник, параметры которого опрашиваются.
+     */
+    explicit MonitorScheduler(HS321& drive);
+
+    /**
+     * @brief Назначение периода опроса сигналу.
+     * @param numberGroup Номер параметра в группе d.
+     * @param period Период опроса в миллисекундах (0 — исключить сигнал из опроса).
+     * @return true, если период назначен, иначе false (номер вне группы d).
+     */
+    bool setPeriod(uint8_t numberGroup, unsigned long period);
+
+    /**
+     * @brief Продвижение опроса.
+     *
+     * Должен вызываться из loop() как можно чаще. Никогда не ожидает ответа.
+     */
+    void poll();
+
+    /**
+     * @brief Последнее значение сигнала.
+     * @param numberGroup Номер параметра в группе d.
+     * @return Ссылка на значение (valid == false, если сигнал ещё не прочитан или номер вне группы).
+     */
+    const MonitorSample& sample(uint8_t numberGroup) const;
+
+    /**
+     * @brief Количество пропущенных сроков опроса сигнала.
+     * @param numberGroup Номер параметра в группе d.
+     * @return Количество пропущенных периодов.
+     */
+    unsigned long missedDeadlines(uint8_t numberGroup) const;
+
+    /**
+     * @brief Суммарное количество пропущенных сроков опроса всех сигналов.
+     * @return Количество пропущенных периодов.
+     */
+    unsigned long missedDeadlines() const { return _missedTotal; }
+
+    /**
+     * @brief Количество кадров, завершившихся ошибкой.
+     * @return Количество неудачных кадров.
+     */
+    unsigned long failedFrames() const { return _failedFrames; }
+
+    /**
+     * @brief Время получения последнего кадра.
+     * @return Время (мс, millis()) или 0, если кадров ещё не было.
+     */
+    unsigned long snapshotTime() const { return _snapshotTime; }
+
+    /**
+     * @brief Сброс счётчиков пропущенных сроков, ошибок и отброшенных значений.
+     */
+    void resetStatistics();
+
+    /**
+     * @brief Установка функции обратного вызова, вызываемой после каждого прочитанного кадра.
+     * @param callback Функция обратного вызова (nullptr — отключить).
+     * @param context Пользовательский указатель, передаваемый в callback.
+     */
+    void onSnapshot(MonitorCallback callback, void* context = nullptr);
+
+    /**
+     * @brief Установка зоны нечувствительности сигнала в единицах регистра.
+     * @param numberGroup Номер параметра в группе d.
+     * @param deadband Допустимое отклонение (0 — публиковать любое изменение), например 50 для 0.50 Гц.
+     * @return true, если зона установлена, иначе false (номер вне группы d).
+     */
+    bool setDeadband(uint8_t numberGroup, uint16_t deadband);
+
+    /**
+     * @brief Установка зоны нечувствительности в процентах от диапазона параметра из каталога.
+     * @param numberGroup Номер параметра в группе d.
+     * @param percent Процент диапазона minSetting..maxSetting (0..100).
+     * @return true, если зона установлена, иначе false (номер вне группы, параметра нет в каталоге, percent > 100).
+     */
+    bool setDeadbandPercent(uint8_t numberGroup, uint8_t percent);
+
+    /**
+     * @brief Зона нечувствительности сигнала.
+     * @param numberGroup Номер параметра в группе d.
+     * @return Допустимое отклонение в единицах регистра.
+     */
+    uint16_t deadband(uint8_t numberGroup) const;
+
+    /**
+     * @brief Сигналы с изменениями, ещё не переданными encodeChanges().
+     * @return Битовая маска: бит n — параметр d-n.
+     */
+    uint32_t pendingChanges() const { return _pending; }
+
+    /**
+     * @brief Упаковка накопленных изменений в пакет.
+     *
+     * Изменения, не поместившиеся в буфер, остаются в pendingChanges() до следующего вызова.
+     *
+     * @param buffer Буфер пакета.
+     * @param size Размер буфера (не менее 1 + MAX_CHANGE_SIZE для хотя бы одной записи).
+     * @return Длина пакета или 0, если изменений нет или буфер слишком мал.
+     */
+    size_t encodeChanges(uint8_t* buffer, size_t size);
+
+    /**
+     * @brief Повторная передача всех значений абсолютными записями.
+     *
+     * Вызывается, когда приёмник потерял состояние (переподключение канала): все прочитанные
+     * сигналы с периодом опроса становятся изменёнными.
+     */
+    void resyncChanges();
+
+    /**
+     * @brief Количество значений, отброшенных зоной нечувствительности.
+     * @return Количество значений.
+     */
+    unsigned long suppressedSamples() const { return _suppressed; }
+
+    /**
+     * @brief Установка функции обратного вызова, вызываемой после кадра с изменениями.
+     * @param callback Функция обратного вызова (nullptr — отключить).
+     * @param context Пользовательский указатель, передаваемый в callback.
+     */
+    void onChange(MonitorCallback callback, void* context = nullptr);
+
+    /**
+     * @var MAX_CHANGE_SIZE
+     * @brief Наибольший размер одной записи пакета изменений (метка и абсолютное значение).
+     */
+    static constexpr size_t MAX_CHANGE_SIZE = 3;
+
+    /**
+     * @var CHANGE_ABSOLUTE
+     * @brief Бит метки записи с абсолютным значением.
+     */
+    static constexpr uint8_t CHANGE_ABSOLUTE = 0x80;
+
+private:
+    /**
+     * @struct Signal
+     * @brief Расписание и последнее значение одного сигнала.
+     */
+    struct Signal {
+        unsigned long period = 0;    ///< Период опроса (мс), 0 — сигнал не опрашивается
+        unsigned long due = 0;       ///< Срок следующего опроса (мс)
+        unsigned long missed = 0;    ///< Количество пропущенных сроков
+        MonitorSample sample;        ///< Последнее значение
+        uint16_t deadband = 0;       ///< Зона нечувствительности (единицы регистра)
+        uint16_t reported = 0;       ///< Последнее опубликованное значение
+        uint16_t sent = 0;           ///< Последнее значение, переданное encodeChanges()
+        bool hasReported = false;    ///< Значение хотя бы раз опубликовано
+        bool hasSent = false;        ///< Значение хотя бы раз передано (иначе запись абсолютная)
+    };
+
+    static_assert(SIGNAL_COUNT <= 32, "маска изменений рассчитана не более чем на 32 сигнала");
+
+    HS321* _drive;                           ///< Частотник, параметры которого опрашиваются
+    Signal _signals[SIGNAL_COUNT];           ///< Сигналы, индексируемые номером параметра группы d
+    uint16_t _buffer[SIGNAL_COUNT];          ///< Буфер значений текущего кадра
+    ModbusTransaction _transaction;          ///< Транзакция текущего кадра
+    uint8_t _first = 0;                      ///< Номер первого параметра текущего кадра
+    uint8_t _count = 0;                      ///< Количество параметров текущего кадра
+    unsigned long _missedTotal = 0;          ///< Суммарное количество пропущенных сроков
+    unsigned long _failedFrames = 0;         ///< Количество неудачных кадров
+    unsigned long _snapshotTime = 0;         ///< Время получения последнего кадра (мс)
+    MonitorCallback _callback = nullptr;     ///< Функция обратного вызова
+    void* _callbackContext = nullptr;        ///< Пользовательский указатель для callback
+    uint32_t _pending = 0;                   ///< Маска изменений, не переданных encodeChanges()
+    unsigned long _suppressed = 0;           ///< Значений, отброшенных зоной нечувствительности
+    MonitorCallback _changeCallback = nullptr; ///< Функция обратного вызова при изменениях
+    void* _changeContext = nullptr;          ///< Пользовательский указатель для _changeCallback
+
+    /**
+     * @brief Выбор сигналов с наступившим сроком и постановка кадра в очередь шины.
+     * @param now Текущее время (мс).
+     */
+    void dispatch(unsigned long now);
+
+    /**
+     * @brief Публикация значений прочитанного кадра.
+     */
+    void publish();
+
+    /**
+     * @brief Проверка нового значения сигнала по зоне нечувствительности.
+     * @param numberGroup Номер параметра в группе d.
+     * @return true, если значение опубликовано как изменение.
+     */
+    bool detectChange(uint8_t numberGroup);
+};
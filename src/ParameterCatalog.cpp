@@ -0,0 +1,1333 @@
+#include "ParameterCatalog.h"
+
+/** @file ParameterCatalog.cpp
+ * @brief Данные каталога параметров и кодов ошибок частотника HS321 во Flash.
+ *
+ * Одинаковые строки (единицы измерения, «Резерв», повторяющиеся описания) хранятся один раз.
+ * Значение F0.00 по умолчанию зависит от модели и подставляется в ParametersHS321::getParameter().
+ *
+ * @author Dmitry Chernikov
+ */
+
+static const char emptyText[] PROGMEM = "";
+
+#if HS321_ENABLE_CATALOG
+
+// --- Названия групп ---
+static const char groupName0[] PROGMEM = "F0 - Основные рабочие параметры";
+static const char groupName1[] PROGMEM = "F1 - Параметры управления V/F";
+static const char groupName2[] PROGMEM = "F2 - Параметры управления вектором";
+static const char groupName3[] PROGMEM = "F3 - Вспомогательные рабочие параметры";
+static const char groupName4[] PROGMEM = "F4 - Вспомогательные рабочие параметры 2";
+static const char groupName5[] PROGMEM = "F5 - Параметры цифрового ввода/вывода";
+static const char groupName6[] PROGMEM = "F6 - Функции аналогового входа и выхода";
+static const char groupName7[] PROGMEM = "F7 - Параметры выполнения программы (ПЛК)";
+static const char groupName8[] PROGMEM = "F8 - Параметры ПИД";
+static const char groupName9[] PROGMEM = "F9 - Параметры двигателя";
+static const char groupName10[] PROGMEM = "FA - Параметры защиты";
+static const char groupName11[] PROGMEM = "Fb - Отображение и специальные параметры";
+static const char groupName12[] PROGMEM = "FC - Параметры связи";
+static const char groupName13[] PROGMEM = "FP - Заводские параметры";
+static const char groupName14[] PROGMEM = "d - Параметры мониторинга";
+
+const char* const parameterGroupNames[GROUP_COUNT] PROGMEM = {
+    groupName0, groupName1, groupName2, groupName3, groupName4, groupName5, groupName6, groupName7, groupName8, groupName9, groupName10, groupName11, groupName12, groupName13, groupName14
+};
+
+const uint16_t parameterGroupStart[GROUP_COUNT + 1] PROGMEM = {
+    0, 21, 36, 70, 79, 88, 105, 120, 146, 201, 209, 236, 259, 265, 266, 286
+};
+
+// --- Строки параметров ---
+static const char nameF0_00[] PROGMEM = "F0.00";
+static const char unitKiloWatt[] PROGMEM = "кВт";
+static const char descF0_00[] PROGMEM = "Текущая мощность переменного привода";
+static const char nameF0_01[] PROGMEM = "F0.01";
+static const char descF0_01[] PROGMEM = "0: V/F управление\n1: Открытый вектор";
+static const char nameF0_02[] PROGMEM = "F0.02";
+static const char descF0_02[] PROGMEM = "0: Команда запуска с панели\n1: Команда запуска с терминала\n2: Команда запуска по связи";
+static const char nameF0_03[] PROGMEM = "F0.03";
+static const char descF0_03[] PROGMEM = "0: Цифровая установка (предустановленная частота F0-07, регулируется с помощью UP/DOWN, отключение без памяти)\n1: Цифровая установка (предустановленная частота F0-07, регулируется с помощью UP/DOWN, отключение с памятью)\n2: AI1 (AVI)\n3: AI2 (ACI)\n4: AI3 (Клавиатурный потенциометр)\n5: Команда многоскорости\n6: Простой ПЛК\n7: PID\n8: Связь";
+static const char nameF0_04[] PROGMEM = "F0.04";
+static const char nameF0_05[] PROGMEM = "F0.05";
+static const char descF0_05[] PROGMEM = "0: Основная + вспомогательная\n1: Основная - вспомогательная\n2: Макс. (основная, вспомогательная)\n3: Мин. (основная, вспомогательная)";
+static const char nameF0_06[] PROGMEM = "F0.06";
+static const char descF0_06[] PROGMEM = "0: Основной источник частоты X\n1: Основной и вспомогательный расчет (определяется расчетом в F0.05)\n2: Переключение между основным источником частоты X и вспомогательным источником частоты Y\n3: Переключение между основным источником частоты X и “основным & вспомогательным расчетом”\n4: Переключение между вспомогательным источником частоты Y и “основным & вспомогательным расчетом”";
+static const char nameF0_07[] PROGMEM = "F0.07";
+static const char unitHertz[] PROGMEM = "Гц";
+static const char descF0_07[] PROGMEM = "Установленное значение является заданным начальным значением цифровой частоты";
+static const char nameF0_08[] PROGMEM = "F0.08";
+static const char descF0_08[] PROGMEM = "Максимальная выходная частота является наивысшей частотой, разрешенной для выхода переменного привода, и эталоном для настроек ускорения и замедления.";
+static const char nameF0_09[] PROGMEM = "F0.09";
+static const char descF0_09[] PROGMEM = "Рабочая частота не должна превышать эту частоту";
+static const char nameF0_10[] PROGMEM = "F0.10";
+static const char descF0_10[] PROGMEM = "Рабочая частота не должна быть ниже этой частоты";
+static const char nameF0_11[] PROGMEM = "F0.11";
+static const char descF0_11[] PROGMEM = "0: Работает на нулевой скорости\n1: Работает на нижнем пределе частоты\n2: Остановка";
+static const char nameF0_12[] PROGMEM = "F0.12";
+static const char unitSecond[] PROGMEM = "с";
+static const char descF0_12[] PROGMEM = "Время, необходимое для ускорения переменного привода от нулевой частоты до максимальной выходной частоты";
+static const char nameF0_13[] PROGMEM = "F0.13";
+static const char descF0_13[] PROGMEM = "Время, необходимое для замедления переменного привода от максимальной выходной частоты до нулевой частоты";
+static const char nameF0_14[] PROGMEM = "F0.14";
+static const char descF0_14[] PROGMEM = "0: Прямое вращение\n1: Обратное вращение\n2: Запрещено обратное вращение";
+static const char nameF0_15[] PROGMEM = "F0.15";
+static const char descF0_15[] PROGMEM = "При установке числа, отличного от 0, пароль будет работать; после расшифровки, если установлен 0000, функция пароля будет отменена.";
+static const char text1[] PROGMEM = "xx.xx";
+static const char text2[] PROGMEM = "01.00";
+static const char text3[] PROGMEM = "99.99";
+static const char nameF0_16[] PROGMEM = "F0.16";
+static const char descF0_16[] PROGMEM = "Текущая версия программного обеспечения.";
+static const char nameF0_17[] PROGMEM = "F0.17";
+static const char descF0_17[] PROGMEM = "0: Без действия\n1: Восстановить заводские настройки (исключая параметры двигателя)\n2: Очистка ошибок\n3: Восстановить все параметры до заводских настроек (включая параметры двигателя)";
+static const char nameF0_18[] PROGMEM = "F0.18";
+static const char descReserved[] PROGMEM = "Резерв";
+static const char nameF0_19[] PROGMEM = "F0.19";
+static const char nameF0_20[] PROGMEM = "F0.20";
+static const char descF0_20[] PROGMEM = "0: Не сохранять\n1: Сохранять";
+static const char nameF1_00[] PROGMEM = "F1.00";
+static const char descF1_00[] PROGMEM = "0: Линейная кривая\n1: Квадратная кривая\n2: Кривая 1,5 степени\n3: Кривая 1,2 степени\n4: Многоточечная кривая VF";
+static const char nameF1_01[] PROGMEM = "F1.01";
+static const char unitPercent[] PROGMEM = "%";
+static const char descF1_01[] PROGMEM = "Ручное увеличение крутящего момента, это значение устанавливается как процент относительно номинального напряжения двигателя.\nКогда оно равно 0, переключается на автоматическое увеличение крутящего момента.";
+static const char nameF1_02[] PROGMEM = "F1.02";
+static const char descF1_02[] PROGMEM = "Частота отсечения для ручного увеличения крутящего момента";
+static const char nameF1_03[] PROGMEM = "F1.03";
+static const char unitKiloHertz[] PROGMEM = "КГц";
+static const char descF1_03[] PROGMEM = "Увеличение несущей частоты может снизить шум, но увеличит тепловыделение переменного привода.";
+static const char nameF1_04[] PROGMEM = "F1.04";
+static const char descF1_04[] PROGMEM = "Частотное значение V/F F1";
+static const char nameF1_05[] PROGMEM = "F1.05";
+static const char descF1_05[] PROGMEM = "Напряжение V/F V1";
+static const char nameF1_06[] PROGMEM = "F1.06";
+static const char descF1_06[] PROGMEM = "Частотное значение V/F F2";
+static const char nameF1_07[] PROGMEM = "F1.07";
+static const char descF1_07[] PROGMEM = "Напряжение V/F V2";
+static const char nameF1_08[] PROGMEM = "F1.08";
+static const char descF1_08[] PROGMEM = "Частотное значение V/F F3";
+static const char nameF1_09[] PROGMEM = "F1.09";
+static const char descF1_09[] PROGMEM = "Напряжение V/F V3";
+static const char nameF1_10[] PROGMEM = "F1.10";
+static const char descF1_10[] PROGMEM = "0: Недействительно; 1: Действительно на всем протяжении; 2: Недействительно во время замедления, действительно во время ускорения и на постоянной скорости";
+static const char nameF1_11[] PROGMEM = "F1.11";
+static const char descF1_11[] PROGMEM = "Коэффициент торможения тормозного резистора";
+static const char nameF1_12[] PROGMEM = "F1.12";
+static const char descF1_12[] PROGMEM = "Увеличение компенсации крутящего момента";
+static const char nameF1_13[] PROGMEM = "F1.13";
+static const char descF1_13[] PROGMEM = "Увеличение возбуждения V/F";
+static const char nameF1_14[] PROGMEM = "F1.14";
+static const char descF1_14[] PROGMEM = "Режим подавления колебаний";
+static const char nameF2_00[] PROGMEM = "F2.00";
+static const char descF2_00[] PROGMEM = "Kp низкоскоростного контура скорости";
+static const char nameF2_01[] PROGMEM = "F2.01";
+static const char descF2_01[] PROGMEM = "Ki низкоскоростного контура скорости";
+static const char nameF2_02[] PROGMEM = "F2.02";
+static const char descF2_02[] PROGMEM = "Kp высокоскоростного контура скорости";
+static const char nameF2_03[] PROGMEM = "F2.03";
+static const char descF2_03[] PROGMEM = "Ki высокоскоростного контура скорости";
+static const char nameF2_04[] PROGMEM = "F2.04";
+static const char descF2_04[] PROGMEM = "Точка переключения расчета частоты низкоскоростного контура";
+static const char nameF2_05[] PROGMEM = "F2.05";
+static const char descF2_05[] PROGMEM = "Точка переключения расчета частоты высокоскоростного контура";
+static const char nameF2_06[] PROGMEM = "F2.06";
+static const char descF2_06[] PROGMEM = "Компенсация электрического скольжения";
+static const char nameF2_07[] PROGMEM = "F2.07";
+static const char nameF2_08[] PROGMEM = "F2.08";
+static const char nameF2_09[] PROGMEM = "F2.09";
+static const char nameF2_10[] PROGMEM = "F2.10";
+static const char descF2_10[] PROGMEM = "Kp контура тока";
+static const char nameF2_11[] PROGMEM = "F2.11";
+static const char descF2_11[] PROGMEM = "Ki контура тока";
+static const char nameF2_12[] PROGMEM = "F2.12";
+static const char nameF2_13[] PROGMEM = "F2.13";
+static const char nameF2_14[] PROGMEM = "F2.14";
+static const char descF2_14[] PROGMEM = "Коэффициент компенсации скольжения открытого векторного управления";
+static const char nameF2_15[] PROGMEM = "F2.15";
+static const char nameF2_16[] PROGMEM = "F2.16";
+static const char nameF2_17[] PROGMEM = "F2.17";
+static const char nameF2_18[] PROGMEM = "F2.18";
+static const char nameF2_19[] PROGMEM = "F2.19";
+static const char descF2_19[] PROGMEM = "Цифровая установка предела крутящего момента в контроле скорости (привод)";
+static const char nameF2_20[] PROGMEM = "F2.20";
+static const char descF2_20[] PROGMEM = "Максимальный коэффициент крутящего момента зоны ослабления поля";
+static const char nameF2_21[] PROGMEM = "F2.21";
+static const char descF2_21[] PROGMEM = "М-осевой коэффициент масштаба контура тока";
+static const char nameF2_22[] PROGMEM = "F2.22";
+static const char descF2_22[] PROGMEM = "М-осевой интегральный коэффициент контура тока";
+static const char nameF2_23[] PROGMEM = "F2.23";
+static const char descF2_23[] PROGMEM = "Фильтр временной константы контура скорости открытого векторного управления";
+static const char nameF2_24[] PROGMEM = "F2.24";
+static const char descF2_24[] PROGMEM = "Открытое векторное управление увеличения крутящего момента";
+static const char nameF2_25[] PROGMEM = "F2.25";
+static const char descF2_25[] PROGMEM = "Частота отсечения открытого векторного управления увеличения крутящего момента";
+static const char nameF2_26[] PROGMEM = "F2.26";
+static const char descF2_26[] PROGMEM = "Фильтр заданного крутящего момента";
+static const char nameF2_27[] PROGMEM = "F2.27";
+static const char descF2_27[] PROGMEM = "Максимальный коэффициент модуляции ослабления поля";
+static const char nameF2_28[] PROGMEM = "F2.28";
+static const char descF2_28[] PROGMEM = "Коэффициент компенсации наблюдения потока";
+static const char nameF2_29[] PROGMEM = "F2.29";
+static const char descF2_29[] PROGMEM = "Коэффициент фильтрации наблюдения потока";
+static const char nameF2_30[] PROGMEM = "F2.30";
+static const char descF2_30[] PROGMEM = "T-осевой коэффициент замкнутого контура тока";
+static const char nameF2_31[] PROGMEM = "F2.31";
+static const char descF2_31[] PROGMEM = "Метод ограничения крутящего момента";
+static const char nameF2_32[] PROGMEM = "F2.32";
+static const char nameF2_33[] PROGMEM = "F2.33";
+static const char nameF3_00[] PROGMEM = "F3.00";
+static const char descF3_00[] PROGMEM = "0: Запуск по стартовой частоте\n1: Запуск по стартовой частоте после торможения постоянным током";
+static const char nameF3_01[] PROGMEM = "F3.01";
+static const char descF3_01[] PROGMEM = "Начальная частота запуска переменного привода";
+static const char nameF3_02[] PROGMEM = "F3.02";
+static const char descF3_02[] PROGMEM = "Время работы на стартовой частоте";
+static const char nameF3_03[] PROGMEM = "F3.03";
+static const char descF3_03[] PROGMEM = "Текущая величина для применения торможения постоянным током\nКогда номинальный ток двигателя меньше или равен 80% от номинального тока переменного привода, это процентная база относительно номинального тока двигателя;\nКогда номинальный ток двигателя больше 80% от номинального тока переменного привода, это процентная база относительно 80% от номинального тока переменного привода;";
+static const char nameF3_04[] PROGMEM = "F3.04";
+static const char descF3_04[] PROGMEM = "Продолжительность применения торможения постоянным током";
+static const char nameF3_05[] PROGMEM = "F3.05";
+static const char descF3_05[] PROGMEM = "0: Замедление до остановки\n1: Замедление до остановки + торможение постоянным током\n2: Свободная остановка";
+static const char nameF3_06[] PROGMEM = "F3.06";
+static const char descF3_06[] PROGMEM = "Когда частота достигает предустановленной частоты, начинает работать торможение постоянным током";
+static const char nameF3_07[] PROGMEM = "F3.07";
+static const char descF3_07[] PROGMEM = "Текущая величина для применения торможения постоянным током такая же, как и “торможение постоянным током при запуске”";
+static const char nameF3_08[] PROGMEM = "F3.08";
+static const char nameF4_00[] PROGMEM = "F4.00";
+static const char descF4_00[] PROGMEM = "Установка частоты джога FWD & REV";
+static const char nameF4_01[] PROGMEM = "F4.01";
+static const char descF4_01[] PROGMEM = "Установка частоты для REV джога";
+static const char nameF4_02[] PROGMEM = "F4.02";
+static const char descF4_02[] PROGMEM = "Установка времени ускорения и замедления джога";
+static const char nameF4_03[] PROGMEM = "F4.03";
+static const char descF4_03[] PROGMEM = "Время замедления джога";
+static const char nameF4_04[] PROGMEM = "F4.04";
+static const char descF4_04[] PROGMEM = "Время ускорения 2";
+static const char nameF4_05[] PROGMEM = "F4.05";
+static const char descF4_05[] PROGMEM = "Время замедления 2";
+static const char nameF4_06[] PROGMEM = "F4.06";
+static const char descF4_06[] PROGMEM = "0: Недействительно\n1: Когда переменный привод работает, JOG имеет самый высокий приоритет";
+static const char nameF4_07[] PROGMEM = "F4.07";
+static const char descF4_07[] PROGMEM = "Установив пропускаемую частоту и диапазон, переменный привод может избежать механической резонансной точки нагрузки.";
+static const char nameF4_08[] PROGMEM = "F4.08";
+static const char descF4_08[] PROGMEM = "Пропускаемый диапазон";
+static const char nameF5_00[] PROGMEM = "F5.00";
+static const char descF5_00[] PROGMEM = "0: Двухпроводной режим управления 1\n1: Двухпроводной режим управления 2\n2: Трехпроводной режим управления 1\n3: Трехпроводной режим управления 2";
+static const char nameF5_01[] PROGMEM = "F5.01";
+static const char descF5_01[] PROGMEM = "0: Команда запуска терминала недействительна при включении\n1: Команда запуска терминала действительна при включении";
+static const char nameF5_02[] PROGMEM = "F5.02";
+static const char descF5_02[] PROGMEM = "0: Нет функции\n1: Контроль прямого джога\n2: Контроль обратного джога\n3: Контроль прямого вращения (FWD)\n4: Контроль обратного вращения (REV)\n5: Трехпроводной контроль\n6: Свободная остановка\n7: Вход внешнего сигнала остановки (STOP)\n8: Вход внешнего сигнала сброса (RST)\n9: Вход внешнего сигнала неисправности нормально открытый (NO)\n10: Команда увеличения частоты (UP)\n11: Команда уменьшения частоты (DOWN)\n12: Выбор многоскорости S1\n13: Выбор многоскорости S2\n14: Выбор многоскорости S3\n15: Канал команды запуска принудительно на терминал\n16: Резерв\n17: Команда торможения постоянным током\n18: Переключение источника частоты (F0.06)\n19: Резерв\n20: Резерв\n21: Резерв\n22: Сигнал сброса счетчика (Fb.10 функция подсчета)\n23: Сигнал триггера счетчика (Fb.10 функция подсчета)\n24: Сигнал сброса таймера (Fb.10 функция таймера)\n25: Сигнал триггера таймера (Fb.10 функция таймера)\n26: Время ускорения/замедления";
+static const char nameF5_03[] PROGMEM = "F5.03";
+static const char descF5_03[] PROGMEM = "Функции входного терминала X2";
+static const char nameF5_04[] PROGMEM = "F5.04";
+static const char descF5_04[] PROGMEM = "Функции входного терминала X3";
+static const char nameF5_05[] PROGMEM = "F5.05";
+static const char descF5_05[] PROGMEM = "Функции входного терминала X4 (версия связи: 485+)";
+static const char nameF5_06[] PROGMEM = "F5.06";
+static const char descF5_06[] PROGMEM = "Функции входного терминала X5 (версия связи: 485-)";
+static const char nameF5_07[] PROGMEM = "F5.07";
+static const char descF5_07[] PROGMEM = "0: Нет функции\n1: Переменный привод готов к запуску\n2: Переменный привод работает\n3: Переменный привод работает на нулевой скорости\n4: Внешняя неисправность остановила\n5: Неисправность переменного привода\n6: Сигнал достижения частоты/скорости (FAR)\n7: Сигнал уровня частоты/скорости (FDT)\n8: Выходная частота достигает верхнего предела\n9: Выходная частота достигает нижнего предела\n10: Предупреждение о перегрузке переменного привода\n11: Сигнал переполнения таймера (выход реле, когда время таймирования достигает установленного времени в Fb.13)\n12: Сигнал обнаружения счетчика (выход реле, когда значение подсчета достигает значения, обнаруженного счетчиком в Fb.12)\n13: Сигнал сброса счетчика (резерв)\n14: Резерв";
+static const char nameF5_08[] PROGMEM = "F5.08";
+static const char descF5_08[] PROGMEM = "Задержка от изменения состояния реле R до изменения выхода";
+static const char nameF5_09[] PROGMEM = "F5.09";
+static const char descF5_09[] PROGMEM = "Задержка открытия R";
+static const char nameF5_10[] PROGMEM = "F5.10";
+static const char descF5_10[] PROGMEM = "Когда выходная частота попадает в положительную и отрицательную ширину обнаружения установленной частоты, терминал выдает действительный сигнал (низкий уровень).";
+static const char nameF5_11[] PROGMEM = "F5.11";
+static const char descF5_11[] PROGMEM = "Установленное значение уровня FDT";
+static const char nameF5_16[] PROGMEM = "F5.16";
+static const char descF5_16[] PROGMEM = "Коэффициент фильтрации X1";
+static const char nameF5_17[] PROGMEM = "F5.17";
+static const char descF5_17[] PROGMEM = "Коэффициент фильтрации X2";
+static const char nameF5_18[] PROGMEM = "F5.18";
+static const char descF5_18[] PROGMEM = "Коэффициент фильтрации X3";
+static const char nameF5_19[] PROGMEM = "F5.19";
+static const char descF5_19[] PROGMEM = "Коэффициент фильтрации X4";
+static const char nameF5_20[] PROGMEM = "F5.20";
+static const char descF5_20[] PROGMEM = "Коэффициент фильтрации X5";
+static const char nameF6_00[] PROGMEM = "F6.00";
+static const char descF6_00[] PROGMEM = "Установить нижний предел напряжения AVI";
+static const char nameF6_01[] PROGMEM = "F6.01";
+static const char descF6_01[] PROGMEM = "Установить верхний предел напряжения AVI";
+static const char nameF6_02[] PROGMEM = "F6.02";
+static const char descF6_02[] PROGMEM = "Установить соответствующий процент нижнего предела AVI, который соответствует проценту максимальной частоты.";
+static const char nameF6_03[] PROGMEM = "F6.03";
+static const char descF6_03[] PROGMEM = "Установить соответствующий процент верхнего предела AVI, который соответствует проценту максимальной частоты.";
+static const char nameF6_04[] PROGMEM = "F6.04";
+static const char descF6_04[] PROGMEM = "Установить нижний предел тока ACI";
+static const char nameF6_05[] PROGMEM = "F6.05";
+static const char descF6_05[] PROGMEM = "Установить верхний предел тока ACI";
+static const char nameF6_06[] PROGMEM = "F6.06";
+static const char descF6_06[] PROGMEM = "Установить соответствующий процент нижнего предела ACI, который соответствует проценту максимальной частоты.";
+static const char nameF6_07[] PROGMEM = "F6.07";
+static const char descF6_07[] PROGMEM = "Установить соответствующий процент верхнего предела ACI, который соответствует проценту максимальной частоты.";
+static const char nameF6_08[] PROGMEM = "F6.08";
+static const char descF6_08[] PROGMEM = "Этот параметр используется для фильтрации входного сигнала AVI, ACI и клавиатурного потенциометра, чтобы устранить влияние помех.";
+static const char nameF6_09[] PROGMEM = "F6.09";
+static const char descF6_09[] PROGMEM = "Когда аналоговый входной сигнал часто колеблется вокруг установленного значения, установите этот параметр, чтобы подавить колебания частоты, вызванные таким колебанием.";
+static const char nameF6_10[] PROGMEM = "F6.10";
+static const char descF6_10[] PROGMEM = "0: Выходная частота, 0~Максимальная частота\n1: Установленная частота, 0~Максимальная частота\n2: Выходной ток, 0~2 раза номинального тока\n3: Выходное напряжение, 0~2 раза номинального напряжения\n4: AVI, 0~10В\n5: ACI, 0~20мА";
+static const char nameF6_11[] PROGMEM = "F6.11";
+static const char descF6_11[] PROGMEM = "Установить нижний предел функции AO";
+static const char nameF6_12[] PROGMEM = "F6.12";
+static const char descF6_12[] PROGMEM = "Установить верхний предел функции AO";
+static const char nameF6_13[] PROGMEM = "F6.13";
+static const char descF6_13[] PROGMEM = "Установить нижний предел AO вывода";
+static const char nameF6_14[] PROGMEM = "F6.14";
+static const char descF6_14[] PROGMEM = "Установить верхний предел AO вывода";
+static const char nameF7_00[] PROGMEM = "F7.00";
+static const char descF7_00[] PROGMEM = "Установить частоту 1";
+static const char nameF7_01[] PROGMEM = "F7.01";
+static const char descF7_01[] PROGMEM = "Установить частоту 2";
+static const char nameF7_02[] PROGMEM = "F7.02";
+static const char descF7_02[] PROGMEM = "Установить частоту 3";
+static const char nameF7_03[] PROGMEM = "F7.03";
+static const char descF7_03[] PROGMEM = "Установить частоту 4";
+static const char nameF7_04[] PROGMEM = "F7.04";
+static const char descF7_04[] PROGMEM = "Установить частоту 5";
+static const char nameF7_05[] PROGMEM = "F7.05";
+static const char descF7_05[] PROGMEM = "Установить частоту 6";
+static const char nameF7_06[] PROGMEM = "F7.06";
+static const char descF7_06[] PROGMEM = "Установить частоту 7";
+static const char nameF7_07[] PROGMEM = "F7.07";
+static const char descF7_07[] PROGMEM = "0: Однократный цикл\n1: Непрерывный цикл\n2: Сохранить конечное значение после одного цикла";
+static const char nameF7_08[] PROGMEM = "F7.08";
+static const char descF7_08[] PROGMEM = "0: Остановка без памяти, 1: Остановка с памятью";
+static const char nameF7_09[] PROGMEM = "F7.09";
+static const char descF7_09[] PROGMEM = "0: Отключение без памяти, 1: Отключение с памятью";
+static const char nameF7_10[] PROGMEM = "F7.10";
+static const char descF7_10[] PROGMEM = "Установить время работы скорости 1";
+static const char nameF7_11[] PROGMEM = "F7.11";
+static const char descF7_11[] PROGMEM = "Установить время работы скорости 2";
+static const char nameF7_12[] PROGMEM = "F7.12";
+static const char descF7_12[] PROGMEM = "Установить время работы скорости 3";
+static const char nameF7_13[] PROGMEM = "F7.13";
+static const char descF7_13[] PROGMEM = "Установить время работы скорости 4";
+static const char nameF7_14[] PROGMEM = "F7.14";
+static const char descF7_14[] PROGMEM = "Установить время работы скорости 5";
+static const char nameF7_15[] PROGMEM = "F7.15";
+static const char descF7_15[] PROGMEM = "Установить время работы скорости 6";
+static const char nameF7_16[] PROGMEM = "F7.16";
+static const char descF7_16[] PROGMEM = "Установить время работы скорости 7";
+static const char nameF7_17[] PROGMEM = "F7.17";
+static const char descF7_17[] PROGMEM = "0: FWD, выбрать время ускорения 1\n1: FWD, выбрать время ускорения 2\n2: REV, выбрать время ускорения 1\n3: REV, выбрать время ускорения 2";
+static const char nameF7_18[] PROGMEM = "F7.18";
+static const char descF7_18[] PROGMEM = "Режим работы T2";
+static const char nameF7_19[] PROGMEM = "F7.19";
+static const char descF7_19[] PROGMEM = "Режим работы T3";
+static const char nameF7_20[] PROGMEM = "F7.20";
+static const char descF7_20[] PROGMEM = "Режим работы T4";
+static const char nameF7_21[] PROGMEM = "F7.21";
+static const char descF7_21[] PROGMEM = "Режим работы T5";
+static const char nameF7_22[] PROGMEM = "F7.22";
+static const char descF7_22[] PROGMEM = "Режим работы T6";
+static const char nameF7_23[] PROGMEM = "F7.23";
+static const char descF7_23[] PROGMEM = "Режим работы T7";
+static const char nameF7_24[] PROGMEM = "F7.24";
+static const char descF7_24[] PROGMEM = "Текущий рабочий раздел (резерв)";
+static const char nameF7_25[] PROGMEM = "F7.25";
+static const char descF7_25[] PROGMEM = "Текущее рабочее время (резерв)";
+static const char nameF8_00[] PROGMEM = "F8.00";
+static const char descF8_00[] PROGMEM = "0: Прямое действие\n1: Обратное действие";
+static const char nameF8_01[] PROGMEM = "F8.01";
+static const char descF8_01[] PROGMEM = "0: Цифровая установка\n1: Настройка клавиатурного потенциометра\n2: Вход AVI\n3: Вход ACI";
+static const char nameF8_02[] PROGMEM = "F8.02";
+static const char descF8_02[] PROGMEM = "0: Вход AVI\n1: Вход ACI";
+static const char nameF8_03[] PROGMEM = "F8.03";
+static const char descF8_03[] PROGMEM = "Установленное значение, когда источник заданного PID является цифровой установкой";
+static const char nameF8_04[] PROGMEM = "F8.04";
+static const char descF8_04[] PROGMEM = "Время ускорения/замедления PID";
+static const char nameF8_05[] PROGMEM = "F8.05";
+static const char descF8_05[] PROGMEM = "Установка смещения PID";
+static const char nameF8_06[] PROGMEM = "F8.06";
+static const char descF8_06[] PROGMEM = "Время удержания смещения PID";
+static const char nameF8_07[] PROGMEM = "F8.07";
+static const char descF8_07[] PROGMEM = "Верхний предел отклонения PID";
+static const char nameF8_08[] PROGMEM = "F8.08";
+static const char descF8_08[] PROGMEM = "Нижний предел отклонения PID (Максимальная частота)";
+static const char nameF8_09[] PROGMEM = "F8.09";
+static const char descF8_09[] PROGMEM = "Пропорциональный коэффициент";
+static const char nameF8_10[] PROGMEM = "F8.10";
+static const char descF8_10[] PROGMEM = "Интегральное время";
+static const char nameF8_11[] PROGMEM = "F8.11";
+static const char descF8_11[] PROGMEM = "Дифференциальное время";
+static const char nameF8_12[] PROGMEM = "F8.12";
+static const char descF8_12[] PROGMEM = "Верхний предел выхода PID";
+static const char nameF8_13[] PROGMEM = "F8.13";
+static const char descF8_13[] PROGMEM = "Нижний предел выхода PID";
+static const char nameF8_14[] PROGMEM = "F8.14";
+static const char descF8_14[] PROGMEM = "Фильтр времени выхода PID";
+static const char nameF8_15[] PROGMEM = "F8.15";
+static const char descF8_15[] PROGMEM = "0: Работает на верхнем пределе частоты\n1: Работает на нижнем пределе частоты\n2: Работает на частоте цифровой установки\n3: Замедление до остановки\n4: Свободная остановка";
+static const char nameF8_16[] PROGMEM = "F8.16";
+static const char descF8_16[] PROGMEM = "Значение обнаружения потери";
+static const char nameF8_17[] PROGMEM = "F8.17";
+static const char descF8_17[] PROGMEM = "Время обнаружения потери";
+static const char nameF8_18[] PROGMEM = "F8.18";
+static const char descF8_18[] PROGMEM = "Значение обнаружения избыточности";
+static const char nameF8_19[] PROGMEM = "F8.19";
+static const char descF8_19[] PROGMEM = "Время обнаружения избыточности";
+static const char nameF8_20[] PROGMEM = "F8.20";
+static const char descF8_20[] PROGMEM = "0: Нет функции сна\n1: Внутреннее пробуждение\n2: Управление внешним входным терминалом";
+static const char nameF8_21[] PROGMEM = "F8.21";
+static const char descF8_21[] PROGMEM = "0: Замедление до остановки\n2: Свободная остановка";
+static const char nameF8_22[] PROGMEM = "F8.22";
+static const char descF8_22[] PROGMEM = "Частота сна";
+static const char nameF8_23[] PROGMEM = "F8.23";
+static const char descF8_23[] PROGMEM = "Давление сна";
+static const char nameF8_24[] PROGMEM = "F8.24";
+static const char descF8_24[] PROGMEM = "Время задержки сна";
+static const char nameF8_25[] PROGMEM = "F8.25";
+static const char descF8_25[] PROGMEM = "Давление пробуждения";
+static const char nameF8_26[] PROGMEM = "F8.26";
+static const char descF8_26[] PROGMEM = "Время задержки пробуждения";
+static const char nameF8_27[] PROGMEM = "F8.27";
+static const char descF8_27[] PROGMEM = "Нижний предел диапазона PID";
+static const char nameF8_28[] PROGMEM = "F8.28";
+static const char descF8_28[] PROGMEM = "Верхний предел диапазона PID";
+static const char nameF8_29[] PROGMEM = "F8.29";
+static const char descF8_29[] PROGMEM = "0: Не отображать десятичные разряды\n1: Отображать одну десятичную точку\n2: Отображать две десятичные точки\n3: Отображать три десятичные точки";
+static const char nameF8_30[] PROGMEM = "F8.30";
+static const char descF8_30[] PROGMEM = "Частота обнаружения нехватки воды";
+static const char nameF8_31[] PROGMEM = "F8.31";
+static const char descF8_31[] PROGMEM = "Давление обнаружения нехватки воды";
+static const char nameF8_32[] PROGMEM = "F8.32";
+static const char descF8_32[] PROGMEM = "Время обнаружения нехватки воды";
+static const char nameF8_33[] PROGMEM = "F8.33";
+static const char descF8_33[] PROGMEM = "Время перезапуска после нехватки воды";
+static const char nameF8_34[] PROGMEM = "F8.34";
+static const char descF8_34[] PROGMEM = "Количество перезапусков после нехватки воды";
+static const char nameF8_35[] PROGMEM = "F8.35";
+static const char nameF8_36[] PROGMEM = "F8.36";
+static const char descF8_36[] PROGMEM = "0: Отключен\n1: Режим работы насоса PV 1\n2: Режим работы насоса PV 2";
+static const char nameF8_37[] PROGMEM = "F8.37";
+static const char descF8_37[] PROGMEM = "0: Отключен\n1: MPPT включен\n2: Насос PV включен\n3: MPPT и насос PV включены";
+static const char nameF8_38[] PROGMEM = "F8.38";
+static const char unitVolt[] PROGMEM = "В";
+static const char descF8_38[] PROGMEM = "Максимальное рабочее напряжение MPPT";
+static const char nameF8_39[] PROGMEM = "F8.39";
+static const char descF8_39[] PROGMEM = "0: Включено\n1: Отключено";
+static const char nameF8_40[] PROGMEM = "F8.40";
+static const char descF8_40[] PROGMEM = "0: Отключено\n1: Включено";
+static const char nameF8_41[] PROGMEM = "F8.41";
+static const char descF8_41[] PROGMEM = "Задержка перезапуска при недостаточном напряжении";
+static const char nameF8_42[] PROGMEM = "F8.42";
+static const char nameF8_43[] PROGMEM = "F8.43";
+static const char descF8_43[] PROGMEM = "Соотношение тока без нагрузки, соответствующее току обнаружения нехватки воды насоса PV";
+static const char nameF8_44[] PROGMEM = "F8.44";
+static const char descF8_44[] PROGMEM = "Минимальная частота отлива насоса PV";
+static const char nameF8_45[] PROGMEM = "F8.45";
+static const char descF8_45[] PROGMEM = "Время обнаружения нехватки воды насоса PV";
+static const char nameF8_46[] PROGMEM = "F8.46";
+static const char nameF8_47[] PROGMEM = "F8.47";
+static const char descF8_47[] PROGMEM = "0: Относительно максимальной частоты\n1: Относительно центральной частоты";
+static const char nameF8_48[] PROGMEM = "F8.48";
+static const char descF8_48[] PROGMEM = "0: Запомнить состояние перед остановкой\n1: Перезапустить старт";
+static const char nameF8_49[] PROGMEM = "F8.49";
+static const char descF8_49[] PROGMEM = "Амплитуда колебаний";
+static const char nameF8_50[] PROGMEM = "F8.50";
+static const char descF8_50[] PROGMEM = "Шаг колебаний";
+static const char nameF8_51[] PROGMEM = "F8.51";
+static const char descF8_51[] PROGMEM = "Время нарастания колебаний";
+static const char nameF8_52[] PROGMEM = "F8.52";
+static const char descF8_52[] PROGMEM = "Время спада колебаний";
+static const char nameF8_53[] PROGMEM = "F8.53";
+static const char descF8_53[] PROGMEM = "Задержка верхней частоты";
+static const char nameF8_54[] PROGMEM = "F8.54";
+static const char descF8_54[] PROGMEM = "Задержка нижней частоты";
+static const char nameF9_00[] PROGMEM = "F9.00";
+static const char descF9_00[] PROGMEM = "Настройка параметров двигателя";
+static const char nameF9_01[] PROGMEM = "F9.01";
+static const char nameF9_02[] PROGMEM = "F9.02";
+static const char unitAmpere[] PROGMEM = "А";
+static const char nameF9_03[] PROGMEM = "F9.03";
+static const char unitRpm[] PROGMEM = "Об/мин";
+static const char nameF9_04[] PROGMEM = "F9.04";
+static const char nameF9_05[] PROGMEM = "F9.05";
+static const char descF9_05[] PROGMEM = "0: Отключить идентификацию параметров; 1: Включить статическую идентификацию параметров, автоматически устанавливается в 0 после идентификации";
+static const char nameF9_06[] PROGMEM = "F9.06";
+static const char unitOhm[] PROGMEM = "Ω";
+static const char descF9_06[] PROGMEM = "У разных моделей есть соответствующие заводские значения, и идентификация параметров автоматически изменит значение";
+static const char nameF9_11[] PROGMEM = "F9.11";
+static const char descF9_11[] PROGMEM = "Установить ток без нагрузки двигателя; У разных моделей есть соответствующие заводские значения, и идентификация параметров автоматически изменит значение";
+static const char nameFA_00[] PROGMEM = "FA.00";
+static const char descFA_00[] PROGMEM = "0: Недействительно\n1: Действительно";
+static const char nameFA_01[] PROGMEM = "FA.01";
+static const char descFA_01[] PROGMEM = "Коэффициент защиты от перегрузки двигателя - это процентное соотношение номинального тока двигателя к номинальному выходному току переменного привода.";
+static const char text4[] PROGMEM = "180/360В";
+static const char text5[] PROGMEM = "150-280 / 300~480В";
+static const char nameFA_02[] PROGMEM = "FA.02";
+static const char descFA_02[] PROGMEM = "Допустимое нижнее значение напряжения на шине постоянного тока, когда переменный привод работает нормально.";
+static const char nameFA_03[] PROGMEM = "FA.03";
+static const char descFA_03[] PROGMEM = "0: Отключить\n1: Включить";
+static const char text6[] PROGMEM = "375/660В";
+static const char text7[] PROGMEM = "350-380 / 660~760В";
+static const char nameFA_04[] PROGMEM = "FA.04";
+static const char descFA_04[] PROGMEM = "Рабочее напряжение во время защиты от перенапряжения";
+static const char nameFA_05[] PROGMEM = "FA.05";
+static const char descFA_05[] PROGMEM = "Порог тока автоматического ограничения тока, установленное значение является процентом относительно номинального тока переменного привода.";
+static const char nameFA_06[] PROGMEM = "FA.06";
+static const char unitHertzPerSecond[] PROGMEM = "Гц/с";
+static const char descFA_06[] PROGMEM = "Скорость падения частоты при ограничении тока";
+static const char nameFA_07[] PROGMEM = "FA.07";
+static const char descFA_07[] PROGMEM = "0: Недействительно\n1: Действительно во время ускорения/замедления, недействительно на постоянной скорости\n2: Действительно во время ускорения и замедления, действительно на постоянной скорости";
+static const char nameFA_08[] PROGMEM = "FA.08";
+static const char descFA_08[] PROGMEM = "Текущий порог действия предварительного предупреждения о перегрузке переменного привода.";
+static const char nameFA_09[] PROGMEM = "FA.09";
+static const char descFA_09[] PROGMEM = "Время задержки от превышения уровня предварительного предупреждения о перегрузке.";
+static const char nameFA_10[] PROGMEM = "FA.10";
+static const char descFA_10[] PROGMEM = "Увеличьте эту настройку, когда возникают колебания двигателя.";
+static const char nameFA_11[] PROGMEM = "FA.11";
+static const char descFA_11[] PROGMEM = "Установить максимальную величину корректировки для подавления колебаний.";
+static const char nameFA_12[] PROGMEM = "FA.12";
+static const char descFA_12[] PROGMEM = "Ниже этой частоты подавление колебаний будет неэффективным.";
+static const char nameFA_13[] PROGMEM = "FA.13";
+static const char descFA_13[] PROGMEM = "Выше этой частоты подавление колебаний будет неэффективным.";
+static const char nameFA_14[] PROGMEM = "FA.14";
+static const char descFA_14[] PROGMEM = "Выбор во время ускорения, 0: Недействительно, 1: Действительно; выбор во время замедления и на постоянной скорости.";
+static const char nameFA_15[] PROGMEM = "FA.15";
+static const char descFA_15[] PROGMEM = "Номинальный ток переменного привода.";
+static const char nameFA_16[] PROGMEM = "FA.16";
+static const char descFA_16[] PROGMEM = "Когда установлено в 0, автоматический сброс отключен.";
+static const char nameFA_17[] PROGMEM = "FA.17";
+static const char descFA_17[] PROGMEM = "Установить интервал автоматического сброса неисправностей.";
+static const char nameFA_18[] PROGMEM = "FA.18";
+static const char descFA_18[] PROGMEM = "0: Без действия\n1: Включение подавления перегрузки\n2: Включение подавления перенапряжения\n3: Включение подавления перегрузки/перенапряжения";
+static const char nameFA_19[] PROGMEM = "FA.19";
+static const char descFA_19[] PROGMEM = "Подавление перегрузки VF Kp";
+static const char nameFA_20[] PROGMEM = "FA.20";
+static const char descFA_20[] PROGMEM = "Коэффициент компенсации предела тока, умноженного на скорость.";
+static const char nameFA_21[] PROGMEM = "FA.21";
+static const char descFA_21[] PROGMEM = "Подавление перенапряжения VF Kp";
+static const char nameFA_22[] PROGMEM = "FA.22";
+static const char descFA_22[] PROGMEM = "Порог частоты VF при подавлении перенапряжения.";
+static const char nameFA_23[] PROGMEM = "FA.23";
+static const char descFA_23[] PROGMEM = "Регулирование напряжения VF во время защиты от перенапряжения Kp.";
+static const char nameFA_24[] PROGMEM = "FA.24";
+static const char descFA_24[] PROGMEM = "0: Сообщить об ошибке недостаточного напряжения, свободная остановка;\n1: Не сообщать об ошибке недостаточного напряжения, остановка по установленному режиму остановки (F3.05).";
+static const char nameFA_25[] PROGMEM = "FA.25";
+static const char nameFA_26[] PROGMEM = "FA.26";
+static const char descFA_26[] PROGMEM = "0: Защита от потери фазы на выходе отключена\n1: Защита от потери фазы на выходе включена";
+static const char nameFb_00[] PROGMEM = "Fb.00";
+static const char descFb_00[] PROGMEM = "Элементы отображения по умолчанию на главном интерфейсе мониторинга. Соответствующие номера являются параметрами группы d.";
+static const char nameFb_01[] PROGMEM = "Fb.01";
+static const char nameFb_02[] PROGMEM = "Fb.02";
+static const char descFb_02[] PROGMEM = "Используется для коррекции ошибки отображения шкалы скорости и не влияет на фактическую скорость.";
+static const char nameFb_03[] PROGMEM = "Fb.03";
+static const char descFb_03[] PROGMEM = "Код текущей ошибки";
+static const char nameFb_04[] PROGMEM = "Fb.04";
+static const char descFb_04[] PROGMEM = "Код предыдущей ошибки";
+static const char nameFb_05[] PROGMEM = "Fb.05";
+static const char descFb_05[] PROGMEM = "Код предыдущей ошибки два";
+static const char nameFb_06[] PROGMEM = "Fb.06";
+static const char descFb_06[] PROGMEM = "Напряжение на шине при ошибке";
+static const char nameFb_07[] PROGMEM = "Fb.07";
+static const char descFb_07[] PROGMEM = "Ток на шине при ошибке";
+static const char nameFb_08[] PROGMEM = "Fb.08";
+static const char descFb_08[] PROGMEM = "Установленная частота при ошибке";
+static const char nameFb_09[] PROGMEM = "Fb.09";
+static const char descFb_09[] PROGMEM = "Рабочая частота при ошибке";
+static const char nameFb_10[] PROGMEM = "Fb.10";
+static const char descFb_10[] PROGMEM = "Единицы: Обработка прихода подсчета, 0: Однократный подсчет, остановить выход; 1: Однократный подсчет, продолжить выход; 2: Циклический подсчет, остановить выход; 3: Циклический подсчет, продолжить выход. Десятки: Резерв Сотни: Обработка прихода таймирования.";
+static const char nameFb_11[] PROGMEM = "Fb.11";
+static const char descFb_11[] PROGMEM = "Установить значение сброса счетчика";
+static const char nameFb_12[] PROGMEM = "Fb.12";
+static const char descFb_12[] PROGMEM = "Установить значение обнаружения счетчика";
+static const char nameFb_13[] PROGMEM = "Fb.13";
+static const char descFb_13[] PROGMEM = "Установить время таймирования";
+static const char nameFb_14[] PROGMEM = "Fb.14";
+static const char nameFb_15[] PROGMEM = "Fb.15";
+static const char nameFb_16[] PROGMEM = "Fb.16";
+static const char nameFb_17[] PROGMEM = "Fb.17";
+static const char nameFb_18[] PROGMEM = "Fb.18";
+static const char nameFb_19[] PROGMEM = "Fb.19";
+static const char nameFb_20[] PROGMEM = "Fb.20";
+static const char descFb_20[] PROGMEM = "Дата обновления программного обеспечения (год)";
+static const char nameFb_21[] PROGMEM = "Fb.21";
+static const char descFb_21[] PROGMEM = "Дата обновления программного обеспечения (месяц день)";
+static const char text8[] PROGMEM = "1.00f";
+static const char nameFb_22[] PROGMEM = "Fb.22";
+static const char descFb_22[] PROGMEM = "Отображение версии программного обеспечения";
+static const char nameFC_00[] PROGMEM = "FC.00";
+static const char descFC_00[] PROGMEM = "0: 1200\n1: 2400\n2: 4800\n3: 9600\n4: 19200\n5: 38400";
+static const char nameFC_01[] PROGMEM = "FC.01";
+static const char descFC_01[] PROGMEM = "Формат данных: <Длина данных, позиция остановки>\n0: Без проверки, <8,1>\n1: Проверка нечетности, <9,1>\n2: Проверка четности, <9,1>\n3: Без проверки, <8,1>\n4: Проверка четности, <8,1>\n5: Проверка нечетности, <8,1>\n6: Без проверки, <8,2>";
+static const char nameFC_02[] PROGMEM = "FC.02";
+static const char descFC_02[] PROGMEM = "1-247 представляет местный адрес";
+static const char nameFC_03[] PROGMEM = "FC.03";
+static const char descFC_03[] PROGMEM = "Тайм-аут связи";
+static const char nameFC_04[] PROGMEM = "FC.04";
+static const char nameFC_05[] PROGMEM = "FC.05";
+static const char descFC_05[] PROGMEM = "0: Без действия\n1: Сигнал тревоги\n2: Остановка по неисправности";
+static const char text9[] PROGMEM = "1";
+static const char text10[] PROGMEM = "9999";
+static const char nameFP_00[] PROGMEM = "FP.00";
+static const char descFP_00[] PROGMEM = "Специфический пароль для настройки системы";
+static const char named_00[] PROGMEM = "d-00";
+static const char named_01[] PROGMEM = "d-01";
+static const char named_02[] PROGMEM = "d-02";
+static const char named_03[] PROGMEM = "d-03";
+static const char named_04[] PROGMEM = "d-04";
+static const char named_05[] PROGMEM = "d-05";
+static const char named_06[] PROGMEM = "d-06";
+static const char named_07[] PROGMEM = "d-07";
+static const char unitMilliAmpere[] PROGMEM = "мА";
+static const char named_08[] PROGMEM = "d-08";
+static const char named_09[] PROGMEM = "d-09";
+static const char descd_09[] PROGMEM = "Состояние входного терминала (Реле, X1-X5)";
+static const char named_10[] PROGMEM = "d-10";
+static const char unitCelsius[] PROGMEM = "℃";
+static const char named_11[] PROGMEM = "d-11";
+static const char descd_11[] PROGMEM = "Заданное значение PID";
+static const char named_12[] PROGMEM = "d-12";
+static const char descd_12[] PROGMEM = "Значение обратной связи PID";
+static const char named_13[] PROGMEM = "d-13";
+static const char descd_13[] PROGMEM = "Текущее значение счетчика";
+static const char named_14[] PROGMEM = "d-14";
+static const char descd_14[] PROGMEM = "Текущее значение таймера (с)";
+static const char named_15[] PROGMEM = "d-15";
+static const char unitHour[] PROGMEM = "ч";
+static const char descd_15[] PROGMEM = "Накопительное время работы переменного привода (ч)";
+static const char named_16[] PROGMEM = "d-16";
+static const char descd_16[] PROGMEM = "Накопительное время включения переменного привода (ч)";
+static const char named_17[] PROGMEM = "d-17";
+static const char descd_17[] PROGMEM = "Смещение выборки тока фазы U";
+static const char named_18[] PROGMEM = "d-18";
+static const char descd_18[] PROGMEM = "Смещение выборки тока фазы V";
+static const char named_19[] PROGMEM = "d-19";
+static const char descd_19[] PROGMEM = "Смещение выборки тока фазы W";
+
+// Числовые данные: знаков после запятой (четвёртый столбец) — частоты 2 (0.01 Гц), остальные — по
+// разрешению диапазона в руководстве, но не больше, чем позволяет 16-битный регистр.
+const ParameterRecord parameterCatalog[PARAMETER_CATALOG_SIZE] PROGMEM = {
+    { GROUP_F0, 0, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(99.9f) }, // F0.00
+    { GROUP_F0, 1, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F0.01
+    { GROUP_F0, 2, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(2) }, // F0.02
+    { GROUP_F0, 3, INT, 0, ParameterValue(4), ParameterValue(0), ParameterValue(8) }, // F0.03
+    { GROUP_F0, 4, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(8) }, // F0.04
+    { GROUP_F0, 5, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F0.05
+    { GROUP_F0, 6, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(4) }, // F0.06
+    { GROUP_F0, 7, FLOAT, 2, ParameterValue(50.0f), ParameterValue(0.0f), ParameterValue(400.0f) }, // F0.07
+    { GROUP_F0, 8, FLOAT, 2, ParameterValue(50.0f), ParameterValue(0.0f), ParameterValue(400.0f) }, // F0.08
+    { GROUP_F0, 9, FLOAT, 2, ParameterValue(50.0f), ParameterValue(0.0f), ParameterValue(400.0f) }, // F0.09
+    { GROUP_F0, 10, FLOAT, 2, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(400.0f) }, // F0.10
+    { GROUP_F0, 11, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(2) }, // F0.11
+    { GROUP_F0, 12, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.1f), ParameterValue(999.9f) }, // F0.12
+    { GROUP_F0, 13, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.1f), ParameterValue(999.9f) }, // F0.13
+    { GROUP_F0, 14, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(2) }, // F0.14
+    { GROUP_F0, 15, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // F0.15
+    { GROUP_F0, 16, STRING, 0, ParameterValue(text1), ParameterValue(text2), ParameterValue(text3) }, // F0.16
+    { GROUP_F0, 17, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F0.17
+    { GROUP_F0, 18, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F0.18
+    { GROUP_F0, 19, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F0.19
+    { GROUP_F0, 20, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(1) }, // F0.20
+    { GROUP_F1, 0, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(4) }, // F1.00
+    { GROUP_F1, 1, FLOAT, 1, ParameterValue(3.0f), ParameterValue(0.0f), ParameterValue(30.0f) }, // F1.01
+    { GROUP_F1, 2, FLOAT, 2, ParameterValue(15.00f), ParameterValue(0.0f), ParameterValue(50.00f) }, // F1.02
+    { GROUP_F1, 3, FLOAT, 1, ParameterValue(16.0f), ParameterValue(2.0f), ParameterValue(16.0f) }, // F1.03
+    { GROUP_F1, 4, FLOAT, 2, ParameterValue(12.50f), ParameterValue(0.01f), ParameterValue(100.0f) }, // F1.04
+    { GROUP_F1, 5, FLOAT, 1, ParameterValue(25.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F1.05
+    { GROUP_F1, 6, FLOAT, 2, ParameterValue(25.00f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F1.06
+    { GROUP_F1, 7, FLOAT, 1, ParameterValue(50.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F1.07
+    { GROUP_F1, 8, FLOAT, 2, ParameterValue(37.50f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F1.08
+    { GROUP_F1, 9, FLOAT, 1, ParameterValue(75.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F1.09
+    { GROUP_F1, 10, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(2) }, // F1.10
+    { GROUP_F1, 11, FLOAT, 1, ParameterValue(0.9f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F1.11
+    { GROUP_F1, 12, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(150.0f) }, // F1.12
+    { GROUP_F1, 13, FLOAT, 2, ParameterValue(0.84f), ParameterValue(0.0f), ParameterValue(200.0f) }, // F1.13
+    { GROUP_F1, 14, INT, 0, ParameterValue(5), ParameterValue(0), ParameterValue(6) }, // F1.14
+    { GROUP_F2, 0, INT, 0, ParameterValue(20), ParameterValue(1), ParameterValue(100) }, // F2.00
+    { GROUP_F2, 1, FLOAT, 2, ParameterValue(0.50f), ParameterValue(1.0f), ParameterValue(10.0f) }, // F2.01
+    { GROUP_F2, 2, INT, 0, ParameterValue(10), ParameterValue(1), ParameterValue(100) }, // F2.02
+    { GROUP_F2, 3, FLOAT, 1, ParameterValue(1.0f), ParameterValue(1.0f), ParameterValue(10.0f) }, // F2.03
+    { GROUP_F2, 4, FLOAT, 2, ParameterValue(10.0f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F2.04
+    { GROUP_F2, 5, FLOAT, 2, ParameterValue(30.0f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F2.05
+    { GROUP_F2, 6, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F2.06
+    { GROUP_F2, 7, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.07
+    { GROUP_F2, 8, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.08
+    { GROUP_F2, 9, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.09
+    { GROUP_F2, 10, INT, 0, ParameterValue(2000), ParameterValue(0), ParameterValue(60000) }, // F2.10
+    { GROUP_F2, 11, INT, 0, ParameterValue(1300), ParameterValue(0), ParameterValue(60000) }, // F2.11
+    { GROUP_F2, 12, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.12
+    { GROUP_F2, 13, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.13
+    { GROUP_F2, 14, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(200) }, // F2.14
+    { GROUP_F2, 15, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.15
+    { GROUP_F2, 16, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.16
+    { GROUP_F2, 17, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.17
+    { GROUP_F2, 18, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.18
+    { GROUP_F2, 19, FLOAT, 1, ParameterValue(150.0f), ParameterValue(0.0f), ParameterValue(200.0f) }, // F2.19
+    { GROUP_F2, 20, INT, 0, ParameterValue(1), ParameterValue(50), ParameterValue(200) }, // F2.20
+    { GROUP_F2, 21, INT, 0, ParameterValue(5), ParameterValue(5), ParameterValue(300) }, // F2.21
+    { GROUP_F2, 22, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(65535) }, // F2.22
+    { GROUP_F2, 23, INT, 0, ParameterValue(25), ParameterValue(0), ParameterValue(100) }, // F2.23
+    { GROUP_F2, 24, INT, 0, ParameterValue(100), ParameterValue(0), ParameterValue(500) }, // F2.24
+    { GROUP_F2, 25, FLOAT, 2, ParameterValue(20.00f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F2.25
+    { GROUP_F2, 26, INT, 0, ParameterValue(28), ParameterValue(0), ParameterValue(31) }, // F2.26
+    { GROUP_F2, 27, FLOAT, 2, ParameterValue(1.05f), ParameterValue(0.0f), ParameterValue(110.0f) }, // F2.27
+    { GROUP_F2, 28, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(100) }, // F2.28
+    { GROUP_F2, 29, INT, 0, ParameterValue(300), ParameterValue(0), ParameterValue(2000) }, // F2.29
+    { GROUP_F2, 30, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(500) }, // F2.30
+    { GROUP_F2, 31, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F2.31
+    { GROUP_F2, 32, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.32
+    { GROUP_F2, 33, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F2.33
+    { GROUP_F3, 0, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F3.00
+    { GROUP_F3, 1, FLOAT, 2, ParameterValue(0.50f), ParameterValue(0.50f), ParameterValue(20.00f) }, // F3.01
+    { GROUP_F3, 2, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(60.0f) }, // F3.02
+    { GROUP_F3, 3, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F3.03
+    { GROUP_F3, 4, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(60.0f) }, // F3.04
+    { GROUP_F3, 5, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(2) }, // F3.05
+    { GROUP_F3, 6, FLOAT, 2, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F3.06
+    { GROUP_F3, 7, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F3.07
+    { GROUP_F3, 8, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(30.0f) }, // F3.08
+    { GROUP_F4, 0, FLOAT, 2, ParameterValue(10.00f), ParameterValue(0.00f), ParameterValue(50.00f) }, // F4.00
+    { GROUP_F4, 1, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.00f), ParameterValue(50.00f) }, // F4.01
+    { GROUP_F4, 2, FLOAT, 1, ParameterValue(0.1f), ParameterValue(0.1f), ParameterValue(999.9f) }, // F4.02
+    { GROUP_F4, 3, FLOAT, 1, ParameterValue(0.00f), ParameterValue(0.0f), ParameterValue(999.9f) }, // F4.03
+    { GROUP_F4, 4, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.1f), ParameterValue(999.9f) }, // F4.04
+    { GROUP_F4, 5, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.1f), ParameterValue(999.9f) }, // F4.05
+    { GROUP_F4, 6, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(1) }, // F4.06
+    { GROUP_F4, 7, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F4.07
+    { GROUP_F4, 8, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.0f), ParameterValue(10.0f) }, // F4.08
+    { GROUP_F5, 0, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F5.00
+    { GROUP_F5, 1, INT, 0, ParameterValue(3), ParameterValue(0), ParameterValue(1) }, // F5.01
+    { GROUP_F5, 2, INT, 0, ParameterValue(4), ParameterValue(0), ParameterValue(27) }, // F5.02
+    { GROUP_F5, 3, INT, 0, ParameterValue(12), ParameterValue(0), ParameterValue(27) }, // F5.03
+    { GROUP_F5, 4, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(27) }, // F5.04
+    { GROUP_F5, 5, INT, 0, ParameterValue(8), ParameterValue(0), ParameterValue(27) }, // F5.05
+    { GROUP_F5, 6, INT, 0, ParameterValue(5), ParameterValue(0), ParameterValue(27) }, // F5.06
+    { GROUP_F5, 7, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(14) }, // F5.07
+    { GROUP_F5, 8, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(999.9f) }, // F5.08
+    { GROUP_F5, 9, FLOAT, 2, ParameterValue(5.00f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F5.09
+    { GROUP_F5, 10, FLOAT, 2, ParameterValue(10.00f), ParameterValue(0.00f), ParameterValue(15.00f) }, // F5.10
+    { GROUP_F5, 11, FLOAT, 2, ParameterValue(5.0f), ParameterValue(0.00f), ParameterValue(100.0f) }, // F5.11
+    { GROUP_F5, 16, INT, 0, ParameterValue(5), ParameterValue(0), ParameterValue(9999) }, // F5.16
+    { GROUP_F5, 17, INT, 0, ParameterValue(5), ParameterValue(0), ParameterValue(9999) }, // F5.17
+    { GROUP_F5, 18, INT, 0, ParameterValue(5), ParameterValue(0), ParameterValue(9999) }, // F5.18
+    { GROUP_F5, 19, INT, 0, ParameterValue(5), ParameterValue(0), ParameterValue(9999) }, // F5.19
+    { GROUP_F5, 20, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // F5.20
+    { GROUP_F6, 0, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F6.00
+    { GROUP_F6, 1, FLOAT, 1, ParameterValue(100.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F6.01
+    { GROUP_F6, 2, FLOAT, 1, ParameterValue(0.0f), ParameterValue(-100.0f), ParameterValue(100.0f) }, // F6.02
+    { GROUP_F6, 3, FLOAT, 1, ParameterValue(100.0f), ParameterValue(-100.0f), ParameterValue(100.0f) }, // F6.03
+    { GROUP_F6, 4, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F6.04
+    { GROUP_F6, 5, FLOAT, 1, ParameterValue(100.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F6.05
+    { GROUP_F6, 6, FLOAT, 1, ParameterValue(0.0f), ParameterValue(-100.0f), ParameterValue(100.0f) }, // F6.06
+    { GROUP_F6, 7, FLOAT, 1, ParameterValue(100.0f), ParameterValue(-100.0f), ParameterValue(100.0f) }, // F6.07
+    { GROUP_F6, 8, FLOAT, 1, ParameterValue(0.1f), ParameterValue(0.1f), ParameterValue(5.0f) }, // F6.08
+    { GROUP_F6, 9, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F6.09
+    { GROUP_F6, 10, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(5) }, // F6.10
+    { GROUP_F6, 11, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F6.11
+    { GROUP_F6, 12, FLOAT, 1, ParameterValue(100.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F6.12
+    { GROUP_F6, 13, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F6.13
+    { GROUP_F6, 14, FLOAT, 1, ParameterValue(100.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F6.14
+    { GROUP_F7, 0, FLOAT, 2, ParameterValue(5.00f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F7.00
+    { GROUP_F7, 1, FLOAT, 2, ParameterValue(10.00f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F7.01
+    { GROUP_F7, 2, FLOAT, 2, ParameterValue(15.00f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F7.02
+    { GROUP_F7, 3, FLOAT, 2, ParameterValue(20.00f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F7.03
+    { GROUP_F7, 4, FLOAT, 2, ParameterValue(25.00f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F7.04
+    { GROUP_F7, 5, FLOAT, 2, ParameterValue(37.50f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F7.05
+    { GROUP_F7, 6, FLOAT, 2, ParameterValue(50.00f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F7.06
+    { GROUP_F7, 7, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(2) }, // F7.07
+    { GROUP_F7, 8, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F7.08
+    { GROUP_F7, 9, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F7.09
+    { GROUP_F7, 10, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.0f), ParameterValue(999.9f) }, // F7.10
+    { GROUP_F7, 11, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.0f), ParameterValue(999.9f) }, // F7.11
+    { GROUP_F7, 12, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.0f), ParameterValue(999.9f) }, // F7.12
+    { GROUP_F7, 13, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.0f), ParameterValue(999.9f) }, // F7.13
+    { GROUP_F7, 14, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.0f), ParameterValue(999.9f) }, // F7.14
+    { GROUP_F7, 15, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.0f), ParameterValue(999.9f) }, // F7.15
+    { GROUP_F7, 16, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.0f), ParameterValue(999.9f) }, // F7.16
+    { GROUP_F7, 17, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F7.17
+    { GROUP_F7, 18, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F7.18
+    { GROUP_F7, 19, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F7.19
+    { GROUP_F7, 20, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F7.20
+    { GROUP_F7, 21, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F7.21
+    { GROUP_F7, 22, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F7.22
+    { GROUP_F7, 23, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F7.23
+    { GROUP_F7, 24, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F7.24
+    { GROUP_F7, 25, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F7.25
+    { GROUP_F8, 0, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F8.00
+    { GROUP_F8, 1, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F8.01
+    { GROUP_F8, 2, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F8.02
+    { GROUP_F8, 3, INT, 0, ParameterValue(3), ParameterValue(0), ParameterValue(100) }, // F8.03
+    { GROUP_F8, 4, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.04
+    { GROUP_F8, 5, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.05
+    { GROUP_F8, 6, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(6000.0f) }, // F8.06
+    { GROUP_F8, 7, FLOAT, 1, ParameterValue(100.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.07
+    { GROUP_F8, 8, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.08
+    { GROUP_F8, 9, FLOAT, 2, ParameterValue(25.00f), ParameterValue(0.0f), ParameterValue(600.0f) }, // F8.09
+    { GROUP_F8, 10, FLOAT, 1, ParameterValue(1.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.10
+    { GROUP_F8, 11, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.0f), ParameterValue(10.0f) }, // F8.11
+    { GROUP_F8, 12, FLOAT, 1, ParameterValue(100.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.12
+    { GROUP_F8, 13, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.13
+    { GROUP_F8, 14, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.0f), ParameterValue(10.0f) }, // F8.14
+    { GROUP_F8, 15, INT, 0, ParameterValue(2), ParameterValue(0), ParameterValue(4) }, // F8.15
+    { GROUP_F8, 16, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.16
+    { GROUP_F8, 17, FLOAT, 1, ParameterValue(1.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.17
+    { GROUP_F8, 18, FLOAT, 1, ParameterValue(100.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.18
+    { GROUP_F8, 19, FLOAT, 1, ParameterValue(1.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.19
+    { GROUP_F8, 20, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(2) }, // F8.20
+    { GROUP_F8, 21, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F8.21
+    { GROUP_F8, 22, FLOAT, 2, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F8.22
+    { GROUP_F8, 23, FLOAT, 1, ParameterValue(95.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.23
+    { GROUP_F8, 24, FLOAT, 1, ParameterValue(30.0f), ParameterValue(0.0f), ParameterValue(6000.0f) }, // F8.24
+    { GROUP_F8, 25, FLOAT, 1, ParameterValue(80.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.25
+    { GROUP_F8, 26, FLOAT, 1, ParameterValue(3.0f), ParameterValue(0.0f), ParameterValue(60.0f) }, // F8.26
+    { GROUP_F8, 27, FLOAT, 1, ParameterValue(0.0f), ParameterValue(-3276.8f), ParameterValue(3276.8f) }, // F8.27
+    { GROUP_F8, 28, FLOAT, 1, ParameterValue(10.0f), ParameterValue(-3276.8f), ParameterValue(3276.8f) }, // F8.28
+    { GROUP_F8, 29, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(3) }, // F8.29
+    { GROUP_F8, 30, FLOAT, 2, ParameterValue(48.0f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F8.30
+    { GROUP_F8, 31, FLOAT, 0, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(9999.0f) }, // F8.31
+    { GROUP_F8, 32, FLOAT, 1, ParameterValue(60.0f), ParameterValue(0.0f), ParameterValue(6500.0f) }, // F8.32
+    { GROUP_F8, 33, FLOAT, 1, ParameterValue(600.0f), ParameterValue(0.0f), ParameterValue(6500.0f) }, // F8.33
+    { GROUP_F8, 34, INT, 0, ParameterValue(6), ParameterValue(0), ParameterValue(9999) }, // F8.34
+    { GROUP_F8, 35, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F8.35
+    { GROUP_F8, 36, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F8.36
+    { GROUP_F8, 37, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(3) }, // F8.37
+    { GROUP_F8, 38, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(1000.0f) }, // F8.38
+    { GROUP_F8, 39, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F8.39
+    { GROUP_F8, 40, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F8.40
+    { GROUP_F8, 41, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.0f), ParameterValue(360.0f) }, // F8.41
+    { GROUP_F8, 42, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F8.42
+    { GROUP_F8, 43, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(300.0f) }, // F8.43
+    { GROUP_F8, 44, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.0f), ParameterValue(99.99f) }, // F8.44
+    { GROUP_F8, 45, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(250.0f) }, // F8.45
+    { GROUP_F8, 46, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F8.46
+    { GROUP_F8, 47, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F8.47
+    { GROUP_F8, 48, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F8.48
+    { GROUP_F8, 49, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(100.0f) }, // F8.49
+    { GROUP_F8, 50, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(50.0f) }, // F8.50
+    { GROUP_F8, 51, FLOAT, 1, ParameterValue(5.0f), ParameterValue(0.1f), ParameterValue(400.0f) }, // F8.51
+    { GROUP_F8, 52, FLOAT, 1, ParameterValue(5.0f), ParameterValue(0.1f), ParameterValue(400.0f) }, // F8.52
+    { GROUP_F8, 53, FLOAT, 1, ParameterValue(5.0f), ParameterValue(0.1f), ParameterValue(999.9f) }, // F8.53
+    { GROUP_F8, 54, FLOAT, 1, ParameterValue(5.0f), ParameterValue(0.1f), ParameterValue(999.9f) }, // F8.54
+    { GROUP_F9, 0, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // F9.00
+    { GROUP_F9, 1, FLOAT, 1, ParameterValue(1.0f), ParameterValue(1.0f), ParameterValue(500.0f) }, // F9.01
+    { GROUP_F9, 2, FLOAT, 2, ParameterValue(0.01f), ParameterValue(0.01f), ParameterValue(99.99f) }, // F9.02
+    { GROUP_F9, 3, FLOAT, 0, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(60000.0f) }, // F9.03
+    { GROUP_F9, 4, FLOAT, 2, ParameterValue(50.0f), ParameterValue(1.0f), ParameterValue(400.0f) }, // F9.04
+    { GROUP_F9, 5, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // F9.05
+    { GROUP_F9, 6, FLOAT, 3, ParameterValue(0.001f), ParameterValue(0.001f), ParameterValue(65.535f) }, // F9.06
+    { GROUP_F9, 11, FLOAT, 2, ParameterValue(0.01f), ParameterValue(0.01f), ParameterValue(100.0f) }, // F9.11
+    { GROUP_FA, 0, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // FA.00
+    { GROUP_FA, 1, FLOAT, 1, ParameterValue(1.0f), ParameterValue(30.0f), ParameterValue(110.0f) }, // FA.01
+    { GROUP_FA, 2, STRING, 0, ParameterValue(text4), ParameterValue(text5), ParameterValue(emptyText) }, // FA.02
+    { GROUP_FA, 3, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(1) }, // FA.03
+    { GROUP_FA, 4, STRING, 0, ParameterValue(text6), ParameterValue(text7), ParameterValue(emptyText) }, // FA.04
+    { GROUP_FA, 5, FLOAT, 1, ParameterValue(1.5f), ParameterValue(30.0f), ParameterValue(200.0f) }, // FA.05
+    { GROUP_FA, 6, FLOAT, 2, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(99.99f) }, // FA.06
+    { GROUP_FA, 7, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(2) }, // FA.07
+    { GROUP_FA, 8, FLOAT, 1, ParameterValue(1.2f), ParameterValue(120.0f), ParameterValue(150.0f) }, // FA.08
+    { GROUP_FA, 9, FLOAT, 1, ParameterValue(5.0f), ParameterValue(0.0f), ParameterValue(15.0f) }, // FA.09
+    { GROUP_FA, 10, INT, 0, ParameterValue(30), ParameterValue(0), ParameterValue(200) }, // FA.10
+    { GROUP_FA, 11, INT, 0, ParameterValue(20), ParameterValue(0), ParameterValue(1000) }, // FA.11
+    { GROUP_FA, 12, FLOAT, 2, ParameterValue(5.00f), ParameterValue(0.0f), ParameterValue(200.0f) }, // FA.12
+    { GROUP_FA, 13, FLOAT, 2, ParameterValue(50.00f), ParameterValue(0.0f), ParameterValue(200.0f) }, // FA.13
+    { GROUP_FA, 14, INT, 0, ParameterValue(11), ParameterValue(0), ParameterValue(111) }, // FA.14
+    { GROUP_FA, 15, FLOAT, 1, ParameterValue(180.0f), ParameterValue(80.0f), ParameterValue(200.0f) }, // FA.15
+    { GROUP_FA, 16, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(10) }, // FA.16
+    { GROUP_FA, 17, FLOAT, 1, ParameterValue(3.0f), ParameterValue(0.5f), ParameterValue(25.0f) }, // FA.17
+    { GROUP_FA, 18, INT, 0, ParameterValue(3), ParameterValue(0), ParameterValue(3) }, // FA.18
+    { GROUP_FA, 19, INT, 0, ParameterValue(20), ParameterValue(0), ParameterValue(100) }, // FA.19
+    { GROUP_FA, 20, INT, 0, ParameterValue(50), ParameterValue(50), ParameterValue(200) }, // FA.20
+    { GROUP_FA, 21, INT, 0, ParameterValue(60), ParameterValue(0), ParameterValue(100) }, // FA.21
+    { GROUP_FA, 22, INT, 0, ParameterValue(5), ParameterValue(0), ParameterValue(50) }, // FA.22
+    { GROUP_FA, 23, INT, 0, ParameterValue(80), ParameterValue(0), ParameterValue(100) }, // FA.23
+    { GROUP_FA, 24, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(1) }, // FA.24
+    { GROUP_FA, 25, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // FA.25
+    { GROUP_FA, 26, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(1) }, // FA.26
+    { GROUP_FB, 0, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(15) }, // Fb.00
+    { GROUP_FB, 1, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(15) }, // Fb.01
+    { GROUP_FB, 2, FLOAT, 2, ParameterValue(1.00f), ParameterValue(0.01f), ParameterValue(99.99f) }, // Fb.02
+    { GROUP_FB, 3, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // Fb.03
+    { GROUP_FB, 4, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // Fb.04
+    { GROUP_FB, 5, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // Fb.05
+    { GROUP_FB, 6, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // Fb.06
+    { GROUP_FB, 7, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(999.9f) }, // Fb.07
+    { GROUP_FB, 8, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(300.0f) }, // Fb.08
+    { GROUP_FB, 9, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(300.0f) }, // Fb.09
+    { GROUP_FB, 10, INT, 0, ParameterValue(103), ParameterValue(0), ParameterValue(303) }, // Fb.10
+    { GROUP_FB, 11, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(9999) }, // Fb.11
+    { GROUP_FB, 12, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(9999) }, // Fb.12
+    { GROUP_FB, 13, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // Fb.13
+    { GROUP_FB, 14, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // Fb.14
+    { GROUP_FB, 15, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // Fb.15
+    { GROUP_FB, 16, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // Fb.16
+    { GROUP_FB, 17, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // Fb.17
+    { GROUP_FB, 18, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // Fb.18
+    { GROUP_FB, 19, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // Fb.19
+    { GROUP_FB, 20, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // Fb.20
+    { GROUP_FB, 21, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // Fb.21
+    { GROUP_FB, 22, STRING, 0, ParameterValue(text8), ParameterValue(emptyText), ParameterValue(emptyText) }, // Fb.22
+    { GROUP_FC, 0, INT, 0, ParameterValue(3), ParameterValue(0), ParameterValue(5) }, // FC.00
+    { GROUP_FC, 1, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(6) }, // FC.01
+    { GROUP_FC, 2, INT, 0, ParameterValue(1), ParameterValue(1), ParameterValue(247) }, // FC.02
+    { GROUP_FC, 3, FLOAT, 1, ParameterValue(10.0f), ParameterValue(0.0f), ParameterValue(600.0f) }, // FC.03
+    { GROUP_FC, 4, STRING, 0, ParameterValue(emptyText), ParameterValue(emptyText), ParameterValue(emptyText) }, // FC.04
+    { GROUP_FC, 5, INT, 0, ParameterValue(1), ParameterValue(0), ParameterValue(2) }, // FC.05
+    { GROUP_FP, 0, STRING, 0, ParameterValue(emptyText), ParameterValue(text9), ParameterValue(text10) }, // FP.00
+    { groupIndex(GROUP_d), 0, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.00f), ParameterValue(400.00f) }, // d-00
+    { groupIndex(GROUP_d), 1, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.00f), ParameterValue(400.00f) }, // d-01
+    { groupIndex(GROUP_d), 2, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(999) }, // d-02
+    { groupIndex(GROUP_d), 3, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(999) }, // d-03
+    { groupIndex(GROUP_d), 4, FLOAT, 1, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(999.9f) }, // d-04
+    { groupIndex(GROUP_d), 5, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(60000) }, // d-05
+    { groupIndex(GROUP_d), 6, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.00f), ParameterValue(10.00f) }, // d-06
+    { groupIndex(GROUP_d), 7, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.00f), ParameterValue(20.00f) }, // d-07
+    { groupIndex(GROUP_d), 8, FLOAT, 2, ParameterValue(0.00f), ParameterValue(0.00f), ParameterValue(10.00f) }, // d-08
+    { groupIndex(GROUP_d), 9, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(0x3F) }, // d-09
+    { groupIndex(GROUP_d), 10, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // d-10
+    { groupIndex(GROUP_d), 11, FLOAT, 0, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(9999.0f) }, // d-11
+    { groupIndex(GROUP_d), 12, FLOAT, 0, ParameterValue(0.0f), ParameterValue(0.0f), ParameterValue(9999.0f) }, // d-12
+    { groupIndex(GROUP_d), 13, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // d-13
+    { groupIndex(GROUP_d), 14, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // d-14
+    { groupIndex(GROUP_d), 15, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // d-15
+    { groupIndex(GROUP_d), 16, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(9999) }, // d-16
+    { groupIndex(GROUP_d), 17, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(4095) }, // d-17
+    { groupIndex(GROUP_d), 18, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(4095) }, // d-18
+    { groupIndex(GROUP_d), 19, INT, 0, ParameterValue(0), ParameterValue(0), ParameterValue(4095) }, // d-19
+};
+
+// Тексты в том же порядке, что и parameterCatalog[]
+const ParameterText parameterTexts[PARAMETER_CATALOG_SIZE] PROGMEM = {
+    { nameF0_00, unitKiloWatt, descF0_00 }, // F0.00
+    { nameF0_01, emptyText, descF0_01 }, // F0.01
+    { nameF0_02, emptyText, descF0_02 }, // F0.02
+    { nameF0_03, emptyText, descF0_03 }, // F0.03
+    { nameF0_04, emptyText, descF0_03 }, // F0.04
+    { nameF0_05, emptyText, descF0_05 }, // F0.05
+    { nameF0_06, emptyText, descF0_06 }, // F0.06
+    { nameF0_07, unitHertz, descF0_07 }, // F0.07
+    { nameF0_08, unitHertz, descF0_08 }, // F0.08
+    { nameF0_09, unitHertz, descF0_09 }, // F0.09
+    { nameF0_10, unitHertz, descF0_10 }, // F0.10
+    { nameF0_11, emptyText, descF0_11 }, // F0.11
+    { nameF0_12, unitSecond, descF0_12 }, // F0.12
+    { nameF0_13, unitSecond, descF0_13 }, // F0.13
+    { nameF0_14, emptyText, descF0_14 }, // F0.14
+    { nameF0_15, emptyText, descF0_15 }, // F0.15
+    { nameF0_16, emptyText, descF0_16 }, // F0.16
+    { nameF0_17, emptyText, descF0_17 }, // F0.17
+    { nameF0_18, emptyText, descReserved }, // F0.18
+    { nameF0_19, emptyText, descReserved }, // F0.19
+    { nameF0_20, emptyText, descF0_20 }, // F0.20
+    { nameF1_00, emptyText, descF1_00 }, // F1.00
+    { nameF1_01, unitPercent, descF1_01 }, // F1.01
+    { nameF1_02, unitHertz, descF1_02 }, // F1.02
+    { nameF1_03, unitKiloHertz, descF1_03 }, // F1.03
+    { nameF1_04, unitHertz, descF1_04 }, // F1.04
+    { nameF1_05, unitPercent, descF1_05 }, // F1.05
+    { nameF1_06, unitHertz, descF1_06 }, // F1.06
+    { nameF1_07, unitPercent, descF1_07 }, // F1.07
+    { nameF1_08, unitHertz, descF1_08 }, // F1.08
+    { nameF1_09, unitPercent, descF1_09 }, // F1.09
+    { nameF1_10, emptyText, descF1_10 }, // F1.10
+    { nameF1_11, unitPercent, descF1_11 }, // F1.11
+    { nameF1_12, unitPercent, descF1_12 }, // F1.12
+    { nameF1_13, unitPercent, descF1_13 }, // F1.13
+    { nameF1_14, emptyText, descF1_14 }, // F1.14
+    { nameF2_00, emptyText, descF2_00 }, // F2.00
+    { nameF2_01, emptyText, descF2_01 }, // F2.01
+    { nameF2_02, emptyText, descF2_02 }, // F2.02
+    { nameF2_03, emptyText, descF2_03 }, // F2.03
+    { nameF2_04, unitHertz, descF2_04 }, // F2.04
+    { nameF2_05, unitHertz, descF2_05 }, // F2.05
+    { nameF2_06, unitPercent, descF2_06 }, // F2.06
+    { nameF2_07, emptyText, descReserved }, // F2.07
+    { nameF2_08, emptyText, descReserved }, // F2.08
+    { nameF2_09, emptyText, descReserved }, // F2.09
+    { nameF2_10, emptyText, descF2_10 }, // F2.10
+    { nameF2_11, emptyText, descF2_11 }, // F2.11
+    { nameF2_12, emptyText, descReserved }, // F2.12
+    { nameF2_13, emptyText, descReserved }, // F2.13
+    { nameF2_14, unitPercent, descF2_14 }, // F2.14
+    { nameF2_15, emptyText, descReserved }, // F2.15
+    { nameF2_16, emptyText, descReserved }, // F2.16
+    { nameF2_17, emptyText, descReserved }, // F2.17
+    { nameF2_18, emptyText, descReserved }, // F2.18
+    { nameF2_19, unitPercent, descF2_19 }, // F2.19
+    { nameF2_20, unitPercent, descF2_20 }, // F2.20
+    { nameF2_21, emptyText, descF2_21 }, // F2.21
+    { nameF2_22, emptyText, descF2_22 }, // F2.22
+    { nameF2_23, emptyText, descF2_23 }, // F2.23
+    { nameF2_24, emptyText, descF2_24 }, // F2.24
+    { nameF2_25, unitHertz, descF2_25 }, // F2.25
+    { nameF2_26, emptyText, descF2_26 }, // F2.26
+    { nameF2_27, unitPercent, descF2_27 }, // F2.27
+    { nameF2_28, unitPercent, descF2_28 }, // F2.28
+    { nameF2_29, emptyText, descF2_29 }, // F2.29
+    { nameF2_30, emptyText, descF2_30 }, // F2.30
+    { nameF2_31, emptyText, descF2_31 }, // F2.31
+    { nameF2_32, emptyText, descReserved }, // F2.32
+    { nameF2_33, emptyText, descReserved }, // F2.33
+    { nameF3_00, emptyText, descF3_00 }, // F3.00
+    { nameF3_01, unitHertz, descF3_01 }, // F3.01
+    { nameF3_02, unitSecond, descF3_02 }, // F3.02
+    { nameF3_03, unitPercent, descF3_03 }, // F3.03
+    { nameF3_04, unitSecond, descF3_04 }, // F3.04
+    { nameF3_05, emptyText, descF3_05 }, // F3.05
+    { nameF3_06, unitHertz, descF3_06 }, // F3.06
+    { nameF3_07, unitPercent, descF3_07 }, // F3.07
+    { nameF3_08, unitSecond, descF3_04 }, // F3.08
+    { nameF4_00, unitHertz, descF4_00 }, // F4.00
+    { nameF4_01, unitHertz, descF4_01 }, // F4.01
+    { nameF4_02, unitSecond, descF4_02 }, // F4.02
+    { nameF4_03, unitSecond, descF4_03 }, // F4.03
+    { nameF4_04, unitSecond, descF4_04 }, // F4.04
+    { nameF4_05, unitSecond, descF4_05 }, // F4.05
+    { nameF4_06, emptyText, descF4_06 }, // F4.06
+    { nameF4_07, unitHertz, descF4_07 }, // F4.07
+    { nameF4_08, unitHertz, descF4_08 }, // F4.08
+    { nameF5_00, emptyText, descF5_00 }, // F5.00
+    { nameF5_01, emptyText, descF5_01 }, // F5.01
+    { nameF5_02, emptyText, descF5_02 }, // F5.02
+    { nameF5_03, emptyText, descF5_03 }, // F5.03
+    { nameF5_04, emptyText, descF5_04 }, // F5.04
+    { nameF5_05, emptyText, descF5_05 }, // F5.05
+    { nameF5_06, emptyText, descF5_06 }, // F5.06
+    { nameF5_07, unitSecond, descF5_07 }, // F5.07
+    { nameF5_08, unitSecond, descF5_08 }, // F5.08
+    { nameF5_09, unitHertz, descF5_09 }, // F5.09
+    { nameF5_10, unitHertz, descF5_10 }, // F5.10
+    { nameF5_11, emptyText, descF5_11 }, // F5.11
+    { nameF5_16, emptyText, descF5_16 }, // F5.16
+    { nameF5_17, emptyText, descF5_17 }, // F5.17
+    { nameF5_18, emptyText, descF5_18 }, // F5.18
+    { nameF5_19, emptyText, descF5_19 }, // F5.19
+    { nameF5_20, emptyText, descF5_20 }, // F5.20
+    { nameF6_00, unitPercent, descF6_00 }, // F6.00
+    { nameF6_01, unitPercent, descF6_01 }, // F6.01
+    { nameF6_02, unitPercent, descF6_02 }, // F6.02
+    { nameF6_03, unitPercent, descF6_03 }, // F6.03
+    { nameF6_04, unitPercent, descF6_04 }, // F6.04
+    { nameF6_05, unitPercent, descF6_05 }, // F6.05
+    { nameF6_06, unitPercent, descF6_06 }, // F6.06
+    { nameF6_07, unitPercent, descF6_07 }, // F6.07
+    { nameF6_08, unitSecond, descF6_08 }, // F6.08
+    { nameF6_09, unitPercent, descF6_09 }, // F6.09
+    { nameF6_10, emptyText, descF6_10 }, // F6.10
+    { nameF6_11, unitPercent, descF6_11 }, // F6.11
+    { nameF6_12, unitPercent, descF6_12 }, // F6.12
+    { nameF6_13, unitPercent, descF6_13 }, // F6.13
+    { nameF6_14, unitPercent, descF6_14 }, // F6.14
+    { nameF7_00, unitHertz, descF7_00 }, // F7.00
+    { nameF7_01, unitHertz, descF7_01 }, // F7.01
+    { nameF7_02, unitHertz, descF7_02 }, // F7.02
+    { nameF7_03, unitHertz, descF7_03 }, // F7.03
+    { nameF7_04, unitHertz, descF7_04 }, // F7.04
+    { nameF7_05, unitHertz, descF7_05 }, // F7.05
+    { nameF7_06, unitHertz, descF7_06 }, // F7.06
+    { nameF7_07, emptyText, descF7_07 }, // F7.07
+    { nameF7_08, emptyText, descF7_08 }, // F7.08
+    { nameF7_09, emptyText, descF7_09 }, // F7.09
+    { nameF7_10, unitSecond, descF7_10 }, // F7.10
+    { nameF7_11, unitSecond, descF7_11 }, // F7.11
+    { nameF7_12, unitSecond, descF7_12 }, // F7.12
+    { nameF7_13, unitSecond, descF7_13 }, // F7.13
+    { nameF7_14, unitSecond, descF7_14 }, // F7.14
+    { nameF7_15, unitSecond, descF7_15 }, // F7.15
+    { nameF7_16, unitSecond, descF7_16 }, // F7.16
+    { nameF7_17, emptyText, descF7_17 }, // F7.17
+    { nameF7_18, emptyText, descF7_18 }, // F7.18
+    { nameF7_19, emptyText, descF7_19 }, // F7.19
+    { nameF7_20, emptyText, descF7_20 }, // F7.20
+    { nameF7_21, emptyText, descF7_21 }, // F7.21
+    { nameF7_22, emptyText, descF7_22 }, // F7.22
+    { nameF7_23, emptyText, descF7_23 }, // F7.23
+    { nameF7_24, emptyText, descF7_24 }, // F7.24
+    { nameF7_25, emptyText, descF7_25 }, // F7.25
+    { nameF8_00, emptyText, descF8_00 }, // F8.00
+    { nameF8_01, emptyText, descF8_01 }, // F8.01
+    { nameF8_02, emptyText, descF8_02 }, // F8.02
+    { nameF8_03, emptyText, descF8_03 }, // F8.03
+    { nameF8_04, unitSecond, descF8_04 }, // F8.04
+    { nameF8_05, unitPercent, descF8_05 }, // F8.05
+    { nameF8_06, unitSecond, descF8_06 }, // F8.06
+    { nameF8_07, unitPercent, descF8_07 }, // F8.07
+    { nameF8_08, unitPercent, descF8_08 }, // F8.08
+    { nameF8_09, emptyText, descF8_09 }, // F8.09
+    { nameF8_10, unitSecond, descF8_10 }, // F8.10
+    { nameF8_11, unitSecond, descF8_11 }, // F8.11
+    { nameF8_12, unitPercent, descF8_12 }, // F8.12
+    { nameF8_13, unitPercent, descF8_13 }, // F8.13
+    { nameF8_14, unitSecond, descF8_14 }, // F8.14
+    { nameF8_15, emptyText, descF8_15 }, // F8.15
+    { nameF8_16, unitPercent, descF8_16 }, // F8.16
+    { nameF8_17, unitSecond, descF8_17 }, // F8.17
+    { nameF8_18, unitPercent, descF8_18 }, // F8.18
+    { nameF8_19, unitSecond, descF8_19 }, // F8.19
+    { nameF8_20, emptyText, descF8_20 }, // F8.20
+    { nameF8_21, emptyText, descF8_21 }, // F8.21
+    { nameF8_22, unitHertz, descF8_22 }, // F8.22
+    { nameF8_23, unitPercent, descF8_23 }, // F8.23
+    { nameF8_24, unitSecond, descF8_24 }, // F8.24
+    { nameF8_25, unitPercent, descF8_25 }, // F8.25
+    { nameF8_26, unitSecond, descF8_26 }, // F8.26
+    { nameF8_27, emptyText, descF8_27 }, // F8.27
+    { nameF8_28, emptyText, descF8_28 }, // F8.28
+    { nameF8_29, emptyText, descF8_29 }, // F8.29
+    { nameF8_30, unitHertz, descF8_30 }, // F8.30
+    { nameF8_31, emptyText, descF8_31 }, // F8.31
+    { nameF8_32, unitSecond, descF8_32 }, // F8.32
+    { nameF8_33, unitSecond, descF8_33 }, // F8.33
+    { nameF8_34, emptyText, descF8_34 }, // F8.34
+    { nameF8_35, emptyText, descReserved }, // F8.35
+    { nameF8_36, emptyText, descF8_36 }, // F8.36
+    { nameF8_37, emptyText, descF8_37 }, // F8.37
+    { nameF8_38, unitVolt, descF8_38 }, // F8.38
+    { nameF8_39, emptyText, descF8_39 }, // F8.39
+    { nameF8_40, emptyText, descF8_40 }, // F8.40
+    { nameF8_41, unitSecond, descF8_41 }, // F8.41
+    { nameF8_42, emptyText, descF8_40 }, // F8.42
+    { nameF8_43, unitPercent, descF8_43 }, // F8.43
+    { nameF8_44, unitHertz, descF8_44 }, // F8.44
+    { nameF8_45, unitSecond, descF8_45 }, // F8.45
+    { nameF8_46, emptyText, descF8_40 }, // F8.46
+    { nameF8_47, emptyText, descF8_47 }, // F8.47
+    { nameF8_48, emptyText, descF8_48 }, // F8.48
+    { nameF8_49, unitPercent, descF8_49 }, // F8.49
+    { nameF8_50, unitPercent, descF8_50 }, // F8.50
+    { nameF8_51, unitSecond, descF8_51 }, // F8.51
+    { nameF8_52, unitSecond, descF8_52 }, // F8.52
+    { nameF8_53, unitSecond, descF8_53 }, // F8.53
+    { nameF8_54, unitSecond, descF8_54 }, // F8.54
+    { nameF9_00, emptyText, descF9_00 }, // F9.00
+    { nameF9_01, unitVolt, descF9_00 }, // F9.01
+    { nameF9_02, unitAmpere, emptyText }, // F9.02
+    { nameF9_03, unitRpm, emptyText }, // F9.03
+    { nameF9_04, unitHertz, emptyText }, // F9.04
+    { nameF9_05, emptyText, descF9_05 }, // F9.05
+    { nameF9_06, unitOhm, descF9_06 }, // F9.06
+    { nameF9_11, unitAmpere, descF9_11 }, // F9.11
+    { nameFA_00, emptyText, descFA_00 }, // FA.00
+    { nameFA_01, unitPercent, descFA_01 }, // FA.01
+    { nameFA_02, emptyText, descFA_02 }, // FA.02
+    { nameFA_03, emptyText, descFA_03 }, // FA.03
+    { nameFA_04, emptyText, descFA_04 }, // FA.04
+    { nameFA_05, unitPercent, descFA_05 }, // FA.05
+    { nameFA_06, unitHertzPerSecond, descFA_06 }, // FA.06
+    { nameFA_07, emptyText, descFA_07 }, // FA.07
+    { nameFA_08, unitPercent, descFA_08 }, // FA.08
+    { nameFA_09, unitSecond, descFA_09 }, // FA.09
+    { nameFA_10, emptyText, descFA_10 }, // FA.10
+    { nameFA_11, emptyText, descFA_11 }, // FA.11
+    { nameFA_12, unitHertz, descFA_12 }, // FA.12
+    { nameFA_13, unitHertz, descFA_13 }, // FA.13
+    { nameFA_14, emptyText, descFA_14 }, // FA.14
+    { nameFA_15, unitPercent, descFA_15 }, // FA.15
+    { nameFA_16, emptyText, descFA_16 }, // FA.16
+    { nameFA_17, unitSecond, descFA_17 }, // FA.17
+    { nameFA_18, emptyText, descFA_18 }, // FA.18
+    { nameFA_19, emptyText, descFA_19 }, // FA.19
+    { nameFA_20, emptyText, descFA_20 }, // FA.20
+    { nameFA_21, emptyText, descFA_21 }, // FA.21
+    { nameFA_22, emptyText, descFA_22 }, // FA.22
+    { nameFA_23, emptyText, descFA_23 }, // FA.23
+    { nameFA_24, emptyText, descFA_24 }, // FA.24
+    { nameFA_25, emptyText, descReserved }, // FA.25
+    { nameFA_26, emptyText, descFA_26 }, // FA.26
+    { nameFb_00, emptyText, descFb_00 }, // Fb.00
+    { nameFb_01, emptyText, descFb_00 }, // Fb.01
+    { nameFb_02, emptyText, descFb_02 }, // Fb.02
+    { nameFb_03, emptyText, descFb_03 }, // Fb.03
+    { nameFb_04, emptyText, descFb_04 }, // Fb.04
+    { nameFb_05, emptyText, descFb_05 }, // Fb.05
+    { nameFb_06, emptyText, descFb_06 }, // Fb.06
+    { nameFb_07, emptyText, descFb_07 }, // Fb.07
+    { nameFb_08, emptyText, descFb_08 }, // Fb.08
+    { nameFb_09, emptyText, descFb_09 }, // Fb.09
+    { nameFb_10, emptyText, descFb_10 }, // Fb.10
+    { nameFb_11, emptyText, descFb_11 }, // Fb.11
+    { nameFb_12, emptyText, descFb_12 }, // Fb.12
+    { nameFb_13, unitSecond, descFb_13 }, // Fb.13
+    { nameFb_14, emptyText, descReserved }, // Fb.14
+    { nameFb_15, emptyText, descReserved }, // Fb.15
+    { nameFb_16, emptyText, descReserved }, // Fb.16
+    { nameFb_17, emptyText, descReserved }, // Fb.17
+    { nameFb_18, emptyText, descReserved }, // Fb.18
+    { nameFb_19, emptyText, descReserved }, // Fb.19
+    { nameFb_20, emptyText, descFb_20 }, // Fb.20
+    { nameFb_21, emptyText, descFb_21 }, // Fb.21
+    { nameFb_22, emptyText, descFb_22 }, // Fb.22
+    { nameFC_00, emptyText, descFC_00 }, // FC.00
+    { nameFC_01, emptyText, descFC_01 }, // FC.01
+    { nameFC_02, emptyText, descFC_02 }, // FC.02
+    { nameFC_03, unitSecond, descFC_03 }, // FC.03
+    { nameFC_04, emptyText, descReserved }, // FC.04
+    { nameFC_05, emptyText, descFC_05 }, // FC.05
+    { nameFP_00, emptyText, descFP_00 }, // FP.00
+    { named_00, unitHertz, emptyText }, // d-00
+    { named_01, unitHertz, emptyText }, // d-01
+    { named_02, unitVolt, emptyText }, // d-02
+    { named_03, unitVolt, emptyText }, // d-03
+    { named_04, unitAmpere, emptyText }, // d-04
+    { named_05, unitRpm, emptyText }, // d-05
+    { named_06, unitVolt, emptyText }, // d-06
+    { named_07, unitMilliAmpere, emptyText }, // d-07
+    { named_08, unitVolt, emptyText }, // d-08
+    { named_09, emptyText, descd_09 }, // d-09
+    { named_10, unitCelsius, emptyText }, // d-10
+    { named_11, emptyText, descd_11 }, // d-11
+    { named_12, emptyText, descd_12 }, // d-12
+    { named_13, emptyText, descd_13 }, // d-13
+    { named_14, unitSecond, descd_14 }, // d-14
+    { named_15, unitHour, descd_15 }, // d-15
+    { named_16, unitHour, descd_16 }, // d-16
+    { named_17, emptyText, descd_17 }, // d-17
+    { named_18, emptyText, descd_18 }, // d-18
+    { named_19, emptyText, descd_19 }, // d-19
+};
+
+// --- Индекс: номер адреса (groupOffset(группа) + номер параметра) -> запись каталога ---
+const uint16_t parameterIndex[PARAMETER_ADDRESS_COUNT] PROGMEM = {
+    // F0
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20,
+    // F1
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35,
+    // F2
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    // F3
+    70, 71, 72, 73, 74, 75, 76, 77, 78,
+    // F4
+    79, 80, 81, 82, 83, 84, 85, 86, 87,
+    // F5
+    88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+    NO_PARAMETER, NO_PARAMETER, NO_PARAMETER, NO_PARAMETER, 100, 101, 102, 103, 104,
+    // F6
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119,
+    // F7
+    120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145,
+    // F8
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157,
+    158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169,
+    170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+    182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, NO_PARAMETER,
+    // F9
+    201, 202, 203, 204, 205, 206, 207, NO_PARAMETER, NO_PARAMETER, NO_PARAMETER, NO_PARAMETER, 208,
+    // FA
+    209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
+    221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232,
+    233, 234, 235,
+    // FB
+    236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258,
+    // FC
+    259, 260, 261, 262, 263, 264,
+    // FP
+    265,
+    // d
+    266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277,
+    278, 279, 280, 281, 282, 283, 284, 285
+};
+
+#endif // HS321_ENABLE_CATALOG
+
+// --- Коды ошибок ---
+static const char faultName1[] PROGMEM = "OU1 (1)";
+static const char faultCauses1[] PROGMEM = "Перенапряжение во время разгона , Ненормальное входное напряжение";
+static const char faultSolution1[] PROGMEM = "Проверьте входное питание";
+static const char faultName2[] PROGMEM = "OU2 (2)";
+static const char faultCauses2[] PROGMEM = "Перенапряжение во время торможения, Время торможения слишком короткое";
+static const char faultSolution2[] PROGMEM = "Увеличьте время торможения";
+static const char faultName3[] PROGMEM = "OU3 (3)";
+static const char faultCauses3[] PROGMEM = "Перенапряжение на постоянной скорости, Ненормальное входное напряжение";
+static const char faultName4[] PROGMEM = "OCC1 (4)";
+static const char faultCauses4[] PROGMEM = "Аппаратный перегрузка тока во время разгона, Мощность привода переменного тока низкая";
+static const char faultSolution4[] PROGMEM = "Выберите привод переменного тока с большей мощностью";
+static const char faultName5[] PROGMEM = "OCC2 (5)";
+static const char faultCauses5[] PROGMEM = "Аппаратный перегрузка тока во время торможения, Низкая мощность привода переменного тока";
+static const char faultName6[] PROGMEM = "OCC3 (6)";
+static const char faultCauses6[] PROGMEM = "Аппаратный перегрузка тока на постоянной скорости, Низкая мощность привода переменного тока";
+static const char faultName7[] PROGMEM = "OCS1 (7)";
+static const char faultCauses7[] PROGMEM = "Программная перегрузка тока во время разгона, Низкая мощность привода переменного тока";
+static const char faultName8[] PROGMEM = "OCS2 (8)";
+static const char faultCauses8[] PROGMEM = "Программная перегрузка тока во время торможения, Время торможения слишком короткое";
+static const char faultName9[] PROGMEM = "OCS3 (9)";
+static const char faultCauses9[] PROGMEM = "Программная перегрузка тока на постоянной скорости, Ненормальное входное напряжение";
+static const char faultName10[] PROGMEM = "EFO (10)";
+static const char faultCauses10[] PROGMEM = "Модуль отключения питания, Ненормальное входное напряжение";
+static const char faultSolution10[] PROGMEM = "Проверьте входное напряжение";
+static const char faultName11[] PROGMEM = "OU (11)";
+static const char faultCauses11[] PROGMEM = "Перенапряжение при остановке, Ненормальное входное напряжение";
+static const char faultName12[] PROGMEM = "OU3 (12)";
+static const char faultCauses12[] PROGMEM = "Перенапряжение на постоянной скорости, Слишком высокое напряжение питания";
+static const char faultSolution12[] PROGMEM = "Проверьте, не слишком ли высокое напряжение питания";
+static const char faultName13[] PROGMEM = "LU (13)";
+static const char faultCauses13[] PROGMEM = "Недостаточное напряжение, Ненормальное входное напряжение";
+static const char faultSolution13[] PROGMEM = "Проверьте напряжение питания";
+static const char faultName14[] PROGMEM = "OH (14)";
+static const char faultCauses14[] PROGMEM = "Перегрев, Слишком высокая температура окружающей среды";
+static const char faultSolution14[] PROGMEM = "Улучшите условия окружающей среды";
+static const char faultName15[] PROGMEM = "OL1 (15)";
+static const char faultCauses15[] PROGMEM = "Перегрузка привода переменного тока, Перегрузка двигателя";
+static const char faultSolution15[] PROGMEM = "Проверьте нагрузку";
+static const char faultName16[] PROGMEM = "OL2 (16)";
+static const char faultName17[] PROGMEM = "BIAS (17)";
+static const char faultCauses17[] PROGMEM = "Ошибка смещения тока, Аппаратный сбой";
+static const char faultSolution17[] PROGMEM = "Обратитесь к поставщику за обслуживанием";
+static const char faultName18[] PROGMEM = "CBC (18)";
+static const char faultCauses18[] PROGMEM = "Ошибка ограничения тока по волнам, Низкая мощность привода переменного тока";
+static const char faultName19[] PROGMEM = "FBL (19)";
+static const char faultCauses19[] PROGMEM = "Обратная связь PID ниже нижнего предела, Линия обратной связи PID ослаблена";
+static const char faultSolution19[] PROGMEM = "Проверьте соединение обратной связи";
+static const char faultName20[] PROGMEM = "FBH (20)";
+static const char faultCauses20[] PROGMEM = "Обратная связь PID выше верхнего предела, Проверьте соединение обратной связи";
+static const char faultName21[] PROGMEM = "EEEP (21)";
+static const char faultCauses21[] PROGMEM = "Ошибка чтения и записи EEPROM, Ошибка EEPROM";
+static const char faultName22[] PROGMEM = "CE (22)";
+static const char faultCauses22[] PROGMEM = "Ошибка связи между двойными ЦП, Ошибка связи ЦП";
+static const char faultName23[] PROGMEM = "EF (23)";
+static const char faultCauses23[] PROGMEM = "Внешняя ошибка, Входной терминал внешнего устройства закрыт";
+static const char faultSolution23[] PROGMEM = "Отключите входной терминал внешнего устройства и устраните неисправность";
+static const char faultName24[] PROGMEM = "EPA (24)";
+static const char faultCauses24[] PROGMEM = "Ошибка настройки параметров";
+static const char faultName25[] PROGMEM = "E485 (25)";
+static const char faultCauses25[] PROGMEM = "Ошибка разъединения связи";
+static const char faultSolution25[] PROGMEM = "Проверьте, не аномально ли соединение линии связи и правильность последовательности линии.";
+static const char faultName27[] PROGMEM = "SFOC (27)";
+static const char faultCauses27[] PROGMEM = "Программная перегрузка тока";
+static const char faultSolution27[] PROGMEM = "Настройте время разгона/торможения; если параметры двигателя не совпадают, перенастройте параметры.";
+
+// Без HS321_ENABLE_FAULT_TEXT записи ссылаются на пустую строку, а неиспользуемые тексты отбрасываются компилятором
+#if HS321_ENABLE_FAULT_TEXT
+#define FAULT_TEXT(text) text
+#else
+#define FAULT_TEXT(text) emptyText
+#endif
+
+const FaultRecord faultCatalog[FAULT_CATALOG_SIZE] PROGMEM = {
+    { 1, faultName1, FAULT_TEXT(faultCauses1), FAULT_TEXT(faultSolution1) },
+    { 2, faultName2, FAULT_TEXT(faultCauses2), FAULT_TEXT(faultSolution2) },
+    { 3, faultName3, FAULT_TEXT(faultCauses3), FAULT_TEXT(faultSolution1) },
+    { 4, faultName4, FAULT_TEXT(faultCauses4), FAULT_TEXT(faultSolution4) },
+    { 5, faultName5, FAULT_TEXT(faultCauses5), FAULT_TEXT(faultSolution4) },
+    { 6, faultName6, FAULT_TEXT(faultCauses6), FAULT_TEXT(faultSolution4) },
+    { 7, faultName7, FAULT_TEXT(faultCauses7), FAULT_TEXT(faultSolution4) },
+    { 8, faultName8, FAULT_TEXT(faultCauses8), FAULT_TEXT(faultSolution2) },
+    { 9, faultName9, FAULT_TEXT(faultCauses9), FAULT_TEXT(faultSolution1) },
+    { 10, faultName10, FAULT_TEXT(faultCauses10), FAULT_TEXT(faultSolution10) },
+    { 11, faultName11, FAULT_TEXT(faultCauses11), FAULT_TEXT(faultSolution10) },
+    { 12, faultName12, FAULT_TEXT(faultCauses12), FAULT_TEXT(faultSolution12) },
+    { 13, faultName13, FAULT_TEXT(faultCauses13), FAULT_TEXT(faultSolution13) },
+    { 14, faultName14, FAULT_TEXT(faultCauses14), FAULT_TEXT(faultSolution14) },
+    { 15, faultName15, FAULT_TEXT(faultCauses15), FAULT_TEXT(faultSolution15) },
+    { 16, faultName16, FAULT_TEXT(faultCauses14), FAULT_TEXT(faultSolution14) },
+    { 17, faultName17, FAULT_TEXT(faultCauses17), FAULT_TEXT(faultSolution17) },
+    { 18, faultName18, FAULT_TEXT(faultCauses18), FAULT_TEXT(faultSolution4) },
+    { 19, faultName19, FAULT_TEXT(faultCauses19), FAULT_TEXT(faultSolution19) },
+    { 20, faultName20, FAULT_TEXT(faultCauses20), FAULT_TEXT(faultSolution19) },
+    { 21, faultName21, FAULT_TEXT(faultCauses21), FAULT_TEXT(faultSolution17) },
+    { 22, faultName22, FAULT_TEXT(faultCauses22), FAULT_TEXT(faultSolution17) },
+    { 23, faultName23, FAULT_TEXT(faultCauses23), FAULT_TEXT(faultSolution23) },
+    { 24, faultName24, FAULT_TEXT(faultCauses24), FAULT_TEXT(emptyText) },
+    { 25, faultName25, FAULT_TEXT(faultCauses25), FAULT_TEXT(faultSolution25) },
+    { 27, faultName27, FAULT_TEXT(faultCauses27), FAULT_TEXT(faultSolution27) },
+};
+
+#undef FAULT_TEXT
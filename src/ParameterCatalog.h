@@ -0,0 +1,121 @@
+#pragma once
+
+/** @file ParameterCatalog.h
+ * @brief Каталог параметров и кодов ошибок частотника HS321, размещённый во Flash (PROGMEM).
+ *
+ * Все строки каталога (названия, единицы измерения, описания) также хранятся во Flash.
+ * Записи не читаются напрямую: их копируют в ОЗУ через memcpy_P() (см. ParameterGroup),
+ * а строки выводят через reinterpret_cast<const __FlashStringHelper*>.
+ *
+ * Каталог разделён на числовую таблицу parameterCatalog[] (тип, масштаб, значение по
+ * умолчанию, диапазон) и таблицу текстов parameterTexts[]. Числовые обращения библиотеки
+ * (readScaled(), DriveProfile, MonitorScheduler) читают только первую, поэтому, если
+ * приложение не запрашивает тексты, компоновщик (--gc-sections, по умолчанию в ядрах
+ * Arduino) не включает в прошивку ни таблицу текстов, ни сами строки.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "HS321.h"
+
+/**
+ * @struct ParameterRecord
+ * @brief Числовая запись каталога параметров во Flash.
+ */
+struct ParameterRecord {
+    uint8_t group;                 ///< Индекс группы (см. groupIndex())
+    uint8_t subAddress;            ///< Номер параметра в группе (младший байт адреса Modbus)
+    uint8_t type;                  ///< Тип значения (ParameterType)
+    uint8_t decimals;              ///< Знаков после запятой в значении регистра (см. Parameter::decimals)
+    ParameterValue factoryDefault; ///< Значение по умолчанию (для STRING — строка во Flash)
+    ParameterValue minSetting;     ///< Минимально допустимое значение
+    ParameterValue maxSetting;     ///< Максимально допустимое значение
+};
+
+/**
+ * @struct ParameterText
+ * @brief Тексты записи каталога параметров во Flash.
+ */
+struct ParameterText {
+    const char* name;              ///< Название параметра во Flash (например, "F0.07")
+    const char* unit;              ///< Единица измерения во Flash
+    const char* description;       ///< Описание параметра во Flash
+};
+
+/**
+ * @struct FaultRecord
+ * @brief Запись таблицы кодов ошибок во Flash.
+ */
+struct FaultRecord {
+    uint8_t code;                  ///< Код ошибки (регистр 0x8000)
+    const char* name;              ///< Название ошибки во Flash
+    const char* causes;            ///< Возможные причины во Flash
+    const char* solution;          ///< Рекомендованные действия во Flash
+};
+
+/**
+ * @var PARAMETER_CATALOG_SIZE
+ * @brief Количество записей в каталоге параметров.
+ */
+constexpr uint16_t PARAMETER_CATALOG_SIZE = 286;
+
+/**
+ * @var FAULT_CATALOG_SIZE
+ * @brief Количество записей в таблице кодов ошибок.
+ */
+constexpr uint8_t FAULT_CATALOG_SIZE = 26;
+
+/**
+ * @var PARAMETER_ADDRESS_COUNT
+ * @brief Количество номеров адресов во всех группах (размер индекса parameterIndex[]).
+ */
+constexpr uint16_t PARAMETER_ADDRESS_COUNT = groupOffset(GROUP_COUNT);
+
+/**
+ * @var NO_PARAMETER
+ * @brief Значение индекса parameterIndex[] для адреса, которого нет в каталоге (резервные номера).
+ */
+constexpr uint16_t NO_PARAMETER = 0xFFFF;
+
+#if HS321_ENABLE_CATALOG
+
+/**
+ * @var parameterCatalog[]
+ * @brief Записи всех параметров, упорядоченные по группе и номеру параметра.
+ */
+extern const ParameterRecord parameterCatalog[PARAMETER_CATALOG_SIZE] PROGMEM;
+
+/**
+ * @var parameterTexts[]
+ * @brief Тексты параметров в порядке записей parameterCatalog[].
+ */
+extern const ParameterText parameterTexts[PARAMETER_CATALOG_SIZE] PROGMEM;
+
+/**
+ * @var parameterGroupStart[]
+ * @brief Индекс первой записи каждой группы в parameterCatalog[]; последний элемент — PARAMETER_CATALOG_SIZE.
+ */
+extern const uint16_t parameterGroupStart[GROUP_COUNT + 1] PROGMEM;
+
+/**
+ * @var parameterIndex[]
+ * @brief Индекс записей каталога по адресу Modbus.
+ *
+ * Элемент groupOffset(groupIndex(группа)) + номер параметра содержит индекс записи в
+ * parameterCatalog[] или NO_PARAMETER. Позволяет найти параметр за O(1) без перебора групп.
+ */
+extern const uint16_t parameterIndex[PARAMETER_ADDRESS_COUNT] PROGMEM;
+
+/**
+ * @var parameterGroupNames[]
+ * @brief Названия групп параметров во Flash.
+ */
+extern const char* const parameterGroupNames[GROUP_COUNT] PROGMEM;
+
+#endif // HS321_ENABLE_CATALOG
+
+/**
+ * @var faultCatalog[]
+ * @brief Описания кодов ошибок, упорядоченные по коду.
+ */
+extern const FaultRecord faultCatalog[FAULT_CATALOG_SIZE] PROGMEM;
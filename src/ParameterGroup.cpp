@@ -1,46 +1,211 @@
-#include "../include/ParameterGroup.h"
+#include "ParameterGroup.h"
+
+#if HS321_ENABLE_CATALOG
+/**
+ * @brief Начало каждой группы в индексе parameterIndex[] (groupOffset(), вычисленный при компиляции).
+ */
+static const uint16_t indexOffsets[GROUP_COUNT] PROGMEM = {
+    groupOffset(0),  groupOffset(1),  groupOffset(2),  groupOffset(3),  groupOffset(4),
+    groupOffset(5),  groupOffset(6),  groupOffset(7),  groupOffset(8),  groupOffset(9),
+    groupOffset(10), groupOffset(11), groupOffset(12), groupOffset(13), groupOffset(14)
+};
+
+static_assert(GROUP_COUNT == 15, "indexOffsets[] must list every group");
+#endif
 
 /**
  * @brief Конструктор класса ParameterGroup.
  *
- * Инициализирует группу параметров с указанным именем и максимальным количеством параметров.
- * Выделяет динамически память для массива параметров.
+ * Читает из Flash границы группы в каталоге. Память под параметры не выделяется.
+ * Без каталога (HS321_ENABLE_CATALOG = 0) группа пуста.
  *
- * @param groupName Указатель на строку с названием группы (например, "Основные параметры").
- * @param maxParameters Максимальное количество параметров, которые можно добавить в группу (по умолчанию — 10).
+ * @param group Группа параметров (например, GROUP_F1).
  */
-ParameterGroup::ParameterGroup(const char *groupName, const int maxParameters)
-                                                        :GROUP_NAME(groupName),
-                                                        MAX_PARAMETERS(maxParameters),
-                                                        _parameterCount(0) {
-    _parameters = new Parameter[maxParameters]; // Выделение памяти под массив параметров
+ParameterGroup::ParameterGroup(const GroupsParameter group)
+                                                        :_group(groupIndex(group)),
+                                                        _first(0),
+                                                        _count(0) {
+#if HS321_ENABLE_CATALOG
+    if (_group < GROUP_COUNT) {
+        _first = pgm_read_word(&parameterGroupStart[_group]);
+        _count = static_cast<uint8_t>(pgm_read_word(&parameterGroupStart[_group + 1]) - _first);
+    }
+#endif
 }
 
 /**
- * @brief Деструктор класса ParameterGroup.
+ * @brief Название группы.
  *
- * Освобождает динамически выделенную память, занятую массивом параметров.
- * Предотвращает утечки памяти при уничтожении объекта.
+ * @return Название группы во Flash или nullptr для неизвестной группы (и без каталога).
  */
-ParameterGroup::~ParameterGroup() {
-    delete[] _parameters; // Освобождение памяти
+const __FlashStringHelper* ParameterGroup::name() const {
+#if HS321_ENABLE_CATALOG
+    if (_group < GROUP_COUNT) {
+        return reinterpret_cast<const __FlashStringHelper*>(pgm_read_ptr(&parameterGroupNames[_group]));
+    }
+#endif
+    return nullptr;
 }
 
 /**
- * @brief Добавляет параметр в группу.
+ * @brief Копирование параметра группы по порядковому номеру в каталоге.
  *
- * Копирует переданный параметр в массив группы, если есть свободное место.
- * Если количество параметров достигло лимита (MAX_PARAMETERS), выводит предупреждение в последовательный порт.
+ * @param index Порядковый номер параметра в группе.
+ * @param param Структура, в которую копируется параметр.
+ * @return true, если параметр найден, иначе false.
+ */
+bool ParameterGroup::getParameter(const uint8_t index, Parameter& param) const {
+    if (index >= _count) {
+        return false;
+    }
+    return copyRecord(_first + index, param);
+}
+
+/**
+ * @brief Копирование параметра группы по номеру параметра.
  *
- * @param param Константная ссылка на объект Parameter, который необходимо добавить в группу.
+ * Запись находится через индекс parameterIndex[] без перебора группы.
  *
- * @warning Если массив параметров заполнен, новое значение не будет добавлено,
- *          и в порт Serial будет выведено сообщение об ошибке.
+ * @param numberGroup Номер параметра в группе.
+ * @param param Структура, в которую копируется параметр.
+ * @return true, если параметр есть в каталоге, иначе false.
  */
-void ParameterGroup::addParameter(const Parameter &param) {
-    if (_parameterCount < MAX_PARAMETERS) {
-        _parameters[_parameterCount++] = param; // Копирование параметра в массив
+bool ParameterGroup::findParameter(const uint8_t numberGroup, Parameter& param) const {
+    if (_group >= GROUP_COUNT) {
+        return false;
+    }
+    return copyRecord(indexedRecord(_group, numberGroup), param);
+}
+
+/**
+ * @brief Копирование параметра по адресу Modbus.
+ *
+ * @param address Адрес параметра (см. HS321::buildParameterAddress()).
+ * @param param Структура, в которую копируется параметр.
+ * @return true, если параметр есть в каталоге, иначе false.
+ */
+bool ParameterGroup::findByAddress(const uint16_t address, Parameter& param) {
+    return copyRecord(addressRecord(address), param);
+}
+
+/**
+ * @brief Копирование числовых данных параметра по адресу Modbus.
+ *
+ * Читает только числовую таблицу каталога; строки параметра равны nullptr.
+ *
+ * @param address Адрес параметра (см. HS321::buildParameterAddress()).
+ * @param param Структура, в которую копируются тип, масштаб, значение по умолчанию и диапазон.
+ * @return true, если параметр есть в каталоге, иначе false.
+ */
+bool ParameterGroup::findNumeric(const uint16_t address, Parameter& param) {
+    return copyNumeric(addressRecord(address), param);
+}
+
+/**
+ * @brief Номер параметра по порядковому номеру в каталоге.
+ *
+ * @param index Порядковый номер параметра в группе.
+ * @return Номер параметра в группе или 0xFF, если index вне группы.
+ */
+uint8_t ParameterGroup::subAddress(const uint8_t index) const {
+#if HS321_ENABLE_CATALOG
+    if (index < _count) {
+        return pgm_read_byte(&parameterCatalog[_first + index].subAddress);
+    }
+#else
+    (void)index;
+#endif
+    return 0xFF;
+}
+
+/**
+ * @brief Индекс записи каталога по адресу Modbus.
+ *
+ * Старший байт адреса — код группы (0x00..0x0D или 0x70 для группы d), младший — номер параметра.
+ *
+ * @param address Адрес параметра.
+ * @return Индекс записи в parameterCatalog[] или NO_PARAMETER.
+ */
+uint16_t ParameterGroup::addressRecord(const uint16_t address) {
+    const uint8_t code = static_cast<uint8_t>(address >> 8);
+    uint8_t group;
+    if (code == GROUP_d) {
+        group = groupIndex(GROUP_d);
+    } else if (code < GROUP_COUNT - 1) {
+        group = code;
     } else {
-        Serial.println("Достигнуто максимальное количество параметров!"); // Вывод предупреждения
+        return NO_PARAMETER;
+    }
+    return indexedRecord(group, static_cast<uint8_t>(address & 0xFF));
+}
+
+/**
+ * @brief Индекс записи каталога через индекс parameterIndex[].
+ *
+ * @param group Индекс группы (см. groupIndex()), меньше GROUP_COUNT.
+ * @param numberGroup Номер параметра в группе.
+ * @return Индекс записи в parameterCatalog[] или NO_PARAMETER (номер вне группы, резервный или каталог исключён).
+ */
+uint16_t ParameterGroup::indexedRecord(const uint8_t group, const uint8_t numberGroup) {
+#if HS321_ENABLE_CATALOG
+    if (numberGroup >= groupSizes[group]) {
+        return NO_PARAMETER;
+    }
+    return pgm_read_word(&parameterIndex[pgm_read_word(&indexOffsets[group]) + numberGroup]);
+#else
+    (void)group;
+    (void)numberGroup;
+    return NO_PARAMETER;
+#endif
+}
+
+/**
+ * @brief Копирование числовой записи каталога в структуру Parameter.
+ *
+ * @param record Индекс записи в parameterCatalog[] или NO_PARAMETER.
+ * @param param Структура, в которую копируется параметр (строки — nullptr).
+ * @return true, если запись скопирована, иначе false.
+ */
+bool ParameterGroup::copyNumeric(const uint16_t record, Parameter& param) {
+#if HS321_ENABLE_CATALOG
+    if (record == NO_PARAMETER) {
+        return false;
+    }
+    ParameterRecord entry;
+    memcpy_P(&entry, &parameterCatalog[record], sizeof(entry));
+    param.name = nullptr;
+    param.factoryDefault = entry.factoryDefault;
+    param.unit = nullptr;
+    param.minSetting = entry.minSetting;
+    param.maxSetting = entry.maxSetting;
+    param.description = nullptr;
+    param.type = static_cast<ParameterType>(entry.type);
+    param.decimals = entry.decimals;
+    return true;
+#else
+    (void)record;
+    (void)param;
+    return false;
+#endif
+}
+
+/**
+ * @brief Копирование записи каталога вместе с текстами в структуру Parameter.
+ *
+ * @param record Индекс записи в parameterCatalog[] или NO_PARAMETER.
+ * @param param Структура, в которую копируется параметр.
+ * @return true, если запись скопирована, иначе false.
+ */
+bool ParameterGroup::copyRecord(const uint16_t record, Parameter& param) {
+    if (!copyNumeric(record, param)) {
+        return false;
     }
+#if HS321_ENABLE_CATALOG
+    ParameterText text;
+    memcpy_P(&text, &parameterTexts[record], sizeof(text));
+    param.name = text.name;
+    param.unit = text.unit;
+    param.description = text.description;
+#endif
+    return true;
 }
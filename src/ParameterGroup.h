@@ -1,47 +1,124 @@
 #pragma once
 
-#include "HS321.h"
+#include "ParameterCatalog.h"
 
 /**
  * @class ParameterGroup
- * @brief Класс для группировки параметров частотного преобразователя.
+ * @brief Курсор на группу параметров в каталоге во Flash.
  *
  * Предназначен для логического объединения параметров по функциональному признаку
  * (например, «Параметры двигателя», «Настройки связи» и т.д.). Позволяет организовать
  * удобное управление и отображение параметров в пользовательском интерфейсе.
+ * Сами параметры хранятся в parameterCatalog[] и parameterTexts[] во Flash; объект хранит
+ * только границы группы в каталоге и копирует запрошенный параметр в ОЗУ.
  */
 class ParameterGroup {
 public:
     /**
      * @brief Конструктор класса.
      *
-     * Создаёт группу параметров с заданным названием и максимальным количеством параметров.
+     * Находит границы группы в каталоге параметров.
      *
-     * @param groupName Название группы (например, "Основные параметры").
-     * @param maxParameters Максимальное количество параметров в группе. По умолчанию — 10.
+     * @param group Группа параметров.
      */
-    explicit ParameterGroup(const char *groupName, int maxParameters = 10);
+    explicit ParameterGroup(GroupsParameter group);
 
     /**
-     * @brief Деструктор класса.
+     * @brief Название группы.
+     * @return Название во Flash (например, "F1 - Параметры управления V/F").
+     */
+    const __FlashStringHelper* name() const;
+
+    /**
+     * @brief Количество параметров группы в каталоге.
+     * @return Количество параметров.
+     */
+    uint8_t size() const { return _count; }
+
+    /**
+     * @brief Копирование параметра группы по порядковому номеру в каталоге.
      *
-     * Освобождает память, выделенную для массива параметров.
+     * Порядковый номер не всегда совпадает с номером параметра: в некоторых группах есть
+     * пропуски адресов (например, F5.12–F5.15).
+     *
+     * @param index Порядковый номер параметра в группе (0..size()-1).
+     * @param param Структура, в которую копируется параметр.
+     * @return true, если параметр найден, иначе false.
+     */
+    bool getParameter(uint8_t index, Parameter& param) const;
+
+    /**
+     * @brief Копирование параметра группы по номеру параметра (младшему байту адреса Modbus).
+     *
+     * Выполняется за O(1) через индекс parameterIndex[].
+     *
+     * @param numberGroup Номер параметра в группе.
+     * @param param Структура, в которую копируется параметр.
+     * @return true, если параметр есть в каталоге, иначе false.
+     */
+    bool findParameter(uint8_t numberGroup, Parameter& param) const;
+
+    /**
+     * @brief Номер параметра (младший байт адреса Modbus) по порядковому номеру в каталоге.
+     * @param index Порядковый номер параметра в группе (0..size()-1).
+     * @return Номер параметра в группе или 0xFF, если index вне группы.
      */
-    ~ParameterGroup();
+    uint8_t subAddress(uint8_t index) const;
 
     /**
-     * @brief Добавление параметра в группу.
+     * @brief Копирование параметра по адресу Modbus за O(1) через индекс parameterIndex[].
+     * @param address Адрес параметра (см. HS321::buildParameterAddress()).
+     * @param param Структура, в которую копируется параметр.
+     * @return true, если параметр есть в каталоге, иначе false.
+     */
+    static bool findByAddress(uint16_t address, Parameter& param);
+
+    /**
+     * @brief Копирование числовых данных параметра по адресу Modbus без обращения к текстам.
      *
-     * Добавляет копию структуры Parameter в массив группы. Если количество параметров
-     * превышает MAX_PARAMETERS, параметр не будет добавлен.
+     * Заполняет тип, масштаб, значение по умолчанию и диапазон; name, unit и description
+     * равны nullptr. Если приложение не использует методы с текстами, таблица текстов
+     * не попадает в прошивку.
      *
-     * @param param Константная ссылка на структуру Parameter, которую нужно добавить.
+     * @param address Адрес параметра (см. HS321::buildParameterAddress()).
+     * @param param Структура, в которую копируется параметр.
+     * @return true, если параметр есть в каталоге, иначе false.
      */
-    void addParameter(const Parameter &param);
+    static bool findNumeric(uint16_t address, Parameter& param);
 
 private:
-    const char* GROUP_NAME;         ///< Название группы параметров (например, "F1 - Управление V/F")
-    const int   MAX_PARAMETERS;     ///< Максимальное количество параметров в группе, определяется при создании
-    Parameter*  _parameters;        ///< Динамически выделяемый массив параметров
-    int         _parameterCount;    ///< Текущее количество добавленных параметров в группе
+    uint8_t  _group;                ///< Индекс группы (см. groupIndex())
+    uint16_t _first;                ///< Индекс первой записи группы в parameterCatalog[]
+    uint8_t  _count;                ///< Количество записей группы
+
+    /**
+     * @brief Индекс записи каталога по адресу Modbus.
+     * @param address Адрес параметра.
+     * @return Индекс записи в parameterCatalog[] или NO_PARAMETER.
+     */
+    static uint16_t addressRecord(uint16_t address);
+
+    /**
+     * @brief Индекс записи каталога через индекс parameterIndex[].
+     * @param group Индекс группы (см. groupIndex()).
+     * @param numberGroup Номер параметра в группе.
+     * @return Индекс записи в parameterCatalog[] или NO_PARAMETER.
+     */
+    static uint16_t indexedRecord(uint8_t group, uint8_t numberGroup);
+
+    /**
+     * @brief Копирование числовой записи каталога в структуру Parameter (строки — nullptr).
+     * @param record Индекс записи в parameterCatalog[] или NO_PARAMETER.
+     * @param param Структура, в которую копируется параметр.
+     * @return true, если запись скопирована, иначе false.
+     */
+    static bool copyNumeric(uint16_t record, Parameter& param);
+
+    /**
+     * @brief Копирование записи каталога вместе с текстами в структуру Parameter.
+     * @param record Индекс записи в parameterCatalog[] или NO_PARAMETER.
+     * @param param Структура, в которую копируется параметр.
+     * @return true, если запись скопирована, иначе false.
+     */
+    static bool copyRecord(uint16_t record, Parameter& param);
 };
@@ -8,7 +8,8 @@
  *
  * Инкапсулирует информацию о параметрах устройства, сгруппированных по функциональному признаку,
  * а также предоставляет доступ к описаниям кодов ошибок и метаданным моделей.
- * Класс использует массив объектов ParameterGroup для организации параметров.
+ * Параметры и ошибки хранятся в каталоге во Flash (см. ParameterCatalog.h); объект хранит
+ * только модель и копирует запрошенные записи в ОЗУ.
  */
 class ParametersHS321 {
 public:
@@ -24,7 +25,7 @@ public:
     /**
      * @brief Деструктор класса.
      *
-     * Освобождает ресурсы, используемые объектом (например, память групп параметров).
+     * Объект не владеет динамической памятью.
      */
     ~ParametersHS321();
 
@@ -41,13 +42,69 @@ public:
     /**
      * @brief Получение информации об ошибке по её коду.
      *
-     * Ищет в таблице ошибок запись с указанным кодом и возвращает указатель на неё.
-     * Если ошибка не найдена, возвращает nullptr.
+     * Ищет в таблице ошибок запись с указанным кодом и копирует её в info.
+     * Строки FaultInfo указывают во Flash.
      *
      * @param code Код ошибки (например, 14 — перегрев).
-     * @return Указатель на структуру FaultInfo с описанием ошибки или nullptr, если не найдена.
+     * @param info Структура, в которую копируется описание ошибки.
+     * @return true, если ошибка найдена, иначе false.
      */
-    const FaultInfo* getFaultInfo(int code) const;
+    bool getFaultInfo(int code, FaultInfo& info) const;
+
+    /**
+     * @brief Курсор на группу параметров.
+     * @param group Группа параметров.
+     * @return Объект ParameterGroup для перебора параметров группы.
+     */
+    ParameterGroup group(GroupsParameter group) const { return ParameterGroup(group); }
+
+    /**
+     * @brief Получение описания параметра по группе и номеру.
+     *
+     * Значение F0.00 по умолчанию (мощность) подставляется по модели.
+     *
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @param param Структура, в которую копируется параметр.
+     * @return true, если параметр есть в каталоге, иначе false.
+     */
+    bool getParameter(GroupsParameter group, uint8_t numberGroup, Parameter& param) const;
+
+    /**
+     * @brief Получение описания параметра по адресу Modbus.
+     *
+     * Выполняется за O(1) через индекс каталога, без перебора групп; подходит для разбора
+     * каждого отсчёта телеметрии. Значение F0.00 по умолчанию подставляется по модели.
+     *
+     * @param address Адрес параметра (например, 0x0007 для F0.07, 0x7005 для d-05).
+     * @param param Структура, в которую копируется параметр.
+     * @return true, если параметр есть в каталоге, иначе false.
+     */
+    bool findByAddress(uint16_t address, Parameter& param) const;
+
+    /**
+     * @brief Получение описания параметра по названию.
+     *
+     * Название разбирается в адрес (см. parseName()), после чего параметр находится по индексу.
+     *
+     * @param name Название параметра (например, "F0.07", "Fb.14", "d-05").
+     * @param param Структура, в которую копируется параметр.
+     * @return true, если параметр есть в каталоге, иначе false.
+     */
+    bool findByName(const char* name, Parameter& param) const;
+
+    /**
+     * @brief Преобразование названия параметра в адрес Modbus.
+     *
+     * Принимает названия вида "Fx.yy" (x — 0..9, A, b, C, P без учёта регистра) и "d-yy"
+     * (допускается также "d.yy"); номер yy — одна или две десятичные цифры.
+     * Наличие параметра в каталоге не проверяется.
+     *
+     * @param name Название параметра.
+     * @param address Адрес параметра (заполняется при успехе).
+     * @return true, если название разобрано, иначе false.
+     */
+    static bool parseName(const char* name, uint16_t& address);
 
     /**
      * @brief Создание параметра с типом float.
@@ -61,9 +118,10 @@ public:
      * @param min Минимальное допустимое значение.
      * @param max Максимальное допустимое значение.
      * @param description Подробное описание параметра.
+     * @param decimals Количество знаков после запятой в значении регистра.
      * @return Объект Parameter, заполненный переданными данными.
      */
-    static Parameter createParameter(const char* name, float defaultValue, const char* unit, float min, float max, const char* description);
+    static Parameter createParameter(const char* name, float defaultValue, const char* unit, float min, float max, const char* description, uint8_t decimals = 1);
 
     /**
      * @brief Создание параметра с типом int.
@@ -97,13 +155,6 @@ public:
     static Parameter createParameter(const char* name, const char* defaultValue, const char* unit, const char* min, const char* max, const char* description);
 
 private:
-    /**
-     * @var _allParameters
-     * @brief Массив групп параметров, по одной на каждую группу (F0, F1, ..., d).
-     * Каждая группа содержит параметры, объединённые по функциональному назначению.
-     */
-    ParameterGroup _allParameters[GroupsParameter::GROUP_COUNT];
-
     /**
      * @var _model
      * @brief Хранит текущую модель частотного преобразователя.
@@ -111,47 +162,4 @@ private:
      * Используется для получения соответствующих параметров и мощности.
      */
     Model _model;
-
-    /**
-     * @def _faultCount
-     * @brief Количество кодов ошибок в таблице.
-     *
-     * Определяет размер массива _faultTable.
-     */
-    static constexpr int _faultCount = 27;
-
-    /**
-     * @var _faultTable
-     * @brief Таблица описаний ошибок частотного преобразователя.
-     *
-     * Содержит информацию о каждой возможной ошибке: название, возможные причины и рекомендуемые действия.
-     */
-    FaultInfo _faultTable[_faultCount] = {
-        { "OU1 (1)", "Перенапряжение во время разгона , Ненормальное входное напряжение", "Проверьте входное питание" },
-        { "OU2 (2)", "Перенапряжение во время торможения, Время торможения слишком короткое", "Увеличьте время торможения" },
-        { "OU3 (3)", "Перенапряжение на постоянной скорости, Ненормальное входное напряжение", "Проверьте входное питание" },
-        { "OCC1 (4)", "Аппаратный перегрузка тока во время разгона, Мощность привода переменного тока низкая", "Выберите привод переменного тока с большей мощностью" },
-        { "OCC2 (5)", "Аппаратный перегрузка тока во время торможения, Низкая мощность привода переменного тока", "Выберите привод переменного тока с большей мощностью" },
-        { "OCC3 (6)", "Аппаратный перегрузка тока на постоянной скорости, Низкая мощность привода переменного тока", "Выберите привод переменного тока с большей мощностью" },
-        { "OCS1 (7)", "Программная перегрузка тока во время разгона, Низкая мощность привода переменного тока", "Выберите привод переменного тока с большей мощностью" },
-        { "OCS2 (8)", "Программная перегрузка тока во время торможения, Время торможения слишком короткое", "Увеличьте время торможения" },
-        { "OCS3 (9)", "Программная перегрузка тока на постоянной скорости, Ненормальное входное напряжение", "Проверьте входное питание" },
-        { "EFO (10)", "Модуль отключения питания, Ненормальное входное напряжение", "Проверьте входное напряжение" },
-        { "OU (11)", "Перенапряжение при остановке, Ненормальное входное напряжение", "Проверьте входное напряжение" },
-        { "OU3 (12)", "Перенапряжение на постоянной скорости, Слишком высокое напряжение питания", "Проверьте, не слишком ли высокое напряжение питания" },
-        { "LU (13)", "Недостаточное напряжение, Ненормальное входное напряжение", "Проверьте напряжение питания" },
-        { "OH (14)", "Перегрев, Слишком высокая температура окружающей среды", "Улучшите условия окружающей среды" },
-        { "OL1 (15)", "Перегрузка привода переменного тока, Перегрузка двигателя", "Проверьте нагрузку" },
-        { "OL2 (16)", "Перегрев, Слишком высокая температура окружающей среды", "Улучшите условия окружающей среды" },
-        { "BIAS (17)", "Ошибка смещения тока, Аппаратный сбой", "Обратитесь к поставщику за обслуживанием" },
-        { "CBC (18)", "Ошибка ограничения тока по волнам, Низкая мощность привода переменного тока", "Выберите привод переменного тока с большей мощностью" },
-        { "FBL (19)", "Обратная связь PID ниже нижнего предела, Линия обратной связи PID ослаблена", "Проверьте соединение обратной связи" },
-        { "FBH (20)", "Обратная связь PID выше верхнего предела, Проверьте соединение обратной связи", "Проверьте соединение обратной связи" },
-        { "EEEP (21)", "Ошибка чтения и записи EEPROM, Ошибка EEPROM", "Обратитесь к поставщику за обслуживанием" },
-        { "CE (22)", "Ошибка связи между двойными ЦП, Ошибка связи ЦП", "Обратитесь к поставщику за обслуживанием" },
-        { "EF (23)", "Внешняя ошибка, Входной терминал внешнего устройства закрыт", "Отключите входной терминал внешнего устройства и устраните неисправность" },
-        { "EPA (24)", "Ошибка настройки параметров", "" },
-        { "E485 (25)", "Ошибка разъединения связи", "Проверьте, не аномально ли соединение линии связи и правильность последовательности линии."},
-        { "SFOC (27)", "Программная перегрузка тока", "Настройте время разгона/торможения; если параметры двигателя не совпадают, перенастройте параметры."}
-    };
 };
@@ -0,0 +1,133 @@
+#include "PlcProgram.h"
+#include "ParameterGroup.h"
+
+/** @file PlcProgram.cpp
+ * @brief Реализация программы простого ПЛК частотника HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+static constexpr uint8_t FREQUENCY_BASE = 0;   ///< F7.00 — частота шага 1
+static constexpr uint8_t CYCLE_MODE = 7;       ///< F7.07 — режим выполнения программы
+static constexpr uint8_t STOP_MEMORY = 8;      ///< F7.08 — запоминание шага при остановке
+static constexpr uint8_t POWER_MEMORY = 9;     ///< F7.09 — запоминание шага при отключении питания
+static constexpr uint8_t DURATION_BASE = 10;   ///< F7.10 — длительность шага 1
+static constexpr uint8_t MODE_BASE = 17;       ///< F7.17 — режим шага 1
+
+/**
+ * @brief Добавление шага в конец программы.
+ *
+ * Режим шага (F7.17–F7.23): 0 — FWD, время 1; 1 — FWD, время 2; 2 — REV, время 1; 3 — REV, время 2.
+ *
+ * @param frequency Частота шага.
+ * @param direction Направление вращения.
+ * @param duration Длительность шага в секундах.
+ * @param secondAcceleration Время разгона/торможения 2.
+ * @return true, если шаг добавлен, иначе false.
+ */
+bool PlcProgram::addStep(const ScaledValue& frequency, const PlcDirection direction, const ScaledValue& duration,
+                         const bool secondAcceleration) {
+    if (_count >= STEP_COUNT) {
+        return false;
+    }
+    const uint8_t mode = static_cast<uint8_t>((direction == PlcDirection::REVERSE) ? 2 : 0) + (secondAcceleration ? 1 : 0);
+    Step step;
+    if (!encode(FREQUENCY_BASE + _count, frequency, step.frequency)
+            || !encode(DURATION_BASE + _count, duration, step.duration)
+            || !encode(MODE_BASE + _count, ScaledValue(mode), step.mode)) {
+        return false;
+    }
+    _steps[_count++] = step;
+    return true;
+}
+
+/**
+ * @brief Сборка образа регистров F7.00–F7.23.
+ *
+ * @param image Буфер на IMAGE_SIZE регистров.
+ */
+void PlcProgram::compile(uint16_t* image) const {
+    for (uint8_t i = 0; i < STEP_COUNT; i++) {
+        const bool used = i < _count;
+        image[FREQUENCY_BASE + i] = used ? _steps[i].frequency : 0;
+        image[DURATION_BASE + i] = used ? _steps[i].duration : 0;
+        image[MODE_BASE + i] = used ? _steps[i].mode : 0;
+    }
+    image[CYCLE_MODE] = static_cast<uint16_t>(_cycle);
+    image[STOP_MEMORY] = _stopMemory ? 1 : 0;
+    image[POWER_MEMORY] = _powerMemory ? 1 : 0;
+}
+
+/**
+ * @brief Загрузка программы в частотник с проверкой.
+ *
+ * @param drive Частотник.
+ * @return true, если образ записан и совпал с прочитанным, иначе false.
+ */
+bool PlcProgram::load(HS321& drive) const {
+    uint16_t image[IMAGE_SIZE];
+    compile(image);
+    if (!drive.writeParametersInGroups(GROUP_F7, 0, image, IMAGE_SIZE)) {
+        return false; // Причина — drive.lastError()
+    }
+    return verify(drive);
+}
+
+/**
+ * @brief Проверка, что в частотник загружена именно эта программа.
+ *
+ * @param drive Частотник.
+ * @param mismatch Номер первого несовпавшего параметра F7 или IMAGE_SIZE (может быть nullptr).
+ * @return true, если регистры совпадают с образом программы, иначе false (в том числе при ошибке связи).
+ */
+bool PlcProgram::verify(HS321& drive, uint8_t* mismatch) const {
+    uint16_t image[IMAGE_SIZE];
+    uint16_t actual[IMAGE_SIZE];
+    compile(image);
+    if (mismatch != nullptr) {
+        *mismatch = IMAGE_SIZE;
+    }
+    if (!drive.readParametersInGroups(GROUP_F7, 0, actual, IMAGE_SIZE)) {
+        return false; // Причина — drive.lastError()
+    }
+    for (uint8_t i = 0; i < IMAGE_SIZE; i++) {
+        if (actual[i] != image[i]) {
+            if (mismatch != nullptr) {
+                *mismatch = i;
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Перевод значения параметра F7 в регистр с проверкой диапазона по каталогу.
+ *
+ * @param numberGroup Номер параметра в группе F7.
+ * @param value Значение.
+ * @param raw Значение регистра.
+ * @return true, если параметр есть в каталоге и значение в его диапазоне, иначе false.
+ */
+bool PlcProgram::encode(const uint8_t numberGroup, const ScaledValue& value, uint16_t& raw) {
+    Parameter param;
+    if (!ParameterGroup::findNumeric(HS321::buildParameterAddress(GROUP_F7, numberGroup), param)
+            || param.type == ParameterType::STRING) {
+        return false;
+    }
+    long minimum;
+    long maximum;
+    if (param.type == ParameterType::FLOAT) {
+        minimum = ScaledValue::fromFloat(param.minSetting.floatValue, param.decimals).value;
+        maximum = ScaledValue::fromFloat(param.maxSetting.floatValue, param.decimals).value;
+    } else {
+        minimum = param.minSetting.intValue;
+        maximum = param.maxSetting.intValue;
+    }
+    const ScaledValue scaled = value.rescale(param.decimals);
+    if (scaled.value < minimum || scaled.value > maximum) {
+        return false;
+    }
+    raw = static_cast<uint16_t>(scaled.value);
+    return true;
+}
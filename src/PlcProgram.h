@@ -0,0 +1,161 @@
+#pragma once
+
+/** @file PlcProgram.h
+ * @brief Программа простого ПЛК частотника HS321 (группа F7): описание шагов и загрузка.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "HS321.h"
+
+/**
+ * @enum PlcCycle
+ * @brief Режим выполнения программы (F7.07).
+ */
+enum class PlcCycle : uint8_t {
+    SINGLE,       ///< Однократный цикл
+    CONTINUOUS,   ///< Непрерывный цикл
+    HOLD_FINAL    ///< Однократный цикл с сохранением частоты последнего шага
+};
+
+/**
+ * @enum PlcDirection
+ * @brief Направление вращения на шаге программы.
+ */
+enum class PlcDirection : uint8_t {
+    FORWARD,   ///< Вперёд (FWD)
+    REVERSE    ///< Назад (REV)
+};
+
+/**
+ * @class PlcProgram
+ * @brief Программа ПЛК из шагов «частота, направление, длительность» и её загрузка в группу F7.
+ *
+ * Шаги описываются в физических величинах и при добавлении проверяются по диапазонам
+ * каталога параметров (F7.00–F7.06 — частоты, F7.10–F7.16 — длительности, F7.17–F7.23 —
+ * режимы), поэтому значение вне диапазона не доходит до частотника. compile() собирает
+ * образ регистров F7.00–F7.23, а load() записывает его одним кадром 0x10 и проверяет
+ * одним кадром чтения 0x03 вместо записи и чтения каждого параметра по отдельности.
+ *
+ * Неиспользуемые шаги (после последнего добавленного) получают нулевые частоту и
+ * длительность. Резервные F7.24, F7.25 не записываются.
+ *
+ * @code
+ * PlcProgram program;
+ * program.addStep(ScaledValue(1000, 2), PlcDirection::FORWARD, ScaledValue(50, 1)); // 10.00 Гц, 5.0 с
+ * program.addStep(ScaledValue(30, 0), PlcDirection::REVERSE, ScaledValue(12, 0));   // 30 Гц, 12 с
+ * program.setCycle(PlcCycle::CONTINUOUS);
+ * program.load(drive);
+ * @endcode
+ */
+class PlcProgram {
+public:
+    /**
+     * @var STEP_COUNT
+     * @brief Наибольшее количество шагов программы.
+     */
+    static constexpr uint8_t STEP_COUNT = 7;
+
+    /**
+     * @var IMAGE_SIZE
+     * @brief Количество регистров образа программы (F7.00–F7.23).
+     */
+    static constexpr uint8_t IMAGE_SIZE = 24;
+
+    /**
+     * @brief Конструктор класса: пустая программа с однократным циклом.
+     */
+    PlcProgram() = default;
+
+    /**
+     * @brief Добавление шага в конец программы.
+     * @param frequency Частота шага (например, ScaledValue(2500, 2) — 25.00 Гц).
+     * @param direction Направление вращения.
+     * @param duration Длительность шага в секундах (например, ScaledValue(105, 1) — 10.5 с).
+     * @param secondAcceleration true — время разгона/торможения 2, false — время 1.
+     * @return true, если шаг добавлен, иначе false (программа заполнена, значение вне диапазона каталога).
+     */
+    bool addStep(const ScaledValue& frequency, PlcDirection direction, const ScaledValue& duration,
+                 bool secondAcceleration = false);
+
+    /**
+     * @brief Удаление всех шагов; режимы программы сохраняются.
+     */
+    void clear() { _count = 0; }
+
+    /**
+     * @brief Количество шагов программы.
+     * @return Количество шагов (не более STEP_COUNT).
+     */
+    uint8_t size() const { return _count; }
+
+    /**
+     * @brief Установка режима выполнения программы (F7.07).
+     * @param cycle Режим выполнения.
+     */
+    void setCycle(PlcCycle cycle) { _cycle = cycle; }
+
+    /**
+     * @brief Установка запоминания шага при остановке (F7.08) и при отключении питания (F7.09).
+     * @param onStop true — после остановки программа продолжается с прерванного шага.
+     * @param onPowerOff true — после отключения питания программа продолжается с прерванного шага.
+     */
+    void setMemory(bool onStop, bool onPowerOff) {
+        _stopMemory = onStop;
+        _powerMemory = onPowerOff;
+    }
+
+    /**
+     * @brief Сборка образа регистров F7.00–F7.23.
+     * @param image Буфер на IMAGE_SIZE регистров; image[i] — значение F7.i.
+     */
+    void compile(uint16_t* image) const;
+
+    /**
+     * @brief Загрузка программы в частотник с проверкой.
+     *
+     * Записывает образ одним кадром 0x10 и сравнивает его с прочитанным одним кадром 0x03.
+     *
+     * @param drive Частотник.
+     * @return true, если образ записан и совпал с прочитанным, иначе false.
+     */
+    bool load(HS321& drive) const;
+
+    /**
+     * @brief Проверка, что в частотник загружена именно эта программа.
+     * @param drive Частотник.
+     * @param mismatch Номер первого параметра F7, не совпавшего с образом; IMAGE_SIZE, если
+     *                 несовпадения нет или регистры не прочитаны (причина — drive.lastError()).
+     * @return true, если регистры F7.00–F7.23 совпадают с образом программы, иначе false.
+     */
+    bool verify(HS321& drive, uint8_t* mismatch = nullptr) const;
+
+private:
+    /**
+     * @struct Step
+     * @brief Шаг программы в единицах регистров.
+     */
+    struct Step {
+        uint16_t frequency;   ///< Значение F7.00 + n
+        uint16_t duration;    ///< Значение F7.10 + n
+        uint16_t mode;        ///< Значение F7.17 + n (направление и время разгона)
+    };
+
+    Step _steps[STEP_COUNT];              ///< Шаги программы
+    uint8_t _count = 0;                   ///< Количество шагов
+    PlcCycle _cycle = PlcCycle::SINGLE;   ///< Режим выполнения F7.07
+    bool _stopMemory = false;             ///< Запоминание шага при остановке F7.08
+    bool _powerMemory = false;            ///< Запоминание шага при отключении питания F7.09
+
+    /**
+     * @brief Перевод значения параметра F7 в регистр с проверкой диапазона по каталогу.
+     * @param numberGroup Номер параметра в группе F7.
+     * @param value Значение (с любым количеством знаков после запятой).
+     * @param raw Значение регистра.
+     * @return true, если параметр есть в каталоге и значение в его диапазоне, иначе false.
+     */
+    static bool encode(uint8_t numberGroup, const ScaledValue& value, uint16_t& raw);
+};
+
+static_assert(ModbusBus::MAX_WRITE_REGISTERS >= PlcProgram::IMAGE_SIZE,
+              "PlcProgram: образ программы должен записываться одним кадром");
@@ -0,0 +1,351 @@
+#include "HS321Config.h"
+
+#if HS321_ENABLE_CACHE
+
+#include "RegisterCache.h"
+
+#include <limits.h>
+
+/** @file RegisterCache.cpp
+ * @brief Реализация кэша регистров частотника HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+/**
+ * @brief Конструктор класса RegisterCache.
+ *
+ * Все регистры изначально недействительны.
+ *
+ * @param drive Частотник, регистры которого кэшируются.
+ * @param volatileTtl Время актуальности параметров мониторинга (группа d) в миллисекундах.
+ */
+RegisterCache::RegisterCache(HS321& drive, const unsigned long volatileTtl)
+                                                                :_drive(&drive),
+                                                                _volatileTtl(volatileTtl){
+    invalidate();
+}
+
+/**
+ * @brief Индекс регистра в плоском массиве.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @return Индекс или NO_INDEX, если номер вне группы.
+ */
+uint16_t RegisterCache::index(const GroupsParameter group, const uint8_t numberGroup) {
+    const uint8_t groupId = groupIndex(group);
+    if (groupId >= GROUP_COUNT || numberGroup >= groupSizes[groupId]) {
+        return NO_INDEX;
+    }
+    return groupOffset(groupId) + numberGroup;
+}
+
+/**
+ * @brief Индекс регистра в плоском массиве по адресу Modbus.
+ *
+ * @param address Полный адрес регистра (группа в старшем байте, номер в младшем).
+ * @return Индекс или NO_INDEX, если адрес вне групп параметров.
+ */
+uint16_t RegisterCache::index(const uint16_t address) {
+    const uint8_t code = static_cast<uint8_t>(address >> 8);
+    if (code != GROUP_d && code >= GROUP_COUNT - 1) {
+        return NO_INDEX;
+    }
+    return index(static_cast<GroupsParameter>(code), static_cast<uint8_t>(address & 0xFF));
+}
+
+/**
+ * @brief Проверяет, можно ли вернуть значение регистра без чтения с частотника.
+ *
+ * Грязное значение всегда считается актуальным: оно новее, чем значение в частотнике.
+ *
+ * @param index Индекс регистра.
+ * @return true, если значение действительно и не устарело.
+ */
+bool RegisterCache::isFresh(const uint16_t index) const {
+    if (_flags[index] & FLAG_DIRTY) {
+        return true;
+    }
+    if (!(_flags[index] & FLAG_VALID)) {
+        return false;
+    }
+    if (index >= VOLATILE_FIRST) {
+        return millis() - _stamps[index - VOLATILE_FIRST] <= _volatileTtl;
+    }
+    return true;
+}
+
+/**
+ * @brief Сохранение прочитанных значений с отметкой времени.
+ *
+ * Грязные регистры не перезаписываются, чтобы не потерять ожидающую запись.
+ *
+ * @param first Индекс первого регистра.
+ * @param values Прочитанные значения.
+ * @param count Количество регистров.
+ */
+void RegisterCache::store(const uint16_t first, const uint16_t* values, const size_t count) {
+    const unsigned long now = millis();
+    for (size_t i = 0; i < count; i++) {
+        const uint16_t position = first + i;
+        if (_flags[position] & FLAG_DIRTY) {
+            continue;
+        }
+        _values[position] = values[i];
+        _flags[position] = FLAG_VALID;
+        if (position >= VOLATILE_FIRST) {
+            _stamps[position - VOLATILE_FIRST] = now;
+        }
+    }
+}
+
+/**
+ * @brief Чтение параметра через кэш.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @param value Указатель на переменную для значения.
+ * @return true при успехе, иначе false.
+ */
+bool RegisterCache::read(const GroupsParameter group, const uint8_t numberGroup, uint16_t* value) {
+    const uint16_t position = index(group, numberGroup);
+    if (position == NO_INDEX || value == nullptr) {
+        return false;
+    }
+    if (!isFresh(position) && !load(group, numberGroup, 1)) {
+        return false;
+    }
+    *value = _values[position];
+    return true;
+}
+
+/**
+ * @brief Загрузка диапазона параметров группы в кэш одним кадром 0x03.
+ *
+ * @param group Группа параметров.
+ * @param numberGroup Номер первого параметра.
+ * @param count Количество параметров.
+ * @return true при успехе, иначе false.
+ */
+bool RegisterCache::load(const GroupsParameter group, const uint8_t numberGroup, const size_t count) {
+    const uint16_t first = index(group, numberGroup);
+    if (first == NO_INDEX || count == 0 || numberGroup + count > groupSizes[groupIndex(group)]) {
+        return false;
+    }
+    uint16_t buffer[largestGroupSize()];
+    if (!_drive->readParametersInGroups(group, numberGroup, buffer, count)) {
+        return false;
+    }
+    store(first, buffer, count);
+    return true;
+}
+
+/**
+ * @brief Отложенная запись параметра.
+ *
+ * Повторная запись того же регистра до flush() только заменяет значение в кэше.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @param value Значение для записи.
+ * @return true, если значение принято, иначе false.
+ */
+bool RegisterCache::write(const GroupsParameter group, const uint8_t numberGroup, const uint16_t value) {
+    const uint16_t position = index(group, numberGroup);
+    // Параметры мониторинга доступны только для чтения
+    if (position == NO_INDEX || position >= VOLATILE_FIRST) {
+        return false;
+    }
+    _values[position] = value;
+    _flags[position] = FLAG_VALID | FLAG_DIRTY;
+    return true;
+}
+
+/**
+ * @brief Передача всех грязных регистров частотнику.
+ *
+ * Регистры каждой группы хранятся подряд, поэтому значения смежных грязных регистров
+ * передаются прямо из кэша без копирования.
+ *
+ * @return true, если все регистры записаны, иначе false.
+ */
+bool RegisterCache::flush() {
+    bool result = true;
+    // Группа d не записывается
+    for (uint8_t groupId = 0; groupId < GROUP_COUNT - 1; groupId++) {
+        const uint16_t offset = groupOffset(groupId);
+        const uint8_t size = groupSizes[groupId];
+        uint8_t number = 0;
+        while (number < size) {
+            if (!(_flags[offset + number] & FLAG_DIRTY)) {
+                number++;
+                continue;
+            }
+            // Поиск конца непрерывного участка грязных регистров
+            uint8_t end = number + 1;
+            while (end < size && (_flags[offset + end] & FLAG_DIRTY) && static_cast<size_t>(end - number) < ModbusBus::MAX_WRITE_REGISTERS) {
+                end++;
+            }
+            const GroupsParameter group = static_cast<GroupsParameter>(groupId);
+            if (_drive->writeParametersInGroups(group, number, &_values[offset + number], end - number)) {
+                for (uint8_t i = number; i < end; i++) {
+                    _flags[offset + i] = FLAG_VALID;
+                }
+            } else {
+                result = false;
+            }
+            number = end;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Значение из кэша без обращения к шине.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @param value Указатель на переменную для значения.
+ * @return true, если в кэше есть значение, иначе false.
+ */
+bool RegisterCache::peek(const GroupsParameter group, const uint8_t numberGroup, uint16_t* value) const {
+    const uint16_t position = index(group, numberGroup);
+    if (position == NO_INDEX || value == nullptr || !(_flags[position] & FLAG_VALID)) {
+        return false;
+    }
+    *value = _values[position];
+    return true;
+}
+
+/**
+ * @brief Актуальное значение из кэша по адресу Modbus.
+ *
+ * @param address Полный адрес регистра Modbus.
+ * @param value Указатель на переменную для значения.
+ * @return true, если значение есть и актуально, иначе false.
+ */
+bool RegisterCache::lookup(const uint16_t address, uint16_t* value) const {
+    const uint16_t position = index(address);
+    if (position == NO_INDEX || value == nullptr || !isFresh(position)) {
+        return false;
+    }
+    *value = _values[position];
+    return true;
+}
+
+/**
+ * @brief Сохранение значений, прочитанных или записанных в обход кэша.
+ *
+ * @param address Адрес первого регистра Modbus.
+ * @param values Значения.
+ * @param count Количество регистров.
+ */
+void RegisterCache::fill(const uint16_t address, const uint16_t* values, const size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        const uint16_t position = index(static_cast<uint16_t>(address + i));
+        if (position != NO_INDEX) {
+            store(position, &values[i], 1);
+        }
+    }
+}
+
+/**
+ * @brief Сохранение значений, записанных в частотник в обход кэша.
+ *
+ * Флаг ожидающей записи снимается, после чего значение сохраняется как прочитанное.
+ *
+ * @param address Адрес первого регистра Modbus.
+ * @param values Записанные значения.
+ * @param count Количество регистров.
+ */
+void RegisterCache::replace(const uint16_t address, const uint16_t* values, const size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        const uint16_t position = index(static_cast<uint16_t>(address + i));
+        if (position != NO_INDEX) {
+            _flags[position] &= static_cast<uint8_t>(~FLAG_DIRTY);
+            store(position, &values[i], 1);
+        }
+    }
+}
+
+/**
+ * @brief Проверяет, есть ли в кэше значение параметра.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @return true, если значение загружено или ожидает записи, иначе false.
+ */
+bool RegisterCache::isValid(const GroupsParameter group, const uint8_t numberGroup) const {
+    const uint16_t position = index(group, numberGroup);
+    return position != NO_INDEX && (_flags[position] & FLAG_VALID);
+}
+
+/**
+ * @brief Проверяет, ожидает ли параметр записи.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @return true, если значение ожидает записи, иначе false.
+ */
+bool RegisterCache::isDirty(const GroupsParameter group, const uint8_t numberGroup) const {
+    const uint16_t position = index(group, numberGroup);
+    return position != NO_INDEX && (_flags[position] & FLAG_DIRTY);
+}
+
+/**
+ * @brief Возраст значения параметра мониторинга.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @return Время с момента чтения в миллисекундах, 0 для групп F, ULONG_MAX, если значения нет.
+ */
+unsigned long RegisterCache::age(const GroupsParameter group, const uint8_t numberGroup) const {
+    const uint16_t position = index(group, numberGroup);
+    if (position == NO_INDEX || !(_flags[position] & FLAG_VALID)) {
+        return ULONG_MAX;
+    }
+    if (position < VOLATILE_FIRST) {
+        return 0;
+    }
+    return millis() - _stamps[position - VOLATILE_FIRST];
+}
+
+/**
+ * @brief Сброс значения одного параметра.
+ *
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ */
+void RegisterCache::invalidate(const GroupsParameter group, const uint8_t numberGroup) {
+    const uint16_t position = index(group, numberGroup);
+    if (position != NO_INDEX) {
+        _flags[position] = 0;
+    }
+}
+
+/**
+ * @brief Сброс всего кэша.
+ */
+void RegisterCache::invalidate() {
+    for (uint16_t i = 0; i < REGISTER_COUNT; i++) {
+        _flags[i] = 0;
+    }
+}
+
+/**
+ * @brief Количество регистров, ожидающих записи.
+ *
+ * @return Количество грязных регистров.
+ */
+size_t RegisterCache::dirtyCount() const {
+    size_t count = 0;
+    for (uint16_t i = 0; i < REGISTER_COUNT; i++) {
+        if (_flags[i] & FLAG_DIRTY) {
+            count++;
+        }
+    }
+    return count;
+}
+
+#endif // HS321_ENABLE_CACHE
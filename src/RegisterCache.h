@@ -0,0 +1,240 @@
+#pragma once
+
+/** @file RegisterCache.h
+ * @brief Зеркало регистров частотника HS321 в ОЗУ с отложенной записью.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "HS321.h"
+
+#if !HS321_ENABLE_CACHE
+#error "Зеркало регистров отключено (HS321_ENABLE_CACHE = 0)"
+#endif
+
+/**
+ * @class RegisterCache
+ * @brief Кэш параметров одного частотника с чтением при промахе и отложенной записью.
+ *
+ * Хранит по одному значению на каждый адрес групп F0..FP и d (размеры групп — groupSizes[]).
+ * Параметры настройки (группы F) меняются только при записи, поэтому остаются действительными
+ * до записи или явного сброса. Параметры мониторинга (группа d) помечены как изменчивые:
+ * значение старше заданного TTL перечитывается с частотника.
+ *
+ * Запись только обновляет кэш и помечает регистр «грязным»; повторные записи одного регистра
+ * схлопываются. flush() передаёт смежные грязные регистры одной группы одним кадром 0x10.
+ *
+ * Занимает около 3 байт ОЗУ на адрес (примерно 1 КБ на все группы).
+ */
+class RegisterCache {
+public:
+    /**
+     * @var REGISTER_COUNT
+     * @brief Общее количество адресов во всех группах.
+     */
+    static constexpr uint16_t REGISTER_COUNT = groupOffset(GROUP_COUNT);
+
+    /**
+     * @brief Конструктор класса.
+     * @param drive Частотник, регистры которого кэшируются.
+     * @param volatileTtl Время актуальности параметров мониторинга (группа d) в миллисекундах.
+     */
+    explicit RegisterCache(HS321& drive, unsigned long volatileTtl = 500);
+
+    /**
+     * @brief Чтение параметра через кэш.
+     *
+     * Возвращает значение из кэша, если оно действительно (для группы d — не старше TTL)
+     * или ожидает записи; иначе читает регистр с частотника и сохраняет в кэше.
+     *
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @param value Указатель на переменную для значения.
+     * @return true при успехе, иначе false.
+     */
+    bool read(GroupsParameter group, uint8_t numberGroup, uint16_t* value);
+
+    /**
+     * @brief Загрузка диапазона параметров группы в кэш одним кадром 0x03.
+     * @param group Группа параметров.
+     * @param numberGroup Номер первого параметра.
+     * @param count Количество параметров.
+     * @return true при успехе, иначе false.
+     */
+    bool load(GroupsParameter group, uint8_t numberGroup, size_t count);
+
+    /**
+     * @brief Отложенная запись параметра.
+     *
+     * Значение сохраняется в кэше и передаётся частотнику при следующем flush().
+     *
+     * @param group Группа параметра (кроме группы мониторинга d).
+     * @param numberGroup Номер параметра в группе.
+     * @param value Значение для записи.
+     * @return true, если значение принято, иначе false (неверный адрес, группа d).
+     */
+    bool write(GroupsParameter group, uint8_t numberGroup, uint16_t value);
+
+    /**
+     * @brief Передача всех грязных регистров частотнику.
+     *
+     * Смежные грязные регистры одной группы передаются одним кадром 0x10 (не более ModbusBus::MAX_WRITE_REGISTERS регистров),
+     * одиночные — кадром 0x06.
+     *
+     * @return true, если все регистры записаны, иначе false (неудачные остаются грязными).
+     */
+    bool flush();
+
+    /**
+     * @brief Значение из кэша без обращения к шине.
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @param value Указатель на переменную для значения.
+     * @return true, если в кэше есть значение, иначе false.
+     */
+    bool peek(GroupsParameter group, uint8_t numberGroup, uint16_t* value) const;
+
+    /**
+     * @brief Актуальное значение из кэша по адресу Modbus без обращения к шине.
+     *
+     * В отличие от peek() устаревшие параметры мониторинга (старше TTL) не возвращаются.
+     *
+     * @param address Полный адрес регистра Modbus.
+     * @param value Указатель на переменную для значения.
+     * @return true, если значение есть и актуально (или ожидает записи), иначе false.
+     */
+    bool lookup(uint16_t address, uint16_t* value) const;
+
+    /**
+     * @brief Сохранение значений, прочитанных или записанных в обход кэша.
+     *
+     * Используется асинхронными клиентами шины (например, ModbusGateway), которые сами
+     * выполняют транзакции. Адреса вне групп параметров и грязные регистры пропускаются.
+     *
+     * @param address Адрес первого регистра Modbus.
+     * @param values Значения.
+     * @param count Количество регистров.
+     */
+    void fill(uint16_t address, const uint16_t* values, size_t count);
+
+    /**
+     * @brief Сохранение значений, записанных в частотник в обход кэша.
+     *
+     * В отличие от fill() заменяет и грязные регистры: частотник уже хранит записанное
+     * значение, поэтому ожидающая запись этих регистров отменяется и flush() его не затрёт.
+     *
+     * @param address Адрес первого регистра Modbus.
+     * @param values Записанные значения.
+     * @param count Количество регистров.
+     */
+    void replace(uint16_t address, const uint16_t* values, size_t count);
+
+    /**
+     * @brief Проверяет, есть ли в кэше значение параметра.
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @return true, если значение загружено или ожидает записи, иначе false.
+     */
+    bool isValid(GroupsParameter group, uint8_t numberGroup) const;
+
+    /**
+     * @brief Проверяет, ожидает ли параметр записи.
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @return true, если значение изменено и ещё не передано частотнику, иначе false.
+     */
+    bool isDirty(GroupsParameter group, uint8_t numberGroup) const;
+
+    /**
+     * @brief Возраст значения параметра мониторинга.
+     *
+     * Возраст отслеживается только для группы d; параметры настройки не устаревают.
+     *
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @return Время с момента чтения в миллисекундах, 0 для групп F, ULONG_MAX, если значения нет.
+     */
+    unsigned long age(GroupsParameter group, uint8_t numberGroup) const;
+
+    /**
+     * @brief Сброс значения одного параметра (грязное значение также отбрасывается).
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     */
+    void invalidate(GroupsParameter group, uint8_t numberGroup);
+
+    /**
+     * @brief Сброс всего кэша (все грязные значения отбрасываются).
+     */
+    void invalidate();
+
+    /**
+     * @brief Количество регистров, ожидающих записи.
+     * @return Количество грязных регистров.
+     */
+    size_t dirtyCount() const;
+
+    /**
+     * @brief Установка времени актуальности параметров мониторинга.
+     * @param volatileTtl Время в миллисекундах.
+     */
+    void setVolatileTtl(unsigned long volatileTtl) { _volatileTtl = volatileTtl; }
+
+private:
+    /**
+     * @var NO_INDEX
+     * @brief Признак адреса вне групп параметров.
+     */
+    static constexpr uint16_t NO_INDEX = 0xFFFF;
+
+    /**
+     * @var VOLATILE_FIRST
+     * @brief Индекс первого регистра группы d в плоском массиве.
+     */
+    static constexpr uint16_t VOLATILE_FIRST = groupOffset(GROUP_COUNT - 1);
+
+    /**
+     * @var VOLATILE_COUNT
+     * @brief Количество регистров группы d.
+     */
+    static constexpr uint8_t VOLATILE_COUNT = groupSizes[GROUP_COUNT - 1];
+
+    static constexpr uint8_t FLAG_VALID = 0x01; ///< Значение загружено с частотника или записано
+    static constexpr uint8_t FLAG_DIRTY = 0x02; ///< Значение ожидает записи
+
+    HS321* _drive;                            ///< Частотник, регистры которого кэшируются
+    unsigned long _volatileTtl;               ///< Время актуальности параметров мониторинга (мс)
+    uint16_t _values[REGISTER_COUNT];         ///< Значения регистров, сгруппированные по группам
+    uint8_t _flags[REGISTER_COUNT];           ///< Флаги FLAG_VALID/FLAG_DIRTY
+    unsigned long _stamps[VOLATILE_COUNT];    ///< Время чтения параметров мониторинга (мс)
+
+    /**
+     * @brief Индекс регистра в плоском массиве.
+     * @param group Группа параметра.
+     * @param numberGroup Номер параметра в группе.
+     * @return Индекс или NO_INDEX, если номер вне группы.
+     */
+    static uint16_t index(GroupsParameter group, uint8_t numberGroup);
+
+    /**
+     * @brief Индекс регистра в плоском массиве по адресу Modbus.
+     * @param address Полный адрес регистра.
+     * @return Индекс или NO_INDEX, если адрес вне групп параметров.
+     */
+    static uint16_t index(uint16_t address);
+
+    /**
+     * @brief Проверяет, можно ли вернуть значение регистра без чтения с частотника.
+     * @param index Индекс регистра.
+     * @return true, если значение действительно и не устарело.
+     */
+    bool isFresh(uint16_t index) const;
+
+    /**
+     * @brief Сохранение прочитанных значений с отметкой времени.
+     * @param first Индекс первого регистра.
+     * @param values Прочитанные значения.
+     * @param count Количество регистров.
+     */
+    void store(uint16_t first, const uint16_t* values, size_t count);
+};
@@ -0,0 +1,191 @@
+#include "SetpointStreamer.h"
+
+/** @file SetpointStreamer.cpp
+ * @brief Реализация потоковой передачи задания частоты частотнику HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+/**
+ * @brief Конструктор класса SetpointStreamer.
+ *
+ * @param drive Частотник, которому передаётся задание.
+ * @param resolution Разрешение задания в единицах 0.01 %.
+ */
+SetpointStreamer::SetpointStreamer(HS321& drive, const uint16_t resolution)
+                                                                :_drive(&drive),
+                                                                _resolution(resolution){
+    _stats.startedAt = millis();
+}
+
+/**
+ * @brief Установка нового задания.
+ *
+ * Значение, ещё не переданное частотнику, заменяется новым.
+ *
+ * @param setpoint Задание в единицах 0.01 % от максимальной частоты.
+ */
+void SetpointStreamer::set(int16_t setpoint) {
+    if (setpoint > SETPOINT_LIMIT) {
+        setpoint = SETPOINT_LIMIT;
+    } else if (setpoint < -SETPOINT_LIMIT) {
+        setpoint = -SETPOINT_LIMIT;
+    }
+    _stats.requested++;
+    if (_setpointPending) {
+        _stats.overwritten++;
+    }
+    _latest = setpoint;
+    _latestAt = micros();
+    _setpointPending = true;
+}
+
+/**
+ * @brief Установка нового задания частоты.
+ *
+ * Частота приводится к количеству знаков после запятой максимальной частоты и
+ * пересчитывается в единицы 0.01 % от неё.
+ *
+ * @param frequency Частота задания.
+ * @param maxFrequency Максимальная частота F0.08.
+ * @return true, если задание установлено, иначе false.
+ */
+bool SetpointStreamer::setFrequency(const ScaledValue& frequency, const ScaledValue& maxFrequency) {
+    if (maxFrequency.value <= 0) {
+        return false;
+    }
+    const long value = frequency.rescale(maxFrequency.decimals).value;
+    long setpoint = value * SETPOINT_LIMIT / maxFrequency.value;
+    if (setpoint > SETPOINT_LIMIT) {
+        setpoint = SETPOINT_LIMIT;
+    } else if (setpoint < -SETPOINT_LIMIT) {
+        setpoint = -SETPOINT_LIMIT;
+    }
+    set(static_cast<int16_t>(setpoint));
+    return true;
+}
+
+/**
+ * @brief Передача команды управления раньше ожидающего задания.
+ *
+ * @param command Команда управления.
+ */
+void SetpointStreamer::command(const ControlCommand command) {
+    _command = command;
+    _commandPending = true;
+}
+
+/**
+ * @brief Продвижение передачи.
+ *
+ * Продвигает шину, учитывает завершённые кадры, ставит в очередь ожидающую команду,
+ * а за ней, если кадр задания свободен, — самое новое задание.
+ */
+void SetpointStreamer::poll() {
+    _drive->bus()->poll();
+    collect();
+
+    // Команда не ждёт задания и не подавляется: URGENT, как в HS321
+    if (_commandPending && _commandFrame.status != TransactionStatus::PENDING) {
+        sendCommand();
+    }
+    if (_setpointPending && _setpointFrame.status != TransactionStatus::PENDING) {
+        const int32_t delta = static_cast<int32_t>(_latest) - _confirmed;
+        if (_hasConfirmed && (delta < 0 ? -delta : delta) <= _resolution) {
+            _stats.suppressed++;
+            _setpointPending = false;
+        } else if (millis() - _lastFrame >= _minInterval) {
+            sendSetpoint();
+        }
+    }
+}
+
+/**
+ * @brief Учёт завершённых кадров.
+ *
+ * Неудачное задание снова ставится на передачу, если за время кадра не появилось
+ * более нового значения.
+ */
+void SetpointStreamer::collect() {
+    const TransactionStatus setpointStatus = _setpointFrame.status;
+    if (setpointStatus == TransactionStatus::COMPLETED) {
+        _setpointFrame.status = TransactionStatus::IDLE;
+        _confirmed = _inFlight;
+        _hasConfirmed = true;
+        const unsigned long latency = micros() - _inFlightAt;
+        if (_stats.updates == 0 || latency < _stats.minLatency) {
+            _stats.minLatency = latency;
+        }
+        if (latency > _stats.maxLatency) {
+            _stats.maxLatency = latency;
+        }
+        _stats.totalLatency += latency;
+        _stats.updates++;
+    } else if (setpointStatus == TransactionStatus::FAILED || setpointStatus == TransactionStatus::EXCEPTION) {
+        _setpointFrame.status = TransactionStatus::IDLE;
+        _stats.failed++;
+        _setpointPending = true;
+    }
+
+    const TransactionStatus commandStatus = _commandFrame.status;
+    if (commandStatus == TransactionStatus::COMPLETED) {
+        _commandFrame.status = TransactionStatus::IDLE;
+        _stats.commands++;
+    } else if (commandStatus == TransactionStatus::FAILED || commandStatus == TransactionStatus::EXCEPTION) {
+        _commandFrame.status = TransactionStatus::IDLE;
+        _stats.failed++;
+    }
+}
+
+/**
+ * @brief Постановка кадра задания в очередь шины.
+ *
+ * @return true, если кадр поставлен, иначе false (очередь шины заполнена).
+ */
+bool SetpointStreamer::sendSetpoint() {
+    _setpointFrame.setWriteSingle(_drive->slaveAddress(), 0x1000, static_cast<uint16_t>(_latest));
+    _setpointFrame.priority = _priority;
+    _drive->attachStats(_setpointFrame);
+    if (!_drive->bus()->submit(_setpointFrame)) {
+        return false;
+    }
+    _inFlight = _latest;
+    _inFlightAt = _latestAt;
+    _lastFrame = millis();
+    _setpointPending = false;
+    return true;
+}
+
+/**
+ * @brief Постановка кадра команды в очередь шины с приоритетом URGENT.
+ *
+ * @return true, если кадр поставлен, иначе false (очередь шины заполнена).
+ */
+bool SetpointStreamer::sendCommand() {
+    _commandFrame.setWriteSingle(_drive->slaveAddress(), 0x2000, static_cast<uint16_t>(_command));
+    _commandFrame.priority = TransactionPriority::URGENT;
+    _drive->attachStats(_commandFrame);
+    if (!_drive->bus()->submit(_commandFrame)) {
+        return false;
+    }
+    _commandPending = false;
+    return true;
+}
+
+/**
+ * @brief Достигнутая частота обновления задания с момента resetStats().
+ *
+ * @return Подтверждённых заданий в секунду.
+ */
+unsigned long SetpointStreamer::updateRate() const {
+    const unsigned long elapsed = millis() - _stats.startedAt;
+    return elapsed ? _stats.updates * 1000UL / elapsed : 0;
+}
+
+/**
+ * @brief Сброс счётчиков и начало нового интервала измерения частоты обновления.
+ */
+void SetpointStreamer::resetStats() {
+    _stats = StreamerStats();
+    _stats.startedAt = millis();
+}
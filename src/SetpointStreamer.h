@@ -0,0 +1,204 @@
+#pragma once
+
+/** @file SetpointStreamer.h
+ * @brief Потоковая передача задания частоты частотнику HS321 с подавлением повторов.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "HS321.h"
+
+/**
+ * @struct StreamerStats
+ * @brief Счётчики потоковой передачи задания.
+ */
+struct StreamerStats {
+    unsigned long requested = 0;     ///< Вызовов set() и setFrequency()
+    unsigned long updates = 0;       ///< Заданий, подтверждённых частотником
+    unsigned long overwritten = 0;   ///< Заданий, заменённых более новыми до передачи
+    unsigned long suppressed = 0;    ///< Заданий, не переданных из-за отличия не больше разрешения
+    unsigned long commands = 0;      ///< Команд управления, подтверждённых частотником
+    unsigned long failed = 0;        ///< Кадров, завершившихся ошибкой
+    unsigned long minLatency = 0;    ///< Минимальная задержка от set() до подтверждения (мкс)
+    unsigned long maxLatency = 0;    ///< Максимальная задержка от set() до подтверждения (мкс)
+    unsigned long totalLatency = 0;  ///< Суммарная задержка подтверждённых заданий (мкс)
+    unsigned long startedAt = 0;     ///< Время начала сбора счётчиков (мс, millis())
+
+    /**
+     * @brief Средняя задержка от set() до подтверждения частотником.
+     * @return Задержка (мкс) или 0, если подтверждённых заданий нет.
+     */
+    unsigned long averageLatency() const { return updates ? totalLatency / updates : 0; }
+};
+
+/**
+ * @class SetpointStreamer
+ * @brief Передача часто меняющегося задания (регистр 0x1000) с наименьшей задержкой.
+ *
+ * Задание хранится в одной ячейке: новое значение, поставленное до передачи предыдущего,
+ * заменяет его, поэтому в очередь шины никогда не попадают устаревшие задания. На линии
+ * находится не больше одного кадра задания, и частота обновления сама ограничивается
+ * пропускной способностью шины; setMinInterval() дополнительно ограничивает её, оставляя
+ * время для остального опроса.
+ *
+ * Значение, отличающееся от последнего подтверждённого частотником не больше чем на
+ * разрешение (setResolution()), не передаётся; повторное одинаковое задание не передаётся
+ * никогда. Небольшие изменения накапливаются относительно подтверждённого значения,
+ * поэтому медленный дрейф задания всё же передаётся.
+ *
+ * Команда управления (command()) не ждёт задания: она ставится в очередь шины при ближайшем
+ * poll() с приоритетом URGENT, как в HS321, без подавления и ограничения частоты, поэтому
+ * STOP не задерживается ожидающим заданием. Самое новое задание передаётся следующим
+ * кадром после неё: регистры 0x1000 и 0x2000 не смежные, поэтому одним кадром 0x10 их
+ * записать нельзя.
+ *
+ * Регистр 0x1000 принимает −10000..10000, что соответствует −100.00..100.00 % от
+ * максимальной частоты F0.08.
+ */
+class SetpointStreamer {
+public:
+    /**
+     * @var SETPOINT_LIMIT
+     * @brief Наибольшее по модулю значение задания (100.00 %).
+     */
+    static constexpr int16_t SETPOINT_LIMIT = 10000;
+
+    /**
+     * @brief Конструктор класса.
+     * @param drive Частотник, которому передаётся задание.
+     * @param resolution Разрешение задания в единицах 0.01 % (0 — подавляются только повторы).
+     */
+    explicit SetpointStreamer(HS321& drive, uint16_t resolution = 0);
+
+    /**
+     * @brief Установка нового задания.
+     *
+     * Значение вне −10000..10000 ограничивается. Передача выполняется в poll().
+     *
+     * @param setpoint Задание в единицах 0.01 % от максимальной частоты.
+     */
+    void set(int16_t setpoint);
+
+    /**
+     * @brief Установка нового задания частоты.
+     * @param frequency Частота задания (например, ScaledValue(2500, 2) — 25.00 Гц).
+     * @param maxFrequency Максимальная частота F0.08 в тех же единицах измерения.
+     * @return true, если задание установлено, иначе false (maxFrequency не больше нуля).
+     */
+    bool setFrequency(const ScaledValue& frequency, const ScaledValue& maxFrequency);
+
+    /**
+     * @brief Передача команды управления раньше ожидающего задания.
+     *
+     * Команда передаётся в ближайшем poll() с приоритетом URGENT. Новая команда,
+     * поставленная до передачи предыдущей, заменяет её.
+     *
+     * @param command Команда управления (см. ControlCommand).
+     */
+    void command(ControlCommand command);
+
+    /**
+     * @brief Продвижение передачи.
+     *
+     * Должен вызываться из loop() как можно чаще. Никогда не ожидает ответа.
+     */
+    void poll();
+
+    /**
+     * @brief Установка разрешения задания.
+     * @param resolution Разрешение в единицах 0.01 % (0 — подавляются только повторы).
+     */
+    void setResolution(uint16_t resolution) { _resolution = resolution; }
+
+    /**
+     * @brief Установка наименьшего интервала между кадрами задания.
+     * @param interval Интервал (мс, 0 — ограничение только пропускной способностью шины).
+     */
+    void setMinInterval(unsigned long interval) { _minInterval = interval; }
+
+    /**
+     * @brief Установка приоритета кадров в очереди шины.
+     * @param priority Приоритет кадров задания (по умолчанию NORMAL — поток не вытесняет
+     *                 остальной опрос); команды всегда передаются с приоритетом URGENT.
+     */
+    void setPriority(TransactionPriority priority) { _priority = priority; }
+
+    /**
+     * @brief Последнее заданное значение.
+     * @return Задание в единицах 0.01 %.
+     */
+    int16_t setpoint() const { return _latest; }
+
+    /**
+     * @brief Последнее значение, подтверждённое частотником.
+     * @return Задание в единицах 0.01 % (0, если задание ещё не передавалось).
+     */
+    int16_t confirmed() const { return _confirmed; }
+
+    /**
+     * @brief Проверяет, передано ли последнее задание и команда.
+     * @return true, если нет ожидающих передачи задания и команды и кадров на шине, иначе false.
+     */
+    bool isSettled() const { return !_setpointPending && !_commandPending && !isBusy(); }
+
+    /**
+     * @brief Счётчики передачи.
+     * @return Ссылка на счётчики.
+     */
+    const StreamerStats& stats() const { return _stats; }
+
+    /**
+     * @brief Достигнутая частота обновления задания с момента resetStats().
+     * @return Подтверждённых заданий в секунду.
+     */
+    unsigned long updateRate() const;
+
+    /**
+     * @brief Сброс счётчиков и начало нового интервала измерения частоты обновления.
+     */
+    void resetStats();
+
+private:
+    HS321* _drive;                          ///< Частотник
+    uint16_t _resolution;                   ///< Разрешение задания (0.01 %)
+    unsigned long _minInterval = 0;         ///< Наименьший интервал между кадрами задания (мс)
+    TransactionPriority _priority = TransactionPriority::NORMAL; ///< Приоритет кадров
+    int16_t _latest = 0;                    ///< Последнее заданное значение
+    unsigned long _latestAt = 0;            ///< Время установки последнего значения (мкс, micros())
+    bool _setpointPending = false;          ///< Последнее значение ещё не передано
+    int16_t _confirmed = 0;                 ///< Последнее подтверждённое значение
+    bool _hasConfirmed = false;             ///< Хотя бы одно значение подтверждено
+    ControlCommand _command = DECELERATE_STOP_COMMAND; ///< Ожидающая команда
+    bool _commandPending = false;           ///< Команда ожидает передачи
+    ModbusTransaction _setpointFrame;       ///< Кадр задания 0x1000
+    int16_t _inFlight = 0;                  ///< Значение в кадре задания
+    unsigned long _inFlightAt = 0;          ///< Время установки значения в кадре задания (мкс)
+    unsigned long _lastFrame = 0;           ///< Время постановки последнего кадра задания (мс)
+    ModbusTransaction _commandFrame;        ///< Кадр команды 0x2000
+    StreamerStats _stats;                   ///< Счётчики передачи
+
+    /**
+     * @brief Проверяет, выполняются ли кадры задания или команды.
+     * @return true, если кадр стоит в очереди шины или выполняется, иначе false.
+     */
+    bool isBusy() const {
+        return _setpointFrame.status == TransactionStatus::PENDING || _commandFrame.status == TransactionStatus::PENDING;
+    }
+
+    /**
+     * @brief Учёт завершённых кадров.
+     */
+    void collect();
+
+    /**
+     * @brief Постановка кадра задания в очередь шины.
+     * @return true, если кадр поставлен, иначе false.
+     */
+    bool sendSetpoint();
+
+    /**
+     * @brief Постановка кадра команды в очередь шины с приоритетом URGENT.
+     * @return true, если кадр поставлен, иначе false.
+     */
+    bool sendCommand();
+};
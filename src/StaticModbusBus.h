@@ -0,0 +1,134 @@
+#pragma once
+
+/** @file StaticModbusBus.h
+ * @brief Шина Modbus RTU с портом, пином DE/RE и скоростью, заданными при компиляции.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "ModbusBus.h"
+
+#if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+/**
+ * @brief Адрес регистра PORTx ATmega1280/2560 в пространстве памяти.
+ * @param letter Буква порта (A–L без I).
+ * @return Адрес регистра: PORTA–PORTG в области ввода-вывода, PORTH–PORTL — выше неё.
+ */
+constexpr uintptr_t megaPortAddress(const char letter) {
+    return (letter <= 'G') ? 0x22 + 3 * (letter - 'A') : 0x102 + 3 * ((letter == 'H') ? 0 : letter - 'I');
+}
+#endif
+
+/**
+ * @struct DirectionPin
+ * @brief Регистр PORTx и бит пина Arduino, известные при компиляции.
+ *
+ * Для ATmega48/88/168/328 (Uno, Nano, Pro Mini) и ATmega1280/2560 (Mega) содержит адрес
+ * регистра PORTx в пространстве памяти и номер бита, поэтому begin() не ищет их по таблицам
+ * ядра. Для остальных плат known == false, и регистр определяется в begin().
+ *
+ * @tparam Pin Номер цифрового пина Arduino.
+ */
+template <uint8_t Pin>
+struct DirectionPin {
+#if defined(__AVR_ATmega48__) || defined(__AVR_ATmega48P__) || defined(__AVR_ATmega88__) || defined(__AVR_ATmega88P__) \
+ || defined(__AVR_ATmega168__) || defined(__AVR_ATmega168P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega328P__)
+    static constexpr bool mapped = true;                                                  ///< Отображение пинов платы известно
+    // D0–D7 — PORTD, D8–D13 — PORTB, A0–A5 (D14–D19) — PORTC
+    static constexpr bool known = Pin < 20;                                               ///< Регистр пина известен
+    static constexpr uintptr_t port = (Pin < 8) ? 0x2B : (Pin < 14) ? 0x25 : 0x28;        ///< Адрес PORTD, PORTB или PORTC
+    static constexpr uint8_t bit = (Pin < 8) ? Pin : (Pin < 14) ? Pin - 8 : Pin - 14;     ///< Номер бита в регистре
+#elif defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+    static constexpr bool mapped = true;                                                  ///< Отображение пинов платы известно
+    // Порт и бит D0–D69 по таблицам digital_pin_to_port_PGM и digital_pin_to_bit_mask_PGM ядра Mega
+    static constexpr bool known = Pin < 70;                                               ///< Регистр пина известен
+    static constexpr uintptr_t port = known ? megaPortAddress(
+        "EEEEGEHHHHBBBBJJHHDDDDAAAAAAAACCCCCCCCDGGGLLLLLLLLBBBBFFFFFFFFKKKKKKKK"[Pin]) : 0;  ///< Адрес PORTx
+    static constexpr uint8_t bit = known
+        ? "0145533456456710103210012345677654321072107654321032100123456701234567"[Pin] - '0' : 0; ///< Номер бита в регистре
+#else
+    static constexpr bool mapped = false;                                                 ///< Отображение пинов платы неизвестно
+    static constexpr bool known = false;                                                  ///< Регистр пина неизвестен
+    static constexpr uintptr_t port = 0;                                                  ///< Адрес регистра (не используется)
+    static constexpr uint8_t bit = 0;                                                     ///< Номер бита (не используется)
+#endif
+};
+
+/**
+ * @class StaticModbusBus
+ * @brief Ведущий шины Modbus RTU с конфигурацией, заданной параметрами шаблона.
+ *
+ * Порт, пин DE/RE и скорость известны при компиляции, поэтому тайм-ауты вычисляются
+ * компилятором (FRAME_GAP, CHARACTER_TIME) и передаются шине без деления во время работы,
+ * недопустимая скорость или пин отвергаются при сборке, а на платах с известным отображением
+ * пинов (см. DirectionPin) регистр PORTx пина DE/RE не ищется по таблицам ядра. Трансивер
+ * переключается встроенной записью в регистр (ModbusBus::setTransmitMode()) без вызова функции.
+ * Отладочный порт необязателен: без него отладочный вывод пропускается.
+ *
+ * Скорость не меняется во время работы: setBaud() недоступна, а HS321::switchBaudRate()
+ * и HS321::detectBaudRate() на такой шине отклоняют другую скорость.
+ *
+ * Шина полностью совместима с ModbusBus: к ней так же подключаются частотники HS321
+ * и остальные компоненты библиотеки. ModbusBus остаётся для случаев, когда конфигурация
+ * определяется во время работы.
+ *
+ * @code
+ * StaticModbusBus<Serial1, 2, 9600> bus;
+ * HS321 hs321(0x01, bus);
+ * @endcode
+ *
+ * @tparam Port Последовательный порт связи с частотниками.
+ * @tparam DePin Номер цифрового пина управления направлением RS485 (DE/RE).
+ * @tparam Baud Скорость передачи данных.
+ */
+template <HardwareSerial& Port, uint8_t DePin, unsigned long Baud>
+class StaticModbusBus : public ModbusBus {
+    static_assert(Baud >= 1200 && Baud <= 115200, "Baud must be between 1200 and 115200");
+#ifdef NUM_DIGITAL_PINS
+    static_assert(DePin < NUM_DIGITAL_PINS, "DePin is not a digital pin of this board");
+#endif
+    static_assert(!DirectionPin<DePin>::mapped || DirectionPin<DePin>::known, "DePin has no PORTx register on this MCU");
+
+public:
+    /**
+     * @var FRAME_GAP
+     * @brief Пауза t3.5 между кадрами (мкс).
+     */
+    static constexpr unsigned long FRAME_GAP = modbusFrameGap(Baud);
+
+    /**
+     * @var CHARACTER_TIME
+     * @brief Время передачи одного символа (мкс).
+     */
+    static constexpr unsigned long CHARACTER_TIME = modbusCharacterTime(Baud);
+
+    /**
+     * @brief Конструктор шины без отладочного вывода.
+     */
+    StaticModbusBus()
+                                                                :ModbusBus(Port, nullptr, Baud, DePin, config()){
+    }
+
+    /**
+     * @brief Конструктор шины с отладочным выводом.
+     * @param serialDebug Ссылка на объект HardwareSerial для вывода отладочной информации.
+     */
+    explicit StaticModbusBus(HardwareSerial& serialDebug)
+                                                                :ModbusBus(Port, &serialDebug, Baud, DePin, config()){
+    }
+
+    /**
+     * @brief Смена скорости недоступна: скорость задана параметром шаблона Baud.
+     */
+    bool setBaud(unsigned long baud) = delete;
+
+private:
+    /**
+     * @brief Параметры шины, вычисленные при компиляции.
+     * @return Тайм-ауты FRAME_GAP, CHARACTER_TIME и регистр пина DE/RE (0 — определяется в begin()).
+     */
+    static constexpr FixedBusConfig config() {
+        return FixedBusConfig{ FRAME_GAP, CHARACTER_TIME, DirectionPin<DePin>::port,
+                               static_cast<uint8_t>(1 << DirectionPin<DePin>::bit) };
+    }
+};
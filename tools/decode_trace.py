@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Decode a binary ModbusTrace dump (see src/ModbusTrace.h) into readable text.
+
+Usage:
+    decode_trace.py capture.bin
+    decode_trace.py < capture.bin
+    decode_trace.py --port /dev/ttyUSB0 --baud 115200   (requires pyserial)
+
+Each record is printed on one line: timestamp in microseconds, time since
+the previous record, direction, outcome and the frame bytes in hex.
+Bytes that do not start a valid record (a record truncated by buffer
+overflow while it was being streamed) are skipped up to the next marker.
+"""
+
+import argparse
+import sys
+
+MARKER = 0xA5
+RESPONSE = 0x80
+HEADER_SIZE = 7
+
+# TransactionError (src/ModbusBus.h), in declaration order
+ERRORS = [
+    "NONE", "NOT_INITIALIZED", "INVALID_REQUEST", "QUEUE_FULL", "TIMEOUT",
+    "INCOMPLETE_FRAME", "CRC", "WRONG_SLAVE", "WRONG_FUNCTION", "WRONG_LENGTH",
+    "EXCEPTION", "OUT_OF_RANGE", "SLAVE_OFFLINE", "VERIFY_MISMATCH",
+]
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0xA001 if crc & 1 else crc >> 1
+    return crc
+
+
+def records(data):
+    """Yield (flags, timestamp, frame) tuples, resynchronising on MARKER."""
+    position = 0
+    while position + HEADER_SIZE <= len(data):
+        if data[position] != MARKER:
+            position += 1
+            continue
+        length = data[position + 6]
+        end = position + HEADER_SIZE + length
+        if end > len(data):
+            break
+        # A record is only accepted if it ends at a marker or at the end of the data
+        if end < len(data) and data[end] != MARKER:
+            position += 1
+            continue
+        flags = data[position + 1]
+        timestamp = int.from_bytes(data[position + 2:position + 6], "big")
+        yield flags, timestamp, bytes(data[position + HEADER_SIZE:end])
+        position = end
+
+
+def describe(flags, frame):
+    if not flags & RESPONSE:
+        return "TX", ""
+    code = flags & 0x7F
+    outcome = ERRORS[code] if code < len(ERRORS) else "ERROR_%d" % code
+    if outcome == "EXCEPTION" and len(frame) >= 3:
+        outcome += " 0x%02X" % frame[2]
+    return "RX", outcome
+
+
+def decode(data, out):
+    previous = None
+    for flags, timestamp, frame in records(data):
+        delta = "" if previous is None else "+%d" % ((timestamp - previous) & 0xFFFFFFFF)
+        previous = timestamp
+        direction, outcome = describe(flags, frame)
+        crc = ""
+        if len(frame) >= 4 and crc16(frame) != 0:
+            crc = " (bad CRC)"
+        line = "%10d %9s %s %-16s %s%s" % (timestamp, delta, direction, outcome,
+                                          " ".join("%02X" % b for b in frame), crc)
+        out.write(line.rstrip() + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("file", nargs="?", help="binary dump (default: stdin)")
+    parser.add_argument("--port", help="read the stream from a serial port instead")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--seconds", type=float, default=10.0, help="serial capture duration")
+    args = parser.parse_args()
+
+    if args.port:
+        import time
+        import serial
+        data = bytearray()
+        with serial.Serial(args.port, args.baud, timeout=0.1) as port:
+            deadline = time.time() + args.seconds
+            while time.time() < deadline:
+                data += port.read(4096)
+    elif args.file:
+        with open(args.file, "rb") as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+    decode(data, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,246 @@
+#include "Arduino.h"
+
+#include <stdio.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+/** @file Arduino.cpp
+ * @brief Реализация имитации ядра Arduino: виртуальное время, пины, Print и HardwareSerial.
+ *
+ * @author Dmitry Chernikov
+ */
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
+HardwareSerial Serial2;
+HardwareSerial Serial3;
+
+namespace sim {
+    uint32_t clockStep = 1;
+
+    static uint64_t currentTime = 0;         ///< Виртуальное время (мкс)
+    static uint8_t pins[256];                ///< Уровни цифровых пинов
+
+    uint64_t now() { return currentTime; }
+
+    void advance(const uint64_t us) { currentTime += us; }
+
+    uint8_t pinLevel(const uint8_t pin) { return pins[pin]; }
+
+    uint64_t cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief Обращение программы ко времени: время продвигается на clockStep.
+     * @return Время (мкс).
+     */
+    static uint64_t tick() {
+        currentTime += clockStep;
+        return currentTime;
+    }
+}
+
+unsigned long millis() { return static_cast<unsigned long>(sim::tick() / 1000); }
+
+unsigned long micros() { return static_cast<unsigned long>(sim::tick()); }
+
+void delay(const unsigned long ms) { sim::advance(static_cast<uint64_t>(ms) * 1000); }
+
+void delayMicroseconds(const unsigned int us) { sim::advance(us); }
+
+void yield() {}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(const uint8_t pin, const uint8_t value) { sim::pins[pin] = value; }
+
+int digitalRead(const uint8_t pin) { return sim::pins[pin]; }
+
+/**
+ * @brief Вывод буфера побайтно.
+ *
+ * @param buffer Байты.
+ * @param size Количество байт.
+ * @return Количество выведенных байт.
+ */
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (size--) {
+        written += write(*buffer++);
+    }
+    return written;
+}
+
+/**
+ * @brief Вывод целого числа со знаком.
+ *
+ * @param value Число.
+ * @param base Основание системы счисления.
+ * @return Количество выведенных байт.
+ */
+size_t Print::print(const long value, const int base) {
+    if (base == DEC && value < 0) {
+        return print('-') + print(static_cast<unsigned long>(-(value + 1)) + 1, DEC);
+    }
+    return print(static_cast<unsigned long>(value), base);
+}
+
+/**
+ * @brief Вывод целого числа без знака.
+ *
+ * @param value Число.
+ * @param base Основание системы счисления (2..16).
+ * @return Количество выведенных байт.
+ */
+size_t Print::print(unsigned long value, int base) {
+    if (base < 2 || base > 16) {
+        base = DEC;
+    }
+    char text[8 * sizeof(unsigned long) + 1];
+    char* position = &text[sizeof(text) - 1];
+    *position = '\0';
+    do {
+        const unsigned digit = static_cast<unsigned>(value % base);
+        *--position = static_cast<char>(digit < 10 ? '0' + digit : 'A' + digit - 10);
+        value /= base;
+    } while (value != 0);
+    return write(position);
+}
+
+/**
+ * @brief Вывод числа с плавающей точкой.
+ *
+ * @param value Число.
+ * @param digits Количество знаков после точки.
+ * @return Количество выведенных байт.
+ */
+size_t Print::print(const double value, const int digits) {
+    char text[64];
+    snprintf(text, sizeof(text), "%.*f", digits, value);
+    return write(text);
+}
+
+/**
+ * @brief Настройка скорости порта.
+ *
+ * @param baud Скорость (бод).
+ */
+void HardwareSerial::begin(const unsigned long baud, uint8_t) {
+    // 10 бит на символ (8N1), с округлением вверх
+    _characterTime = (10000000ULL + baud - 1) / baud;
+}
+
+/**
+ * @brief Количество принятых байт, время поступления которых наступило.
+ *
+ * @return Количество доступных байт.
+ */
+int HardwareSerial::available() {
+    const uint64_t now = sim::now();
+    int count = 0;
+    for (const Incoming& incoming : _rx) {
+        if (incoming.time > now) {
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Чтение принятого байта.
+ *
+ * @return Байт или -1, если доступных байт нет.
+ */
+int HardwareSerial::read() {
+    if (_rx.empty() || _rx.front().time > sim::now()) {
+        return -1;
+    }
+    const uint8_t data = _rx.front().data;
+    _rx.pop_front();
+    bytesRead++;
+    return data;
+}
+
+/**
+ * @brief Просмотр принятого байта без извлечения.
+ *
+ * @return Байт или -1, если доступных байт нет.
+ */
+int HardwareSerial::peek() {
+    if (_rx.empty() || _rx.front().time > sim::now()) {
+        return -1;
+    }
+    return _rx.front().data;
+}
+
+/**
+ * @brief Свободное место в буфере передачи.
+ *
+ * Байты, ещё не вышедшие на линию, занимают буфер; один байт находится в сдвиговом регистре.
+ *
+ * @return Количество байт, которые можно записать без ожидания.
+ */
+int HardwareSerial::availableForWrite() {
+    const uint64_t now = sim::now();
+    if (_peers.empty() || _lineFree <= now) {
+        return TX_BUFFER_SIZE - 1;
+    }
+    const int pending = static_cast<int>((_lineFree - now + _characterTime - 1) / _characterTime) - 1;
+    return (pending >= TX_BUFFER_SIZE - 1) ? 0 : TX_BUFFER_SIZE - 1 - pending;
+}
+
+/**
+ * @brief Ожидание окончания передачи.
+ */
+void HardwareSerial::flush() {
+    if (_lineFree > sim::now()) {
+        sim::advance(_lineFree - sim::now());
+    }
+}
+
+/**
+ * @brief Передача байта.
+ *
+ * Если буфер передачи заполнен, ожидает освобождения места, как HardwareSerial ядра AVR.
+ *
+ * @param data Байт.
+ * @return 1.
+ */
+size_t HardwareSerial::write(const uint8_t data) {
+    if (_peers.empty()) {
+        if (echo) {
+            putchar(data);
+        }
+        return 1;
+    }
+    while (availableForWrite() == 0) {
+        sim::advance(_characterTime);
+    }
+    const uint64_t start = (_lineFree > sim::now()) ? _lineFree : sim::now();
+    _lineFree = start + _characterTime;
+    bytesWritten++;
+    for (SerialPeer* const peer : _peers) {
+        peer->receive(data, _lineFree);
+    }
+    return 1;
+}
+
+/**
+ * @brief Постановка байта в очередь приёма.
+ *
+ * @param data Байт.
+ * @param time Время поступления (мкс).
+ */
+void HardwareSerial::inject(const uint8_t data, const uint64_t time) {
+    _rx.push_back(Incoming{time, data});
+}
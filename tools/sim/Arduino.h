@@ -0,0 +1,224 @@
+#pragma once
+
+/** @file Arduino.h
+ * @brief Имитация ядра Arduino для сборки библиотеки на ПК (симулятор и бенчмарки).
+ *
+ * Содержит ровно то, что использует библиотека: типы и макросы PROGMEM, Print,
+ * HardwareSerial и функции времени и пинов. Время виртуальное (см. sim::now()):
+ * каждое обращение к micros()/millis() продвигает его на sim::clockStep мкс, имитируя
+ * время выполнения кода, поэтому циклы ожидания библиотеки завершаются детерминированно.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <deque>
+#include <vector>
+
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define SERIAL_8N1 0x06
+
+// Память программ на ПК — обычная память
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+// Приведения в стиле C, как у avr-libc: указатели на PROGMEM-данные передаются с любыми квалификаторами
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define pgm_read_ptr(p) (*(void* const*)(p))
+#define memcpy_P memcpy
+#define strcmp_P strcmp
+#define strlen_P strlen
+#define strncpy_P strncpy
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(PSTR(s)))
+
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+/**
+ * @namespace sim
+ * @brief Виртуальное время и состояние имитируемой платы.
+ */
+namespace sim {
+    extern uint32_t clockStep;               ///< Приращение времени при каждом обращении к micros()/millis() (мкс)
+
+    /**
+     * @brief Текущее виртуальное время без его продвижения.
+     * @return Время с начала имитации (мкс).
+     */
+    uint64_t now();
+
+    /**
+     * @brief Продвижение виртуального времени.
+     * @param us Приращение (мкс).
+     */
+    void advance(uint64_t us);
+
+    /**
+     * @brief Счётчик тактов процессора ПК (rdtsc на x86, иначе наносекунды).
+     * @return Значение счётчика.
+     */
+    uint64_t cycles();
+
+    /**
+     * @brief Уровень цифрового пина.
+     * @param pin Номер пина.
+     * @return Последнее значение, записанное digitalWrite().
+     */
+    uint8_t pinLevel(uint8_t pin);
+}
+
+/**
+ * @class Print
+ * @brief Текстовый вывод, совместимый с Print ядра Arduino.
+ */
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t data) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    virtual int availableForWrite() { return 0; }
+    size_t write(const char* str) { return write(reinterpret_cast<const uint8_t*>(str), strlen(str)); }
+
+    size_t print(const __FlashStringHelper* str) { return print(reinterpret_cast<const char*>(str)); }
+    size_t print(const char* str) { return write(str); }
+    size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+    size_t print(unsigned char value, int base = DEC) { return print(static_cast<unsigned long>(value), base); }
+    size_t print(int value, int base = DEC) { return print(static_cast<long>(value), base); }
+    size_t print(unsigned int value, int base = DEC) { return print(static_cast<unsigned long>(value), base); }
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(double value, int digits = 2);
+
+    template <typename T>
+    size_t println(T value) { const size_t n = print(value); return n + println(); }
+    template <typename T>
+    size_t println(T value, int format) { const size_t n = print(value, format); return n + println(); }
+    size_t println() { return write("\r\n"); }
+};
+
+/**
+ * @class Stream
+ * @brief Поток ввода ядра Arduino.
+ */
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+/**
+ * @class SerialPeer
+ * @brief Устройство на линии, принимающее байты, переданные портом.
+ */
+class SerialPeer {
+public:
+    virtual ~SerialPeer() {}
+
+    /**
+     * @brief Приём байта, переданного портом.
+     * @param data Байт.
+     * @param time Время окончания стоп-бита на линии (мкс).
+     */
+    virtual void receive(uint8_t data, uint64_t time) = 0;
+};
+
+/**
+ * @class HardwareSerial
+ * @brief Последовательный порт, подключённый к имитируемой линии RS485.
+ *
+ * Передаваемые байты выходят на линию со скоростью порта (10 бит на символ) через
+ * буфер передачи на SERIAL_TX_BUFFER_SIZE байт и доставляются подключённым устройствам
+ * (attach()). Байты ответа устройства ставятся в очередь приёма (inject()) со временем
+ * поступления и становятся доступны, когда до него дойдёт виртуальное время.
+ * Порт без подключённых устройств (отладочный) отбрасывает вывод или печатает его в stdout (echo).
+ */
+class HardwareSerial : public Stream {
+public:
+    static constexpr int TX_BUFFER_SIZE = 64;   ///< Размер буфера передачи, как у ядра AVR
+
+    void begin(unsigned long baud) { begin(baud, SERIAL_8N1); }
+    void begin(unsigned long baud, uint8_t config);
+    void end() {}
+    int available() override;
+    int read() override;
+    int peek() override;
+    int availableForWrite() override;
+    void flush();
+    size_t write(uint8_t data) override;
+    using Print::write;
+    operator bool() { return true; }
+
+    /**
+     * @brief Подключение устройства к линии порта.
+     * @param peer Устройство.
+     */
+    void attach(SerialPeer* peer) { _peers.push_back(peer); }
+
+    /**
+     * @brief Постановка байта в очередь приёма порта.
+     * @param data Байт.
+     * @param time Время поступления (мкс).
+     */
+    void inject(uint8_t data, uint64_t time);
+
+    /**
+     * @brief Время передачи одного символа на текущей скорости.
+     * @return Время символа (мкс).
+     */
+    uint64_t characterTime() const { return _characterTime; }
+
+    /**
+     * @brief Время освобождения линии после передачи последнего байта.
+     * @return Время (мкс).
+     */
+    uint64_t lineFree() const { return _lineFree; }
+
+    bool echo = false;                       ///< Печатать вывод порта без устройств в stdout
+    unsigned long bytesWritten = 0;          ///< Передано байт на линию
+    unsigned long bytesRead = 0;             ///< Прочитано принятых байт
+
+private:
+    struct Incoming {
+        uint64_t time;                       ///< Время поступления (мкс)
+        uint8_t data;                        ///< Байт
+    };
+
+    std::vector<SerialPeer*> _peers;         ///< Устройства на линии
+    std::deque<Incoming> _rx;                ///< Очередь приёма
+    uint64_t _characterTime = 1042;          ///< Время символа (мкс), 9600 бод
+    uint64_t _lineFree = 0;                  ///< Время окончания передачи последнего байта (мкс)
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+extern HardwareSerial Serial3;
@@ -0,0 +1,346 @@
+#include "SimulatedHS321.h"
+#include "ModbusCRC.h"
+#include "ParameterGroup.h"
+
+/** @file SimulatedHS321.cpp
+ * @brief Реализация имитации ведомого частотника HS321.
+ *
+ * @author Dmitry Chernikov
+ */
+
+/**
+ * @brief Конструктор.
+ *
+ * Заполняет регистры параметров заводскими значениями каталога и подключает ведомого к линии.
+ *
+ * @param address Адрес ведомого.
+ * @param line Порт ведущего.
+ * @param seed Начальное значение генератора сбоев (не 0).
+ */
+SimulatedHS321::SimulatedHS321(const uint8_t address, HardwareSerial& line, const uint32_t seed)
+                                                                :_address(address),
+                                                                _line(&line),
+                                                                _random(seed ? seed : 1){
+    for (uint8_t index = 0; index < GROUP_COUNT; index++) {
+        const uint8_t code = (index == GROUP_COUNT - 1) ? static_cast<uint8_t>(GROUP_d) : index;
+        for (uint8_t number = 0; number < groupSizes[index]; number++) {
+            uint16_t& value = _parameters[groupOffset(index) + number];
+            value = 0;
+            Parameter param;
+            if (!ParameterGroup::findByAddress(static_cast<uint16_t>((code << 8) | number), param)) {
+                continue;
+            }
+            if (param.type == ParameterType::FLOAT) {
+                value = static_cast<uint16_t>(ScaledValue::fromFloat(param.factoryDefault.floatValue, param.decimals).value);
+            } else if (param.type == ParameterType::INT) {
+                value = static_cast<uint16_t>(param.factoryDefault.intValue);
+            }
+        }
+    }
+    // FC.02 — адрес частотника
+    _parameters[groupOffset(GROUP_FC) + 2] = address;
+    line.attach(this);
+}
+
+/**
+ * @brief Приём байта с линии.
+ *
+ * Пауза дольше t3.5 начинает новый кадр; кадр обрабатывается, как только принята его
+ * полная длина (по коду функции и количеству байт данных).
+ *
+ * @param data Байт.
+ * @param time Время приёма (мкс).
+ */
+void SimulatedHS321::receive(const uint8_t data, const uint64_t time) {
+    if (!behaviour.online || (_characterTime != 0 && _line->characterTime() != _characterTime)) {
+        return; // На другой скорости ведомый принимает только помехи
+    }
+    const uint64_t gap = (_line->characterTime() * 35 + 9) / 10;
+    if (_length > 0 && time - _lastByte > gap + _line->characterTime()) {
+        _length = 0;
+    }
+    _lastByte = time;
+    if (_length < sizeof(_frame)) {
+        _frame[_length++] = data;
+    }
+    const size_t expected = expectedLength();
+    if (expected != 0 && _length >= expected) {
+        const uint64_t start = sim::cycles();
+        process(time);
+        applyBaudRate();
+        cycles += sim::cycles() - start;
+        _length = 0;
+    }
+}
+
+/**
+ * @brief Ожидаемая длина кадра.
+ *
+ * @return Длина кадра или 0, если заголовок ещё не принят.
+ */
+size_t SimulatedHS321::expectedLength() const {
+    if (_length < 2) {
+        return 0;
+    }
+    if (_frame[1] == ModbusBus::WRITE_RANGE) {
+        return (_length < 7) ? 0 : 9 + static_cast<size_t>(_frame[6]);
+    }
+    // 0x03, 0x06 и неизвестные функции: адрес, функция, 4 байта данных, CRC
+    return 8;
+}
+
+/**
+ * @brief Обработка принятого кадра.
+ *
+ * @param time Время приёма последнего байта (мкс).
+ */
+void SimulatedHS321::process(const uint64_t time) {
+    if (ModbusCRC::calculate(_frame, _length) != 0) {
+        return;
+    }
+    const uint8_t slave = _frame[0];
+    if (slave != _address && slave != ModbusBus::BROADCAST_ADDRESS) {
+        return;
+    }
+    if (slave == _address) {
+        requests++;
+        if ((behaviour.dropAfterBaudChange && _characterTime != 0) || chance(behaviour.drop)) {
+            injectedFaults++;
+            return;
+        }
+    }
+
+    uint8_t response[256];
+    const uint8_t function = _frame[1];
+    const uint16_t start = static_cast<uint16_t>((_frame[2] << 8) | _frame[3]);
+    const uint16_t count = static_cast<uint16_t>((_frame[4] << 8) | _frame[5]);
+    uint8_t exception = 0;
+    size_t length = 0;
+    response[0] = _address;
+    response[1] = function;
+
+    if (slave == _address && chance(behaviour.exception)) {
+        injectedFaults++;
+        exception = behaviour.exceptionCode;
+    } else if (function == ModbusBus::READ) {
+        if (count == 0 || count > 125) {
+            exception = 0x03;
+        } else {
+            response[2] = static_cast<uint8_t>(count * 2);
+            for (uint16_t i = 0; i < count && exception == 0; i++) {
+                uint16_t value;
+                if (!readRegister(static_cast<uint16_t>(start + i), value)) {
+                    exception = 0x02;
+                }
+                response[3 + i * 2] = static_cast<uint8_t>(value >> 8);
+                response[4 + i * 2] = static_cast<uint8_t>(value & 0xFF);
+            }
+            length = 3 + count * 2;
+        }
+    } else if (function == ModbusBus::WRITE_ONE) {
+        exception = writeRegister(start, count);
+        memcpy(response, _frame, 6);
+        length = 6;
+    } else if (function == ModbusBus::WRITE_RANGE) {
+        if (count == 0 || count > 123 || _frame[6] != count * 2) {
+            exception = 0x03;
+        }
+        for (uint16_t i = 0; i < count && exception == 0; i++) {
+            exception = writeRegister(static_cast<uint16_t>(start + i),
+                                      static_cast<uint16_t>((_frame[7 + i * 2] << 8) | _frame[8 + i * 2]));
+        }
+        memcpy(response, _frame, 6);
+        length = 6;
+    } else {
+        exception = 0x01;
+    }
+
+    // Ведомые не отвечают на широковещательный запрос
+    if (slave == ModbusBus::BROADCAST_ADDRESS) {
+        return;
+    }
+    if (exception != 0) {
+        response[1] = static_cast<uint8_t>(function | 0x80);
+        response[2] = exception;
+        length = 3;
+    }
+    respond(response, length, time);
+}
+
+/**
+ * @brief Переход на скорость из FC.00 после ответа на запрос записи.
+ */
+void SimulatedHS321::applyBaudRate() {
+    if (_pendingCharacterTime != 0) {
+        _characterTime = _pendingCharacterTime;
+        _pendingCharacterTime = 0;
+    }
+}
+
+/**
+ * @brief Отправка ответа.
+ *
+ * Дописывает CRC, с вероятностью noise инвертирует один бит и ставит байты
+ * в очередь приёма ведущего начиная с time + latency.
+ *
+ * @param response Кадр без CRC (в буфере должно быть место для CRC).
+ * @param length Длина кадра без CRC.
+ * @param time Время приёма последнего байта запроса (мкс).
+ */
+void SimulatedHS321::respond(uint8_t* response, size_t length, const uint64_t time) {
+    const uint16_t crc = ModbusCRC::calculate(response, length);
+    response[length++] = static_cast<uint8_t>(crc & 0xFF);
+    response[length++] = static_cast<uint8_t>(crc >> 8);
+    if (chance(behaviour.noise)) {
+        injectedFaults++;
+        const uint32_t bit = _random % (length * 8);
+        response[bit / 8] ^= static_cast<uint8_t>(1 << (bit % 8));
+    }
+    uint64_t arrival = time + behaviour.latency;
+    for (size_t i = 0; i < length; i++) {
+        arrival += _line->characterTime();
+        _line->inject(response[i], arrival);
+    }
+    responses++;
+}
+
+/**
+ * @brief Значение регистра.
+ *
+ * @param address Адрес регистра.
+ * @param value Значение.
+ * @return true, если регистр есть в карте, иначе false.
+ */
+bool SimulatedHS321::readRegister(const uint16_t address, uint16_t& value) const {
+    uint16_t index;
+    if (parameterIndex(address, index)) {
+        // d-00 — выходная частота, d-01 — заданная частота
+        if (index == groupOffset(groupIndex(GROUP_d))) {
+            value = (_state == 3) ? 0 : _setpoint;
+        } else if (index == groupOffset(groupIndex(GROUP_d)) + 1) {
+            value = _setpoint;
+        } else {
+            value = _parameters[index];
+        }
+        return true;
+    }
+    switch (address) {
+        case 0x1000: value = _setpoint; return true;
+        case 0x3000: value = _state; return true;
+        case 0x8000: value = _fault; return true;
+        default: value = 0; return false;
+    }
+}
+
+/**
+ * @brief Установка значения регистра в обход Modbus.
+ *
+ * @param address Адрес регистра.
+ * @param value Значение.
+ * @return true, если регистр есть в карте, иначе false.
+ */
+bool SimulatedHS321::setRegister(const uint16_t address, const uint16_t value) {
+    uint16_t index;
+    if (parameterIndex(address, index)) {
+        _parameters[index] = value;
+        return true;
+    }
+    switch (address) {
+        case 0x1000: _setpoint = value; return true;
+        case 0x3000: _state = value; return true;
+        case 0x8000: _fault = value; return true;
+        default: return false;
+    }
+}
+
+/**
+ * @brief Запись регистра по запросу ведущего.
+ *
+ * @param address Адрес регистра.
+ * @param value Значение.
+ * @return Код исключения или 0.
+ */
+uint8_t SimulatedHS321::writeRegister(const uint16_t address, const uint16_t value) {
+    uint16_t index;
+    if (parameterIndex(address, index)) {
+        if ((address >> 8) == GROUP_d) {
+            return 0x02; // Группа мониторинга только для чтения
+        }
+        if (address == HS321::buildParameterAddress(GROUP_FC, 0)) {
+            const unsigned long baud = HS321::baudRate(value);
+            if (baud == 0) {
+                return 0x03;
+            }
+            _pendingCharacterTime = (10000000ULL + baud - 1) / baud;
+        }
+        _parameters[index] = value;
+        return 0;
+    }
+    if (address == 0x1000) {
+        _setpoint = value;
+        return 0;
+    }
+    if (address != 0x2000) {
+        return 0x02;
+    }
+    switch (value) {
+        case FORWARD_RUN_COMMAND:
+        case FORWARD_RUN_JOG_COMMAND:
+            _state = 1;
+            return 0;
+        case REVERSE_RUN_COMMAND:
+        case REVERSE_RUN_JOG_COMMAND:
+            _state = 2;
+            return 0;
+        case FREE_STOP_COMMAND:
+        case DECELERATE_STOP_COMMAND:
+            _state = 3;
+            return 0;
+        case FAULT_RESET_COMMAND:
+            _fault = 0;
+            return 0;
+        default:
+            return 0x03;
+    }
+}
+
+/**
+ * @brief Индекс регистра параметра.
+ *
+ * @param address Адрес параметра.
+ * @param index Индекс в _parameters.
+ * @return true, если адрес принадлежит группе F0–FP или d, иначе false.
+ */
+bool SimulatedHS321::parameterIndex(const uint16_t address, uint16_t& index) {
+    const uint8_t code = static_cast<uint8_t>(address >> 8);
+    const uint8_t number = static_cast<uint8_t>(address & 0xFF);
+    uint8_t group;
+    if (code == GROUP_d) {
+        group = groupIndex(GROUP_d);
+    } else if (code < GROUP_COUNT - 1) {
+        group = code;
+    } else {
+        return false;
+    }
+    if (number >= groupSizes[group]) {
+        return false;
+    }
+    index = static_cast<uint16_t>(groupOffset(group) + number);
+    return true;
+}
+
+/**
+ * @brief Событие с заданной вероятностью (генератор xorshift32).
+ *
+ * @param probability Вероятность (0..1).
+ * @return true, если событие произошло.
+ */
+bool SimulatedHS321::chance(const double probability) {
+    if (probability <= 0.0) {
+        return false;
+    }
+    _random ^= _random << 13;
+    _random ^= _random >> 17;
+    _random ^= _random << 5;
+    return _random < probability * 4294967296.0;
+}
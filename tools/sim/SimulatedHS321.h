@@ -0,0 +1,141 @@
+#pragma once
+
+/** @file SimulatedHS321.h
+ * @brief Имитация ведомого частотника HS321 на линии RS485 для симулятора на ПК.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "Arduino.h"
+#include "HS321.h"
+
+/**
+ * @struct SlaveBehaviour
+ * @brief Характеристики имитируемого ведомого: задержка ответа и внедряемые сбои.
+ *
+ * Вероятности задаются на один запрос и проверяются независимо в порядке drop, exception, noise.
+ * dropAfterBaudChange имитирует частотник, который после записи FC.00 перестал отвечать.
+ */
+struct SlaveBehaviour {
+    uint32_t latency = 2000;                 ///< Пауза от конца запроса до первого байта ответа (мкс)
+    double drop = 0.0;                       ///< Вероятность не ответить (тайм-аут у ведущего)
+    double exception = 0.0;                  ///< Вероятность ответить исключением exceptionCode
+    uint8_t exceptionCode = 0x06;            ///< Код внедряемого исключения (по умолчанию «ведомый занят»)
+    double noise = 0.0;                      ///< Вероятность исказить один бит ответа
+    bool online = true;                      ///< Ведомый подключён к линии
+    bool dropAfterBaudChange = false;        ///< Не отвечать после перехода на скорость из FC.00
+};
+
+/**
+ * @class SimulatedHS321
+ * @brief Ведомый Modbus RTU с картой регистров HS321.
+ *
+ * Регистры параметров F0–FP и d инициализируются заводскими значениями из каталога
+ * (ParameterGroup::findByAddress()), команды 0x2000 и задание частоты 0x1000 меняют
+ * состояние работы 0x3000 и d-00 (выходная частота). Адреса вне карты и запись в группу d
+ * отвечают исключением 0x02, неизвестные функции — 0x01. Кадры с неверной CRC и кадры
+ * других ведомых молча игнорируются, как это делает настоящий частотник.
+ *
+ * Пока FC.00 не записан по Modbus, ведомый принимает кадры на любой скорости порта.
+ * После записи FC.00 (ответ уходит ещё на прежней скорости) ведомый слышит только
+ * линию на скорости из FC.00 — как частотник после смены скорости связи.
+ */
+class SimulatedHS321 : public SerialPeer {
+public:
+    /**
+     * @brief Конструктор.
+     * @param address Адрес ведомого (FC.02).
+     * @param line Порт ведущего, к линии которого подключается ведомый.
+     * @param seed Начальное значение генератора сбоев.
+     */
+    SimulatedHS321(uint8_t address, HardwareSerial& line, uint32_t seed = 1);
+
+    void receive(uint8_t data, uint64_t time) override;
+
+    /**
+     * @brief Значение регистра.
+     * @param address Адрес регистра.
+     * @param value Значение.
+     * @return true, если регистр есть в карте, иначе false.
+     */
+    bool readRegister(uint16_t address, uint16_t& value) const;
+
+    /**
+     * @brief Установка значения регистра в обход Modbus.
+     * @param address Адрес регистра.
+     * @param value Значение.
+     * @return true, если регистр есть в карте, иначе false.
+     */
+    bool setRegister(uint16_t address, uint16_t value);
+
+    uint8_t address() const { return _address; }
+
+    SlaveBehaviour behaviour;                ///< Задержка и внедряемые сбои
+
+    unsigned long requests = 0;              ///< Принято кадров, адресованных ведомому
+    unsigned long responses = 0;             ///< Отправлено ответов
+    unsigned long injectedFaults = 0;        ///< Внедрено сбоев (drop, exception, noise)
+    uint64_t cycles = 0;                     ///< Время процессора ПК на обработку запросов (такты, см. sim::cycles())
+
+private:
+    uint8_t _address;                        ///< Адрес ведомого
+    HardwareSerial* _line;                   ///< Порт ведущего
+    uint32_t _random;                        ///< Состояние генератора xorshift32
+    uint8_t _frame[256];                     ///< Принимаемый кадр
+    size_t _length = 0;                      ///< Принято байт кадра
+    uint64_t _lastByte = 0;                  ///< Время приёма последнего байта (мкс)
+    uint16_t _parameters[groupOffset(GROUP_COUNT)]; ///< Регистры параметров, по groupOffset()
+    uint16_t _setpoint = 0;                  ///< Задание частоты 0x1000
+    uint16_t _state = 3;                     ///< Состояние работы 0x3000 (1 — вперёд, 2 — назад, 3 — стоп)
+    uint16_t _fault = 0;                     ///< Код неисправности 0x8000
+    uint64_t _characterTime = 0;             ///< Время символа на скорости FC.00 (мкс), 0 — любая скорость
+    uint64_t _pendingCharacterTime = 0;      ///< Время символа после отправки ответа на запись FC.00 (мкс)
+
+    /**
+     * @brief Ожидаемая длина кадра по уже принятым байтам.
+     * @return Длина кадра или 0, если заголовок ещё не принят.
+     */
+    size_t expectedLength() const;
+
+    /**
+     * @brief Обработка принятого кадра и отправка ответа.
+     * @param time Время приёма последнего байта (мкс).
+     */
+    void process(uint64_t time);
+
+    /**
+     * @brief Переход на скорость из FC.00 после ответа на запрос записи.
+     */
+    void applyBaudRate();
+
+    /**
+     * @brief Запись регистра по запросу ведущего.
+     * @param address Адрес регистра.
+     * @param value Значение.
+     * @return Код исключения или 0.
+     */
+    uint8_t writeRegister(uint16_t address, uint16_t value);
+
+    /**
+     * @brief Индекс регистра параметра в _parameters.
+     * @param address Адрес параметра.
+     * @param index Индекс.
+     * @return true, если адрес принадлежит группе F0–FP или d, иначе false.
+     */
+    static bool parameterIndex(uint16_t address, uint16_t& index);
+
+    /**
+     * @brief Отправка ответа с внедрением искажения.
+     * @param response Кадр без CRC.
+     * @param length Длина кадра без CRC.
+     * @param time Время приёма последнего байта запроса (мкс).
+     */
+    void respond(uint8_t* response, size_t length, uint64_t time);
+
+    /**
+     * @brief Событие с заданной вероятностью.
+     * @param probability Вероятность (0..1).
+     * @return true, если событие произошло.
+     */
+    bool chance(double probability);
+};
@@ -0,0 +1,229 @@
+/** @file bench.cpp
+ * @brief Бенчмарки уровня Modbus на ПК: CRC, стоимость кадра, пропускная способность шины и планировщика.
+ *
+ * Сборка и запуск: make bench. Каждая строка вывода — «имя значение единица»,
+ * чтобы результаты разных версий можно было сравнивать утилитой diff или скриптом.
+ * Время на шине виртуальное (см. Arduino.h) и не зависит от ПК; такты — реальные такты ПК.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "Arduino.h"
+#include "HS321.h"
+#include "ModbusCRC.h"
+#include "MonitorScheduler.h"
+#include "SimulatedHS321.h"
+
+#include <stdio.h>
+
+/**
+ * @brief Вывод результата.
+ *
+ * @param name Имя показателя.
+ * @param value Значение.
+ * @param unit Единица измерения.
+ */
+static void report(const char* name, const double value, const char* unit) {
+    printf("%-48s %14.2f %s\n", name, value, unit);
+}
+
+/**
+ * @brief Проверка условия бенчмарка: при нарушении результаты недостоверны.
+ *
+ * @param condition Условие.
+ * @param message Описание нарушения.
+ */
+static void require(const bool condition, const char* message) {
+    if (!condition) {
+        fprintf(stderr, "bench: %s\n", message);
+        exit(1);
+    }
+}
+
+/**
+ * @brief Такты на расчёт CRC кадра заданной длины.
+ *
+ * @param length Длина кадра.
+ * @param iterations Количество повторов.
+ */
+static void benchCrc(const size_t length, const unsigned iterations) {
+    uint8_t frame[256];
+    for (size_t i = 0; i < length; i++) {
+        frame[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+    volatile uint16_t sink = 0;
+    const uint64_t start = sim::cycles();
+    for (unsigned i = 0; i < iterations; i++) {
+        frame[0] = static_cast<uint8_t>(i);
+        sink = sink ^ ModbusCRC::calculate(frame, length);
+    }
+    const double perFrame = static_cast<double>(sim::cycles() - start) / iterations;
+    char name[64];
+    snprintf(name, sizeof(name), "crc.%zu_bytes.cycles_per_frame", length);
+    report(name, perFrame, "cycles");
+    snprintf(name, sizeof(name), "crc.%zu_bytes.cycles_per_byte", length);
+    report(name, perFrame / length, "cycles");
+}
+
+/**
+ * @brief Чтение группы регистров: транзакций в секунду и такты ведущего на кадр.
+ *
+ * Вызовы poll(), в которых шина передавала или принимала байты, считаются рабочими:
+ * их такты — стоимость формирования запроса, приёма и разбора ответа (вместе с имитацией
+ * порта). Остальные вызовы — холостой опрос в ожидании ответа.
+ *
+ * @param baud Скорость шины.
+ * @param registers Количество регистров в кадре.
+ * @param latency Задержка ответа ведомого (мкс).
+ */
+static void benchTransactions(const unsigned long baud, const uint8_t registers, const uint32_t latency) {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, baud, 2);
+    SimulatedHS321 slave(1, line);
+    slave.behaviour.latency = latency;
+    bus.begin();
+
+    const unsigned count = 500;
+    uint16_t values[125];
+    ModbusTransaction transaction;
+    transaction.setRead(1, HS321::buildParameterAddress(GROUP_F8, 0), values, registers);
+    uint64_t activeCycles = 0;
+    uint64_t idleCycles = 0;
+    unsigned long idlePolls = 0;
+    const uint64_t startTime = sim::now();
+    for (unsigned i = 0; i < count; i++) {
+        require(bus.submit(transaction), "submit failed");
+        while (transaction.status == TransactionStatus::PENDING) {
+            const unsigned long bytes = line.bytesWritten + line.bytesRead;
+            const uint64_t slaveBefore = slave.cycles;
+            const uint64_t before = sim::cycles();
+            bus.poll();
+            const uint64_t spent = sim::cycles() - before - (slave.cycles - slaveBefore);
+            if (line.bytesWritten + line.bytesRead != bytes || transaction.status != TransactionStatus::PENDING) {
+                activeCycles += spent;
+            } else {
+                idleCycles += spent;
+                idlePolls++;
+            }
+        }
+        require(transaction.status == TransactionStatus::COMPLETED, "read failed");
+    }
+    const double seconds = static_cast<double>(sim::now() - startTime) / 1e6;
+    uint16_t expected;
+    require(slave.readRegister(HS321::buildParameterAddress(GROUP_F8, registers - 1), expected)
+            && values[registers - 1] == expected, "read returned a wrong value");
+
+    const TransactionStats& stats = bus.transactionStats();
+    // Время одного кадра на линии: запрос 8 байт, ответ 5 + 2n байт
+    const double lineTime = (8.0 + 5.0 + 2.0 * registers) * line.characterTime() + latency;
+    char name[80];
+    snprintf(name, sizeof(name), "bus.%lu.read%u.transactions_per_s", baud, registers);
+    report(name, count / seconds, "1/s");
+    snprintf(name, sizeof(name), "bus.%lu.read%u.line_efficiency", baud, registers);
+    report(name, 100.0 * lineTime * count / (seconds * 1e6), "%");
+    snprintf(name, sizeof(name), "bus.%lu.read%u.round_trip_avg", baud, registers);
+    report(name, stats.averageRoundTrip(), "us");
+    snprintf(name, sizeof(name), "bus.%lu.read%u.master_cycles_per_frame", baud, registers);
+    report(name, static_cast<double>(activeCycles) / count, "cycles");
+    snprintf(name, sizeof(name), "bus.%lu.read%u.idle_poll_cycles", baud, registers);
+    report(name, idlePolls ? static_cast<double>(idleCycles) / idlePolls : 0.0, "cycles");
+}
+
+/**
+ * @brief Пропускная способность планировщика опроса на нескольких частотниках.
+ *
+ * Каждый частотник опрашивает d-00..d-05 с периодом 20 мс — больше, чем успевает шина,
+ * поэтому показатели отражают предельную пропускную способность. В варианте с помехами
+ * ответы искажаются с вероятностью noise, а последний частотник отключён от линии.
+ *
+ * @param baud Скорость шины.
+ * @param noise Вероятность искажения ответа.
+ * @param deadSlave Отключить последний частотник.
+ */
+static void benchScheduler(const unsigned long baud, const double noise, const bool deadSlave) {
+    constexpr uint8_t drives = 4;
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, baud, 2);
+    RetryPolicy retry;
+    retry.attempts = 3;
+    bus.setRetryPolicy(retry);
+
+    SimulatedHS321* slaves[drives];
+    HS321* hs321[drives];
+    MonitorScheduler* schedulers[drives];
+    for (uint8_t i = 0; i < drives; i++) {
+        slaves[i] = new SimulatedHS321(i + 1, line, 1000 + i);
+        slaves[i]->behaviour.latency = 1500;
+        slaves[i]->behaviour.noise = noise;
+        hs321[i] = new HS321(i + 1, bus);
+        hs321[i]->begin();
+        schedulers[i] = new MonitorScheduler(*hs321[i]);
+        for (uint8_t signal = 0; signal < 6; signal++) {
+            schedulers[i]->setPeriod(signal, 20);
+        }
+    }
+    if (deadSlave) {
+        slaves[drives - 1]->behaviour.online = false;
+    }
+
+    const uint64_t duration = 10000000; // 10 с виртуального времени
+    const uint64_t start = sim::now();
+    const uint64_t startCycles = sim::cycles();
+    unsigned long loops = 0;
+    while (sim::now() - start < duration) {
+        for (MonitorScheduler* scheduler : schedulers) {
+            scheduler->poll();
+        }
+        loops++;
+    }
+    const double seconds = static_cast<double>(sim::now() - start) / 1e6;
+    uint64_t slaveCycles = 0;
+    unsigned long failed = 0;
+    unsigned long missed = 0;
+    unsigned long liveFrames = 0;
+    for (uint8_t i = 0; i < drives; i++) {
+        slaveCycles += slaves[i]->cycles;
+        failed += schedulers[i]->failedFrames();
+        missed += schedulers[i]->missedDeadlines();
+        if (!deadSlave || i != drives - 1) {
+            liveFrames += hs321[i]->stats().responses;
+        }
+    }
+
+    char prefix[64];
+    snprintf(prefix, sizeof(prefix), "scheduler.%lu.%s", baud, deadSlave ? "faulty" : "clean");
+    char name[96];
+    snprintf(name, sizeof(name), "%s.frames_per_s", prefix);
+    report(name, bus.transactionStats().transactions / seconds, "1/s");
+    snprintf(name, sizeof(name), "%s.live_drive_responses_per_s", prefix);
+    report(name, liveFrames / seconds, "1/s");
+    snprintf(name, sizeof(name), "%s.failed_frames", prefix);
+    report(name, failed, "frames");
+    snprintf(name, sizeof(name), "%s.missed_deadlines", prefix);
+    report(name, missed, "periods");
+    snprintf(name, sizeof(name), "%s.master_cycles_per_loop", prefix);
+    report(name, static_cast<double>(sim::cycles() - startCycles - slaveCycles) / loops, "cycles");
+
+    for (uint8_t i = 0; i < drives; i++) {
+        delete schedulers[i];
+        delete hs321[i];
+        delete slaves[i];
+    }
+}
+
+int main() {
+    benchCrc(8, 1000000);
+    benchCrc(256, 100000);
+
+    benchTransactions(9600, 1, 2000);
+    benchTransactions(9600, 10, 2000);
+    benchTransactions(19200, 10, 2000);
+    benchTransactions(115200, 10, 500);
+    benchTransactions(115200, 56, 500);
+
+    benchScheduler(19200, 0.0, false);
+    benchScheduler(19200, 0.01, true);
+    return 0;
+}
@@ -0,0 +1,586 @@
+/** @file test.cpp
+ * @brief Проверки поведения библиотеки на симуляторе.
+ *
+ * Сборка и запуск: make test. Каждая проверка печатает «ok имя»; первое нарушение
+ * печатает причину и завершает программу с кодом 1.
+ *
+ * @author Dmitry Chernikov
+ */
+
+#include "Arduino.h"
+#include "BatchReader.h"
+#include "DriveProfile.h"
+#include "FaultWatch.h"
+#include "HS321.h"
+#include "ModbusCRC.h"
+#include "ModbusGateway.h"
+#include "PlcProgram.h"
+#include "RegisterCache.h"
+#include "SetpointStreamer.h"
+#include "SimulatedHS321.h"
+
+#include <stdio.h>
+
+/**
+ * @brief Проверка условия.
+ *
+ * @param condition Условие.
+ * @param message Описание нарушения.
+ */
+static void require(const bool condition, const char* message) {
+    if (!condition) {
+        fprintf(stderr, "test: %s\n", message);
+        exit(1);
+    }
+}
+
+/**
+ * @brief Продвижение шины, пока на ней есть транзакции.
+ *
+ * @param bus Шина.
+ */
+static void drain(ModbusBus& bus) {
+    while (bus.poll()) {
+    }
+}
+
+/**
+ * @brief Значение регистра имитируемого частотника.
+ *
+ * @param slave Частотник.
+ * @param group Группа параметра.
+ * @param numberGroup Номер параметра в группе.
+ * @return Значение регистра.
+ */
+static uint16_t registerValue(const SimulatedHS321& slave, const GroupsParameter group, const uint8_t numberGroup) {
+    uint16_t value = 0;
+    require(slave.readRegister(HS321::buildParameterAddress(group, numberGroup), value), "register not in the slave map");
+    return value;
+}
+
+/**
+ * @brief Поиск скорости частотника, работающего не на скорости шины.
+ *
+ * Молчание на неверных скоростях не должно признать частотник недоступным и остановить
+ * перебор (политика учёта состояния связи — по умолчанию), в том числе если частотник
+ * уже признан недоступным до поиска.
+ */
+static void testDetectBaudRate() {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, 9600, 2);
+    SimulatedHS321 slave(1, line);
+    HS321 hs321(1, bus);
+    hs321.begin();
+
+    require(hs321.switchBaudRate(2400) && bus.baud() == 2400, "switch to 2400 failed");
+    bus.setBaud(9600);
+    bus.resetHealth();
+    require(hs321.detectBaudRate(), "baud rate not detected");
+    require(bus.baud() == 2400, "wrong baud rate detected");
+    const SlaveHealth* health = bus.health(1);
+    require(health == nullptr || (health->online && health->consecutiveFailures == 0), "health not reset after detection");
+
+    // Частотник признан недоступным до поиска
+    bus.setBaud(9600);
+    uint16_t value;
+    for (uint8_t i = 0; i < bus.healthPolicy().failureThreshold; i++) {
+        require(!hs321.readSingleGroupParameter(GROUP_FC, 0, &value), "read at a wrong baud rate succeeded");
+    }
+    require(!bus.isOnline(1), "slave not marked offline");
+    require(hs321.detectBaudRate() && bus.baud() == 2400, "baud rate not detected for an offline slave");
+    require(bus.isOnline(1), "slave still offline after detection");
+    printf("ok detect_baud_rate\n");
+}
+
+/**
+ * @brief Откат смены скорости, если частотник не отвечает после записи FC.00.
+ *
+ * Три неудачные проверки на новой скорости не должны признать частотник недоступным:
+ * запись прежнего кода FC.00 обязана уйти на линию, а lastError() — сообщить о первой
+ * неудаче (тайм-аут проверки), а не о SLAVE_OFFLINE.
+ */
+static void testSwitchBaudRateRollback() {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, 9600, 2);
+    SimulatedHS321 slave(1, line);
+    slave.behaviour.dropAfterBaudChange = true;
+    HS321 hs321(1, bus);
+    hs321.begin();
+
+    require(!hs321.switchBaudRate(19200), "switch succeeded with a silent drive");
+    require(hs321.lastError() == TransactionError::TIMEOUT, "lastError is not the confirm timeout");
+    require(bus.baud() == 9600, "bus not returned to the previous baud rate");
+    // Чтение FC.00, запись FC.00, три проверки и запись отката — на скорости частотника
+    require(slave.requests == 6, "rollback write did not reach the drive");
+    require(bus.isOnline(1), "slave marked offline by the switch");
+    printf("ok switch_baud_rate_rollback\n");
+}
+
+/**
+ * @brief Пакетное чтение при заполненной очереди шины.
+ *
+ * Заполненная очередь — временное состояние: кадры пакета ждут места в ней, а не
+ * считаются неудачными.
+ */
+static void testBatchReaderQueueFull() {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, 19200, 2);
+    SimulatedHS321 slave(1, line);
+    HS321 hs321(1, bus);
+    hs321.begin();
+
+    ModbusTransaction fillers[HS321_BUS_QUEUE_SIZE + 1];
+    uint16_t sink[HS321_BUS_QUEUE_SIZE + 1];
+    size_t queued = 0;
+    while (queued < HS321_BUS_QUEUE_SIZE + 1) {
+        fillers[queued].setRead(1, HS321::buildParameterAddress(GROUP_F0, 0), &sink[queued], 1);
+        if (!bus.submit(fillers[queued])) {
+            break;
+        }
+        queued++;
+    }
+    require(queued <= HS321_BUS_QUEUE_SIZE && fillers[queued].error == TransactionError::QUEUE_FULL, "bus queue not filled");
+
+    BatchReader batch(hs321);
+    uint16_t first = 0xFFFF;
+    uint16_t second = 0xFFFF;
+    batch.add(GROUP_F0, 1, &first);
+    batch.add(GROUP_F8, 0, &second);
+    require(batch.frameCount() == 2, "unexpected frame count");
+    require(batch.begin(), "batch not started with a full bus queue");
+    while (batch.poll() == TransactionStatus::PENDING) {
+    }
+    require(batch.poll() == TransactionStatus::COMPLETED && batch.failedFrames() == 0, "batch failed with a full bus queue");
+    uint16_t expected;
+    require(slave.readRegister(HS321::buildParameterAddress(GROUP_F0, 1), expected) && first == expected, "wrong F0.01 value");
+    require(slave.readRegister(HS321::buildParameterAddress(GROUP_F8, 0), expected) && second == expected, "wrong F8.00 value");
+    for (size_t i = 0; i < queued; i++) {
+        require(fillers[i].status == TransactionStatus::COMPLETED, "queued read did not complete");
+    }
+
+    // Пакет, ни один кадр которого не допущен шиной, не запускается
+    HS321 allDrives(ModbusBus::BROADCAST_ADDRESS, bus);
+    BatchReader rejected(allDrives);
+    rejected.add(GROUP_F0, 0, &first);
+    require(!rejected.begin() && rejected.poll() == TransactionStatus::FAILED, "begin() accepted a batch with no valid frame");
+    printf("ok batch_reader_queue_full\n");
+}
+
+/**
+ * @struct CompletionLog
+ * @brief Порядок завершения транзакций.
+ */
+struct CompletionLog {
+    uint8_t order[16];                       ///< Номера транзакций в порядке завершения
+    uint8_t count = 0;                       ///< Количество завершённых транзакций
+};
+
+static CompletionLog completions;            ///< Порядок завершения для testQueueOrder()
+
+/**
+ * @brief Функция обратного вызова: номер транзакции — её context.
+ */
+static void recordCompletion(TransactionStatus, void* context) {
+    completions.order[completions.count++] = static_cast<uint8_t>(reinterpret_cast<uintptr_t>(context));
+}
+
+/**
+ * @brief Порядок очереди: URGENT раньше NORMAL, внутри приоритета ведомые по кругу.
+ */
+static void testQueueOrder() {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, 19200, 2);
+    SimulatedHS321 first(1, line);
+    SimulatedHS321 second(2, line);
+    bus.begin();
+
+    // 0..2 — ведомый 1, 3..4 — ведомый 2, 5 — срочная транзакция ведомому 2
+    const uint8_t slaves[] = { 1, 1, 1, 2, 2, 2 };
+    ModbusTransaction transactions[6];
+    uint16_t values[6];
+    completions = CompletionLog();
+    for (uint8_t i = 0; i < 6; i++) {
+        transactions[i].setRead(slaves[i], HS321::buildParameterAddress(GROUP_F0, i), &values[i], 1);
+        transactions[i].callback = recordCompletion;
+        transactions[i].context = reinterpret_cast<void*>(static_cast<uintptr_t>(i));
+    }
+    transactions[5].priority = TransactionPriority::URGENT;
+    for (ModbusTransaction& transaction : transactions) {
+        require(bus.submit(transaction), "submit failed");
+    }
+    drain(bus);
+
+    const uint8_t expected[] = { 5, 0, 3, 1, 4, 2 };
+    require(completions.count == 6, "not all transactions completed");
+    for (uint8_t i = 0; i < 6; i++) {
+        require(completions.order[i] == expected[i], "wrong dispatch order");
+        require(transactions[i].status == TransactionStatus::COMPLETED, "transaction failed");
+    }
+
+    // Срочная транзакция, поставленная во время обмена, опережает ожидающие обычные
+    completions = CompletionLog();
+    transactions[1].priority = TransactionPriority::URGENT;
+    transactions[5].priority = TransactionPriority::NORMAL;
+    require(bus.submit(transactions[0]) && bus.submit(transactions[3]), "submit failed");
+    const unsigned long written = line.bytesWritten;
+    while (line.bytesWritten == written) {
+        bus.poll();
+    }
+    require(bus.submit(transactions[1]), "submit failed");
+    drain(bus);
+    // Последним обслуживался ведомый 1, поэтому первым уходит кадр ведомого 2
+    require(completions.count == 3 && completions.order[0] == 3 && completions.order[1] == 1 && completions.order[2] == 0,
+            "urgent transaction did not pre-empt the queued normal one");
+    printf("ok queue_order\n");
+}
+
+/**
+ * @brief Исчерпание повторов признаёт ведомого недоступным, проверка связи возвращает его.
+ */
+static void testRetryAndHealth() {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, 19200, 2);
+    SimulatedHS321 slave(1, line);
+    HS321 hs321(1, bus);
+    hs321.begin();
+    RetryPolicy retry;
+    retry.attempts = 3;
+    bus.setRetryPolicy(retry);
+
+    slave.behaviour.online = false;
+    uint16_t value;
+    require(!hs321.readSingleGroupParameter(GROUP_F0, 1, &value), "read from a disconnected slave succeeded");
+    require(hs321.lastError() == TransactionError::TIMEOUT, "retries did not end with a timeout");
+    require(line.bytesWritten == 3 * 8, "not every retry reached the line");
+    require(!bus.isOnline(1), "slave not marked offline after retry exhaustion");
+
+    // Недоступный ведомый не занимает шину
+    const unsigned long written = line.bytesWritten;
+    require(!hs321.readSingleGroupParameter(GROUP_F0, 1, &value), "read from an offline slave succeeded");
+    require(hs321.lastError() == TransactionError::SLAVE_OFFLINE, "offline slave not rejected");
+    require(line.bytesWritten == written, "request to an offline slave reached the line");
+
+    slave.behaviour.online = true;
+    const uint64_t start = sim::now();
+    while (!bus.isOnline(1) && sim::now() - start < 3000000) {
+        bus.poll();
+    }
+    require(bus.isOnline(1), "probe did not bring the slave back");
+    require(slave.requests == 1, "more than one probe answered");
+    require(hs321.readSingleGroupParameter(GROUP_F0, 1, &value) && value == registerValue(slave, GROUP_F0, 1),
+            "read after recovery failed");
+    printf("ok retry_and_health\n");
+}
+
+/**
+ * @struct TestMaster
+ * @brief Внешний ведущий на порту шлюза: собирает байты ответа.
+ */
+struct TestMaster : public SerialPeer {
+    std::vector<uint8_t> received;           ///< Принятые байты
+
+    void receive(const uint8_t data, uint64_t) override { received.push_back(data); }
+};
+
+/**
+ * @brief Запрос внешнего ведущего к шлюзу и ожидание ответа.
+ *
+ * @param gateway Шлюз.
+ * @param port Порт шлюза.
+ * @param master Ведущий.
+ * @param request Кадр без CRC.
+ * @param length Длина кадра без CRC.
+ */
+static void gatewayRequest(ModbusGateway& gateway, HardwareSerial& port, TestMaster& master,
+                           const uint8_t* request, const size_t length) {
+    uint8_t frame[32];
+    memcpy(frame, request, length);
+    const uint16_t crc = ModbusCRC::calculate(frame, length);
+    frame[length] = static_cast<uint8_t>(crc & 0xFF);
+    frame[length + 1] = static_cast<uint8_t>(crc >> 8);
+    master.received.clear();
+    const uint64_t start = sim::now();
+    for (size_t i = 0; i < length + 2; i++) {
+        port.inject(frame[i], start + (i + 1) * port.characterTime());
+    }
+    while (sim::now() - start < 200000) {
+        gateway.poll();
+    }
+}
+
+/**
+ * @brief Проверка ответа-исключения шлюза.
+ *
+ * @param master Ведущий.
+ * @param function Функция запроса.
+ * @param code Ожидаемый код исключения.
+ * @return true, если принят кадр исключения с верной CRC.
+ */
+static bool isException(const TestMaster& master, const uint8_t function, const uint8_t code) {
+    return master.received.size() == 5 && master.received[1] == (function | 0x80) && master.received[2] == code
+           && ModbusCRC::calculate(master.received.data(), master.received.size()) == 0;
+}
+
+/**
+ * @brief RegisterCache: отложенная запись и запись внешнего ведущего через шлюз.
+ *
+ * flush() передаёт смежные грязные регистры одним кадром. Запись ведущего, подтверждённая
+ * частотником, заменяет грязное значение кэша, и flush() его уже не записывает.
+ * Шлюз отвечает ILLEGAL_FUNCTION на неизвестную функцию и ILLEGAL_DATA_VALUE на
+ * укороченный кадр и недопустимое количество регистров.
+ */
+static void testCacheAndGateway() {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, 19200, 2);
+    SimulatedHS321 slave(1, line);
+    HS321 hs321(1, bus);
+    hs321.begin();
+    RegisterCache cache(hs321);
+
+    require(cache.write(GROUP_F1, 0, 11) && cache.write(GROUP_F1, 1, 12) && cache.write(GROUP_F1, 1, 13),
+            "cache write failed");
+    require(cache.dirtyCount() == 2, "repeated writes not coalesced");
+    require(registerValue(slave, GROUP_F1, 1) != 13, "write-behind reached the drive before flush");
+    const unsigned long transactions = bus.transactionStats().transactions;
+    require(cache.flush() && cache.dirtyCount() == 0, "flush failed");
+    require(bus.transactionStats().transactions == transactions + 1, "adjacent dirty registers not written in one frame");
+    require(registerValue(slave, GROUP_F1, 0) == 11 && registerValue(slave, GROUP_F1, 1) == 13, "flush wrote wrong values");
+
+    HardwareSerial port;
+    TestMaster master;
+    port.attach(&master);
+    ModbusGateway gateway(port, 19200, 10, hs321, cache);
+    gateway.begin();
+
+    const uint16_t address = HS321::buildParameterAddress(GROUP_F1, 2);
+    require(cache.write(GROUP_F1, 2, 21), "cache write failed");
+    const uint8_t write[] = { 10, ModbusBus::WRITE_ONE, static_cast<uint8_t>(address >> 8), static_cast<uint8_t>(address & 0xFF), 0, 42 };
+    gatewayRequest(gateway, port, master, write, sizeof(write));
+    require(master.received.size() == 8 && memcmp(master.received.data(), write, sizeof(write)) == 0, "gateway write not echoed");
+    require(!cache.isDirty(GROUP_F1, 2), "master write did not replace the dirty entry");
+    uint16_t value;
+    require(cache.peek(GROUP_F1, 2, &value) && value == 42, "cache does not hold the master's value");
+    require(cache.flush() && registerValue(slave, GROUP_F1, 2) == 42, "flush overwrote the master's write");
+
+    // Чтение из зеркала без обращения к частотнику
+    const unsigned long forwarded = gateway.stats().forwarded;
+    const uint8_t read[] = { 10, ModbusBus::READ, static_cast<uint8_t>(address >> 8), static_cast<uint8_t>(address & 0xFF), 0, 1 };
+    gatewayRequest(gateway, port, master, read, sizeof(read));
+    require(master.received.size() == 7 && master.received[3] == 0 && master.received[4] == 42, "mirror read returned a wrong value");
+    require(gateway.stats().forwarded == forwarded && gateway.stats().cacheHits == 1, "mirror read forwarded to the drive");
+
+    const uint8_t unknown[] = { 10, 0x05, 0, 0, 0xFF, 0 };
+    gatewayRequest(gateway, port, master, unknown, sizeof(unknown));
+    require(isException(master, 0x05, 0x01), "unknown function not answered with ILLEGAL_FUNCTION");
+
+    const uint8_t truncated[] = { 10, ModbusBus::READ, 0x01 };
+    gatewayRequest(gateway, port, master, truncated, sizeof(truncated));
+    require(isException(master, ModbusBus::READ, 0x03), "truncated request not answered with ILLEGAL_DATA_VALUE");
+
+    const uint8_t tooMany[] = { 10, ModbusBus::READ, 0x01, 0x00, 0, 126 };
+    gatewayRequest(gateway, port, master, tooMany, sizeof(tooMany));
+    require(isException(master, ModbusBus::READ, 0x03), "oversized read not answered with ILLEGAL_DATA_VALUE");
+
+    const uint8_t badCount[] = { 10, ModbusBus::WRITE_RANGE, 0x01, 0x00, 0, 2, 2, 0, 1 };
+    gatewayRequest(gateway, port, master, badCount, sizeof(badCount));
+    require(isException(master, ModbusBus::WRITE_RANGE, 0x03), "short 0x10 frame not answered with ILLEGAL_DATA_VALUE");
+    printf("ok cache_and_gateway\n");
+}
+
+/**
+ * @brief DriveProfile: снятие, сериализация, загрузка и запись в другой частотник.
+ */
+static void testDriveProfileRoundTrip() {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, 19200, 2);
+    SimulatedHS321 source(1, line);
+    SimulatedHS321 target(2, line);
+    HS321 sourceDrive(1, bus);
+    HS321 targetDrive(2, bus);
+    sourceDrive.begin();
+
+    DriveProfile profile(sourceDrive);
+    require(profile.capture() && profile.size() == 0, "factory drive has a non-empty profile");
+
+    // Отличия от заводских значений: два смежных параметра и один отдельный
+    const uint16_t changed[] = { HS321::buildParameterAddress(GROUP_F1, 0), HS321::buildParameterAddress(GROUP_F1, 1),
+                                 HS321::buildParameterAddress(GROUP_F8, 5) };
+    for (const uint16_t address : changed) {
+        uint16_t value;
+        require(source.readRegister(address, value) && source.setRegister(address, static_cast<uint16_t>(value + 1)),
+                "register not in the slave map");
+    }
+    require(profile.capture() && profile.size() == 3, "capture did not find exactly the changed parameters");
+
+    uint8_t data[64];
+    const size_t length = profile.serialize(data, sizeof(data));
+    require(length != 0 && length == profile.serializedSize(), "serialize failed");
+    require(profile.serialize(data, length - 1) == 0, "serialize ignored the buffer size");
+
+    DriveProfile restored(targetDrive);
+    require(!restored.deserialize(data, length - 1) && restored.size() == 0, "truncated profile accepted");
+    require(restored.deserialize(data, length) && restored.size() == 3, "deserialize failed");
+    for (size_t i = 0; i < 3; i++) {
+        uint16_t address;
+        uint16_t value;
+        uint16_t expected;
+        require(restored.entry(i, address, value) && address == changed[i], "deserialized a wrong address");
+        require(source.readRegister(address, expected) && value == expected, "deserialized a wrong value");
+    }
+    require(restored.frameCount() == 2, "adjacent parameters not merged into one frame");
+    require(restored.apply(), "apply failed");
+    for (const uint16_t address : changed) {
+        uint16_t expected;
+        uint16_t actual;
+        require(source.readRegister(address, expected) && target.readRegister(address, actual) && actual == expected,
+                "apply wrote a wrong value");
+    }
+
+    DriveProfile check(targetDrive);
+    uint8_t copy[64];
+    require(check.capture() && check.serialize(copy, sizeof(copy)) == length && memcmp(copy, data, length) == 0,
+            "profile captured from the target differs");
+    printf("ok drive_profile_round_trip\n");
+}
+
+/**
+ * @brief SetpointStreamer: повторное и близкое задание не передаётся.
+ */
+static void testSetpointSuppression() {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, 19200, 2);
+    SimulatedHS321 slave(1, line);
+    HS321 hs321(1, bus);
+    hs321.begin();
+    SetpointStreamer streamer(hs321, 10);
+
+    streamer.set(5000);
+    while (!streamer.isSettled()) {
+        streamer.poll();
+    }
+    uint16_t setpoint;
+    require(slave.readRegister(0x1000, setpoint) && setpoint == 5000, "setpoint not written");
+    require(streamer.confirmed() == 5000 && streamer.stats().updates == 1, "setpoint not confirmed");
+
+    const unsigned long requests = slave.requests;
+    streamer.set(5000);
+    streamer.set(5008);
+    for (uint8_t i = 0; i < 10 || !streamer.isSettled(); i++) {
+        streamer.poll();
+    }
+    require(slave.requests == requests, "unchanged setpoint reached the line");
+    require(streamer.stats().suppressed == 1 && streamer.stats().overwritten == 1, "suppression not counted");
+
+    // Дрейф накапливается относительно подтверждённого значения
+    streamer.set(5011);
+    while (!streamer.isSettled()) {
+        streamer.poll();
+    }
+    require(slave.readRegister(0x1000, setpoint) && setpoint == 5011 && streamer.stats().updates == 2,
+            "setpoint beyond the resolution not written");
+    printf("ok setpoint_suppression\n");
+}
+
+/**
+ * @brief FaultWatch: авария фиксируется один раз со снимком группы d.
+ */
+static void testFaultLatch() {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, 19200, 2);
+    SimulatedHS321 slave(1, line);
+    HS321 hs321(1, bus);
+    hs321.begin();
+    ParametersHS321 parameters(Model::MODEL_1_5);
+    FaultWatch watch(hs321, parameters, 10);
+
+    const uint64_t start = sim::now();
+    while (sim::now() - start < 200000) {
+        watch.poll();
+    }
+    require(watch.size() == 0 && watch.failedFrames() == 0, "event without a fault");
+
+    const uint16_t current = HS321::buildParameterAddress(GROUP_d, 4);
+    require(slave.setRegister(current, 1234) && slave.setRegister(0x8000, 14), "fault registers not in the slave map");
+    const uint64_t tripped = sim::now();
+    while (sim::now() - tripped < 500000) {
+        watch.poll();
+    }
+    require(watch.size() == 1 && watch.totalEvents() == 1, "fault not latched exactly once");
+    const FaultEvent* event = watch.event(0);
+    require(event != nullptr && event->faultCode == 14 && event->described, "wrong fault event");
+    require(event->snapshotValid && event->monitor[4] == 1234, "snapshot does not hold group d at the trip");
+
+    // Сброс аварии и новая авария — новое событие
+    require(slave.setRegister(0x8000, 0), "fault register not in the slave map");
+    const uint64_t reset = sim::now();
+    while (sim::now() - reset < 200000) {
+        watch.poll();
+    }
+    require(slave.setRegister(0x8000, 14), "fault register not in the slave map");
+    const uint64_t again = sim::now();
+    while (sim::now() - again < 200000) {
+        watch.poll();
+    }
+    require(watch.totalEvents() == 2, "repeated fault not latched");
+    printf("ok fault_latch\n");
+}
+
+/**
+ * @brief PlcProgram: загрузка, проверка и несовпадение с указанием параметра.
+ */
+static void testPlcProgram() {
+    HardwareSerial line;
+    HardwareSerial debug;
+    ModbusBus bus(line, debug, 19200, 2);
+    SimulatedHS321 slave(1, line);
+    HS321 hs321(1, bus);
+    hs321.begin();
+
+    PlcProgram program;
+    require(program.addStep(ScaledValue(1000, 2), PlcDirection::FORWARD, ScaledValue(50, 1)), "step 1 rejected");
+    require(program.addStep(ScaledValue(30, 0), PlcDirection::REVERSE, ScaledValue(12, 0), true), "step 2 rejected");
+    program.setCycle(PlcCycle::CONTINUOUS);
+
+    const unsigned long transactions = bus.transactionStats().transactions;
+    require(program.load(hs321), "load failed");
+    require(bus.transactionStats().transactions == transactions + 2, "load did not use one write and one read frame");
+    uint16_t image[PlcProgram::IMAGE_SIZE];
+    program.compile(image);
+    for (uint8_t i = 0; i < PlcProgram::IMAGE_SIZE; i++) {
+        require(registerValue(slave, GROUP_F7, i) == image[i], "drive does not hold the program image");
+    }
+    uint8_t mismatch = 0;
+    require(program.verify(hs321, &mismatch) && mismatch == PlcProgram::IMAGE_SIZE, "verify failed on a loaded program");
+
+    require(slave.setRegister(HS321::buildParameterAddress(GROUP_F7, 11), static_cast<uint16_t>(image[11] + 1)),
+            "register not in the slave map");
+    require(!program.verify(hs321, &mismatch) && mismatch == 11, "mismatch not reported at F7.11");
+
+    slave.behaviour.online = false;
+    require(!program.verify(hs321, &mismatch) && mismatch == PlcProgram::IMAGE_SIZE
+            && hs321.lastError() == TransactionError::TIMEOUT, "read failure reported as a mismatch");
+    printf("ok plc_program\n");
+}
+
+int main() {
+    testDetectBaudRate();
+    testSwitchBaudRateRollback();
+    testBatchReaderQueueFull();
+    testQueueOrder();
+    testRetryAndHealth();
+    testCacheAndGateway();
+    testDriveProfileRoundTrip();
+    testSetpointSuppression();
+    testFaultLatch();
+    testPlcProgram();
+    return 0;
+}